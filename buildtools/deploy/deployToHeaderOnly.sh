@@ -59,11 +59,14 @@ for i in \
     cluon/IPv4Tools.hpp \
     cluon/UDPPacketSizeConstraints.hpp \
     cluon/UDPSender.hpp \
+    cluon/BufferPool.hpp \
+    cluon/Reactor.hpp \
     cluon/UDPReceiver.hpp \
     cluon/TCPConnection.hpp \
     cluon/TCPServer.hpp \
     cluon/ProtoConstants.hpp \
     cluon/ToProtoVisitor.hpp \
+    cluon/ProtoSizeVisitor.hpp \
     cluon/FromProtoVisitor.hpp \
     cluon/FromLCMVisitor.hpp \
     cluon/MsgPackConstants.hpp \
@@ -75,7 +78,9 @@ for i in \
     cluon/ToLCMVisitor.hpp \
     cluon/ToODVDVisitor.hpp \
     cluon/ToMsgPackVisitor.hpp \
+    cluon/FragmentAssembler.hpp \
     cluon/Envelope.hpp \
+    cluon/RecFileIndex.hpp \
     cluon/EnvelopeConverter.hpp \
     cluon/GenericMessage.hpp \
     cluon/LCMToGenericMessage.hpp \
@@ -97,10 +102,13 @@ for i in \
     TerminateHandler.cpp \
     IPv4Tools.cpp \
     UDPSender.cpp \
+    BufferPool.cpp \
+    Reactor.cpp \
     UDPReceiver.cpp \
     TCPConnection.cpp \
     TCPServer.cpp \
     ToProtoVisitor.cpp \
+    ProtoSizeVisitor.cpp \
     FromProtoVisitor.cpp \
     FromLCMVisitor.cpp \
     FromMsgPackVisitor.cpp \
@@ -111,9 +119,11 @@ for i in \
     ToLCMVisitor.cpp \
     LCMToGenericMessage.cpp \
     ToMsgPackVisitor.cpp \
+    FragmentAssembler.cpp \
     OD4Session.cpp \
     ToODVDVisitor.cpp \
     EnvelopeConverter.cpp \
+    RecFileIndex.cpp \
     Player.cpp \
     SharedMemory.cpp; do
 cat libcluon/src/$i >> tmp.headeronly/cluon-complete.cpp
@@ -176,6 +186,15 @@ cat <<EOF >> tmp.headeronly/cluon-complete.hpp
 #endif
 EOF
 
+cat <<EOF >> tmp.headeronly/cluon-complete.hpp
+#ifdef HAVE_CLUON_REC2IDX
+EOF
+cat libcluon/tools/cluon-rec2idx.hpp >> tmp.headeronly/cluon-complete.hpp
+cat libcluon/tools/cluon-rec2idx.cpp >> tmp.headeronly/cluon-complete.hpp
+cat <<EOF >> tmp.headeronly/cluon-complete.hpp
+#endif
+EOF
+
 cat tmp.headeronly/cluon-complete.hpp | sed -e 's/^#include\ \"cluon\//\/\/#include\ \"cluon\//g' > tmp.headeronly/cluon-complete.hpp.tmp && mv tmp.headeronly/cluon-complete.hpp.tmp tmp.headeronly/cluon-complete.hpp
 cat tmp.headeronly/cluon-complete.hpp | sed -e 's/^#include\ \"cpp-peglib\//\/\/#include\ \"cpp-peglib\//g' > tmp.headeronly/cluon-complete.hpp.tmp && mv tmp.headeronly/cluon-complete.hpp.tmp tmp.headeronly/cluon-complete.hpp
 cat tmp.headeronly/cluon-complete.hpp | sed -e 's/^#include\ \"argh\//\/\/#include\ \"argh\//g' > tmp.headeronly/cluon-complete.hpp.tmp && mv tmp.headeronly/cluon-complete.hpp.tmp tmp.headeronly/cluon-complete.hpp
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2017-2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_BUFFERPOOL_HPP
+#define CLUON_BUFFERPOOL_HPP
+
+#include "cluon/cluon.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace cluon {
+
+class BufferPool;
+
+/**
+This class is a move-only handle to a fixed-size slab that is borrowed from a
+cluon::BufferPool. The slab is returned to its pool as soon as the handle is
+destroyed or release() is called; thus, received bytes can be handed over to
+a consumer without copying them into a std::string first.
+*/
+class LIBCLUON_API PooledBuffer {
+   private:
+    friend class BufferPool;
+
+    PooledBuffer(const PooledBuffer &) = delete;
+    PooledBuffer &operator=(const PooledBuffer &) = delete;
+
+    /**
+     * Constructor that is only accessible to BufferPool.
+     *
+     * @param pool BufferPool that owns the slab.
+     * @param data Pointer to the slab.
+     * @param slab Index of the slab in the pool.
+     * @param capacity Size of the slab.
+     */
+    PooledBuffer(std::shared_ptr<BufferPool> pool, char *data, uint32_t slab, std::size_t capacity) noexcept;
+
+   public:
+    PooledBuffer() = default;
+    PooledBuffer(PooledBuffer &&other) noexcept;
+    PooledBuffer &operator=(PooledBuffer &&other) noexcept;
+    ~PooledBuffer() noexcept;
+
+    /**
+     * @return Pointer to the first byte of the slab or nullptr if this handle is empty.
+     */
+    char *data() noexcept;
+    const char *data() const noexcept;
+
+    /**
+     * @return Number of valid bytes in the slab.
+     */
+    std::size_t size() const noexcept;
+
+    /**
+     * @return Maximum number of bytes that the slab can hold.
+     */
+    std::size_t capacity() const noexcept;
+
+    /**
+     * This method sets the number of valid bytes; it is limited by capacity().
+     *
+     * @param size Number of valid bytes.
+     */
+    void resize(std::size_t size) noexcept;
+
+    /**
+     * This method returns the slab to its pool; the handle is empty afterwards.
+     */
+    void release() noexcept;
+
+   private:
+    std::shared_ptr<BufferPool> m_pool{nullptr};
+    std::unique_ptr<char[]> m_overflow{nullptr};
+    char *m_data{nullptr};
+    uint32_t m_slab{0};
+    std::size_t m_capacity{0};
+    std::size_t m_size{0};
+};
+
+/**
+This class manages a pre-allocated set of equally sized slabs that are handed
+out as cluon::PooledBuffer and recycled afterwards. A BufferPool must be
+created as std::shared_ptr as every PooledBuffer keeps its pool alive:
+
+\code{.cpp}
+auto pool = std::make_shared<cluon::BufferPool>(128, 65507);
+cluon::PooledBuffer buffer = pool->acquire();
+\endcode
+
+When all slabs are in use, acquire() falls back to an individual heap
+allocation so that no data is lost; such fallbacks are counted.
+*/
+class LIBCLUON_API BufferPool : public std::enable_shared_from_this<BufferPool> {
+   private:
+    friend class PooledBuffer;
+
+    BufferPool(const BufferPool &) = delete;
+    BufferPool(BufferPool &&)      = delete;
+    BufferPool &operator=(const BufferPool &) = delete;
+    BufferPool &operator=(BufferPool &&) = delete;
+
+   public:
+    /**
+     * Constructor.
+     *
+     * @param numberOfSlabs Number of slabs to pre-allocate.
+     * @param slabSize Size in bytes per slab.
+     */
+    BufferPool(uint32_t numberOfSlabs, std::size_t slabSize) noexcept;
+    ~BufferPool() = default;
+
+    /**
+     * @return A PooledBuffer borrowing a free slab.
+     */
+    PooledBuffer acquire() noexcept;
+
+    /**
+     * @return Size in bytes per slab.
+     */
+    std::size_t slabSize() const noexcept;
+
+    /**
+     * @return Number of slabs that are currently not borrowed.
+     */
+    uint32_t numberOfAvailableSlabs() const noexcept;
+
+    /**
+     * @return Number of times that acquire() had to fall back to the heap.
+     */
+    uint64_t numberOfOverflowAllocations() const noexcept;
+
+   private:
+    void release(uint32_t slab) noexcept;
+
+   private:
+    std::size_t m_slabSize;
+    std::unique_ptr<char[]> m_slabs;
+
+    mutable std::mutex m_freeSlabsMutex{};
+    std::vector<uint32_t> m_freeSlabs{};
+
+    std::atomic<uint64_t> m_numberOfOverflowAllocations{0};
+};
+} // namespace cluon
+
+#endif
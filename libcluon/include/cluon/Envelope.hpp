@@ -10,9 +10,13 @@
 #define CLUON_ENVELOPE_HPP
 
 #include "cluon/FromProtoVisitor.hpp"
+#include "cluon/ProtoConstants.hpp"
+#include "cluon/ProtoSizeVisitor.hpp"
 #include "cluon/ToProtoVisitor.hpp"
 #include "cluon/cluonDataStructures.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <istream>
 #include <sstream>
@@ -24,40 +28,63 @@ namespace cluon {
 
 /**
  * This method transforms a given Envelope to a string representation to be
- * sent to an OpenDaVINCI session.
+ * sent to an OpenDaVINCI session and writes it into the given buffer.
+ *
+ * The size of the encoded Envelope is determined first so that the OD4 header
+ * and the Envelope are written into the buffer at once; memory that the buffer
+ * has already allocated is reused, so that a buffer that is kept by the caller
+ * is not reallocated for Envelopes of similar size.
+ *
+ * The OD4 header stores the length of the encoded Envelope in 24 bits; thus,
+ * Envelopes larger than 16,777,215 bytes (0xFFFFFF) cannot be represented and
+ * the buffer is left empty.
  *
  * @param envelope Envelope with payload to be sent.
- * @return String representation of the Envelope to be sent to OpenDaVINCI v4.
+ * @param dataToSend Buffer that is overwritten with the representation to be sent to OpenDaVINCI v4.
  */
-inline std::string serializeEnvelope(cluon::data::Envelope &&envelope) noexcept {
-    std::string dataToSend;
-    {
-        std::stringstream sstr;
-
-        cluon::ToProtoVisitor protoEncoder;
-        envelope.accept(protoEncoder);
-
-        const std::string tmp{protoEncoder.encodedData()};
-        uint32_t length{static_cast<uint32_t>(tmp.size())};
-        length <<= 8;
-        length = htole32(length);
+inline void serializeEnvelope(cluon::data::Envelope &envelope, std::string &dataToSend) noexcept {
+    constexpr std::size_t OD4_HEADER_SIZE{5};
+    constexpr std::size_t MAX_LENGTH{0xFFFFFF}; // LEN0 LEN1 LEN2
+    try {
+        cluon::ProtoSizeVisitor protoSize;
+        envelope.accept(protoSize);
+        const std::size_t LENGTH{protoSize.encodedSize()};
+        dataToSend.clear();
+        if (MAX_LENGTH < LENGTH) {
+            return;
+        }
+        dataToSend.reserve(OD4_HEADER_SIZE + LENGTH);
 
-        // Add OD4 header.
+        // Add OD4 header: 0x0D 0xA4 LEN0 LEN1 LEN2 (little Endian).
         constexpr unsigned char OD4_HEADER_BYTE0 = 0x0D;
         constexpr unsigned char OD4_HEADER_BYTE1 = 0xA4;
-        sstr.put(static_cast<char>(OD4_HEADER_BYTE0));
-        auto posByte1 = sstr.tellp();
-        sstr.write(reinterpret_cast<char *>(&length), static_cast<std::streamsize>(sizeof(uint32_t)));
-        auto posByte5 = sstr.tellp();
-        sstr.seekp(posByte1);
-        sstr.put(static_cast<char>(OD4_HEADER_BYTE1));
-        sstr.seekp(posByte5);
-
-        // Write payload.
-        sstr.write(tmp.data(), static_cast<std::streamsize>(tmp.size()));
-
-        dataToSend = sstr.str();
-    }
+        dataToSend.push_back(static_cast<char>(OD4_HEADER_BYTE0));
+        dataToSend.push_back(static_cast<char>(OD4_HEADER_BYTE1));
+        dataToSend.push_back(static_cast<char>(LENGTH & 0xFF));
+        dataToSend.push_back(static_cast<char>((LENGTH >> 8) & 0xFF));
+        dataToSend.push_back(static_cast<char>((LENGTH >> 16) & 0xFF));
+
+        // Write payload right after the OD4 header into the same buffer.
+        cluon::ToProtoVisitor protoEncoder{std::move(dataToSend)};
+        envelope.accept(protoEncoder);
+        dataToSend = protoEncoder.releaseEncodedData();
+    } catch (...) {} // LCOV_EXCL_LINE
+}
+
+/**
+ * This method transforms a given Envelope to a string representation to be
+ * sent to an OpenDaVINCI session.
+ *
+ * The OD4 header and the Envelope are written into one buffer that is
+ * allocated only once.
+ *
+ * @param envelope Envelope with payload to be sent.
+ * @return String representation of the Envelope to be sent to OpenDaVINCI v4
+ *         or an empty string if the Envelope exceeds 16,777,215 bytes.
+ */
+inline std::string serializeEnvelope(cluon::data::Envelope &&envelope) noexcept {
+    std::string dataToSend;
+    serializeEnvelope(envelope, dataToSend);
     return dataToSend;
 }
 
@@ -109,28 +136,253 @@ inline std::pair<bool, cluon::data::Envelope> extractEnvelope(std::istream &in)
                 retVal = static_cast<int32_t>(LENGTH) == in.gcount();
 #endif
                 if (retVal) {
-                    std::stringstream sstr(std::string(buffer.begin(), buffer.begin() + static_cast<std::streamsize>(LENGTH)));
                     cluon::FromProtoVisitor protoDecoder;
-                    protoDecoder.decodeFrom(sstr, env);
+                    protoDecoder.decodeFrom(buffer.data(), LENGTH, env);
                 }
             }
         }
     }
-    return std::make_pair(retVal, env);
+    return std::make_pair(retVal, std::move(env));
 }
 
 /**
+ * This method extracts an Envelope from the given bytes in format:
+ *
+ *    0x0D 0xA4 LEN0 LEN1 LEN2 Proto-encoded cluon::data::Envelope
+ *
+ * The Envelope is decoded directly from the given bytes without copying them.
+ *
+ * @param data Pointer to the bytes.
+ * @param length Number of bytes.
+ * @return pair(true, cluon::data::Envelope) if the bytes contain a complete Envelope.
+ */
+inline std::pair<bool, cluon::data::Envelope> extractEnvelope(const char *data, std::size_t length) noexcept {
+    constexpr std::size_t OD4_HEADER_SIZE{5};
+    bool retVal{false};
+    cluon::data::Envelope env;
+    if ((nullptr != data) && (OD4_HEADER_SIZE <= length)) {
+        const uint8_t *bytes{reinterpret_cast<const uint8_t *>(data)}; // NOLINT
+        if ((0x0D == bytes[0]) && (0xA4 == bytes[1])) {
+            const std::size_t LENGTH{static_cast<std::size_t>(bytes[2]) | (static_cast<std::size_t>(bytes[3]) << 8) | (static_cast<std::size_t>(bytes[4]) << 16)};
+            retVal = (OD4_HEADER_SIZE + LENGTH <= length);
+            if (retVal) {
+                cluon::FromProtoVisitor protoDecoder;
+                protoDecoder.decodeFrom(data + OD4_HEADER_SIZE, LENGTH, env);
+            }
+        }
+    }
+    return std::make_pair(retVal, std::move(env));
+}
+
+/**
+ * This method reads only the OD4 header and the field dataType from the
+ * given bytes without decoding the complete Envelope; thus, Envelopes that
+ * are not of interest can be discarded without allocating any memory.
+ * The bytes are expected in format:
+ *
+ *    0x0D 0xA4 LEN0 LEN1 LEN2 0x08 dataType (ZigZag-encoded VarInt) ...
+ *
+ * Fragments of an Envelope (0x0D 0xA5 ..., see cluon::FragmentAssembler)
+ * carry the dataType at the same position and are accepted as well.
+ *
+ * @param data Pointer to the bytes.
+ * @param length Number of bytes.
+ * @return pair(true, dataType) if the OD4 header is directly followed by the field dataType.
+ */
+inline std::pair<bool, int32_t> peekEnvelopeDataType(const char *data, std::size_t length) noexcept {
+    constexpr std::size_t OD4_HEADER_SIZE{5};
+    constexpr uint8_t DATATYPE_KEY{(1 << 3) | static_cast<uint8_t>(ProtoConstants::VARINT)};
+    constexpr std::size_t MAX_VARINT_SIZE{10};
+
+    if ((nullptr != data) && (OD4_HEADER_SIZE + 1 < length)) {
+        const uint8_t *bytes{reinterpret_cast<const uint8_t *>(data)}; // NOLINT
+        if ((0x0D == bytes[0]) && ((0xA4 == bytes[1]) || (0xA5 == bytes[1])) && (DATATYPE_KEY == bytes[OD4_HEADER_SIZE])) {
+            uint64_t value{0};
+            const std::size_t END{(length < OD4_HEADER_SIZE + 1 + MAX_VARINT_SIZE) ? length : (OD4_HEADER_SIZE + 1 + MAX_VARINT_SIZE)};
+            for (std::size_t i{OD4_HEADER_SIZE + 1}; i < END; i++) {
+                value |= static_cast<uint64_t>(bytes[i] & 0x7F) << (7 * (i - OD4_HEADER_SIZE - 1));
+                if (0 == (bytes[i] & 0x80)) {
+                    const uint32_t ZIGZAG{static_cast<uint32_t>(value)};
+                    return std::make_pair(true, static_cast<int32_t>((ZIGZAG >> 1) ^ -(ZIGZAG & 1)));
+                }
+            }
+        }
+    }
+    return std::make_pair(false, 0);
+}
+
+/**
+ * Meta information about an Envelope in its wire format as determined by
+ * cluon::scanEnvelope.
+ */
+class ScannedEnvelope {
+   public:
+    int32_t m_dataType{0};
+    uint32_t m_senderStamp{0};
+    cluon::data::TimeStamp m_sampleTimeStamp{};
+    // Number of bytes of the Envelope including its OD4 header.
+    std::size_t m_length{0};
+    // Position and number of bytes of the field serializedData relative to the OD4 header.
+    std::size_t m_serializedDataOffset{0};
+    std::size_t m_serializedDataLength{0};
+};
+
+/**
+ * This method reads the OD4 header and walks through the top-level fields of
+ * the Envelope that follows in the given bytes to extract dataType,
+ * senderStamp, and sampleTimeStamp; the field serializedData is skipped by
+ * its length and neither decoded nor copied. The bytes are expected in format:
+ *
+ *    0x0D 0xA4 LEN0 LEN1 LEN2 Proto-encoded cluon::data::Envelope
+ *
+ * @param data Pointer to the bytes.
+ * @param length Number of bytes.
+ * @return pair(true, ScannedEnvelope) if the bytes start with a complete and well-formed Envelope.
+ */
+inline std::pair<bool, ScannedEnvelope> scanEnvelope(const char *data, std::size_t length) noexcept {
+    constexpr std::size_t OD4_HEADER_SIZE{5};
+    constexpr uint64_t DATATYPE_KEY{(1 << 3) | static_cast<uint8_t>(ProtoConstants::VARINT)};
+    constexpr uint64_t SERIALIZEDDATA_KEY{(2 << 3) | static_cast<uint8_t>(ProtoConstants::LENGTH_DELIMITED)};
+    constexpr uint64_t SAMPLETIMESTAMP_KEY{(5 << 3) | static_cast<uint8_t>(ProtoConstants::LENGTH_DELIMITED)};
+    constexpr uint64_t SENDERSTAMP_KEY{(6 << 3) | static_cast<uint8_t>(ProtoConstants::VARINT)};
+    constexpr uint64_t SECONDS_KEY{(1 << 3) | static_cast<uint8_t>(ProtoConstants::VARINT)};
+    constexpr uint64_t MICROSECONDS_KEY{(2 << 3) | static_cast<uint8_t>(ProtoConstants::VARINT)};
+
+    ScannedEnvelope scanned;
+    if ((nullptr == data) || (OD4_HEADER_SIZE > length)) {
+        return std::make_pair(false, scanned);
+    }
+    const uint8_t *bytes{reinterpret_cast<const uint8_t *>(data)}; // NOLINT
+    if ((0x0D != bytes[0]) || (0xA4 != bytes[1])) {
+        return std::make_pair(false, scanned);
+    }
+    const std::size_t LENGTH{static_cast<std::size_t>(bytes[2]) | (static_cast<std::size_t>(bytes[3]) << 8) | (static_cast<std::size_t>(bytes[4]) << 16)};
+    if (OD4_HEADER_SIZE + LENGTH > length) {
+        return std::make_pair(false, scanned);
+    }
+    scanned.m_length = OD4_HEADER_SIZE + LENGTH;
+
+    auto readVarInt = [bytes](std::size_t &pos, std::size_t end, uint64_t &value) noexcept {
+        value = 0;
+        for (uint8_t shift{0}; (pos < end) && (shift < 64); shift = static_cast<uint8_t>(shift + 7)) {
+            const uint8_t BYTE{bytes[pos++]};
+            value |= static_cast<uint64_t>(BYTE & 0x7F) << shift;
+            if (0 == (BYTE & 0x80)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Read the next key and its value; for length-delimited fields, value is the length and start points to the bytes.
+    auto nextField = [&readVarInt](std::size_t &pos, std::size_t end, uint64_t &key, uint64_t &value, std::size_t &start) noexcept {
+        if (!readVarInt(pos, end, key)) {
+            return false;
+        }
+        const uint8_t WIRE_TYPE{static_cast<uint8_t>(key & 0x7)};
+        if (static_cast<uint8_t>(ProtoConstants::VARINT) == WIRE_TYPE) {
+            return readVarInt(pos, end, value);
+        }
+        std::size_t skip{0};
+        if (static_cast<uint8_t>(ProtoConstants::FOUR_BYTES) == WIRE_TYPE) {
+            skip = sizeof(uint32_t);
+        } else if (static_cast<uint8_t>(ProtoConstants::EIGHT_BYTES) == WIRE_TYPE) {
+            skip = sizeof(uint64_t);
+        } else if (static_cast<uint8_t>(ProtoConstants::LENGTH_DELIMITED) == WIRE_TYPE) {
+            if (!readVarInt(pos, end, value) || (value > end - pos)) {
+                return false;
+            }
+            skip = static_cast<std::size_t>(value);
+        } else {
+            return false;
+        }
+        if (skip > end - pos) {
+            return false;
+        }
+        start = pos;
+        pos += skip;
+        return true;
+    };
+
+    auto fromZigZag32 = [](uint64_t v) noexcept {
+        const uint32_t ZIGZAG{static_cast<uint32_t>(v)};
+        return static_cast<int32_t>((ZIGZAG >> 1) ^ -(ZIGZAG & 1));
+    };
+
+    std::size_t pos{OD4_HEADER_SIZE};
+    uint64_t key{0};
+    uint64_t value{0};
+    std::size_t start{0};
+    while (pos < scanned.m_length) {
+        if (!nextField(pos, scanned.m_length, key, value, start)) {
+            return std::make_pair(false, scanned);
+        }
+        if (DATATYPE_KEY == key) {
+            scanned.m_dataType = fromZigZag32(value);
+        } else if (SERIALIZEDDATA_KEY == key) {
+            scanned.m_serializedDataOffset = start;
+            scanned.m_serializedDataLength = static_cast<std::size_t>(value);
+        } else if (SENDERSTAMP_KEY == key) {
+            scanned.m_senderStamp = static_cast<uint32_t>(value);
+        } else if (SAMPLETIMESTAMP_KEY == key) {
+            const std::size_t END{start + static_cast<std::size_t>(value)};
+            std::size_t nestedPos{start};
+            std::size_t nestedStart{0};
+            while (nestedPos < END) {
+                if (!nextField(nestedPos, END, key, value, nestedStart)) {
+                    return std::make_pair(false, scanned);
+                }
+                if (SECONDS_KEY == key) {
+                    scanned.m_sampleTimeStamp.seconds(fromZigZag32(value));
+                } else if (MICROSECONDS_KEY == key) {
+                    scanned.m_sampleTimeStamp.microseconds(fromZigZag32(value));
+                }
+            }
+        }
+    }
+    return std::make_pair(true, scanned);
+}
+
+/**
+ * This method reads the bytes of the next Envelope including its OD4 header
+ * from the given istream without decoding them; the bytes can be examined
+ * with cluon::scanEnvelope and written as they are.
+ *
+ * @param in Stream to read from.
+ * @param data Buffer to be overwritten with the bytes; its memory is reused.
+ * @return true if a complete Envelope was read.
+ */
+inline bool extractEnvelopeData(std::istream &in, std::string &data) noexcept {
+    constexpr std::size_t OD4_HEADER_SIZE{5};
+    bool retVal{false};
+    try {
+        data.resize(OD4_HEADER_SIZE);
+        in.read(&data[0], static_cast<std::streamsize>(OD4_HEADER_SIZE));
+        if ((static_cast<std::streamsize>(OD4_HEADER_SIZE) == in.gcount()) && (0x0D == static_cast<uint8_t>(data[0]))
+            && (0xA4 == static_cast<uint8_t>(data[1]))) {
+            const std::size_t LENGTH{static_cast<std::size_t>(static_cast<uint8_t>(data[2])) | (static_cast<std::size_t>(static_cast<uint8_t>(data[3])) << 8)
+                                     | (static_cast<std::size_t>(static_cast<uint8_t>(data[4])) << 16)};
+            data.resize(OD4_HEADER_SIZE + LENGTH);
+            in.read(&data[OD4_HEADER_SIZE], static_cast<std::streamsize>(LENGTH));
+            retVal = (static_cast<std::streamsize>(LENGTH) == in.gcount());
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return retVal;
+}
+
+/**
+ * The payload is decoded directly into the fields of the returned message
+ * without any intermediate representation; fields that are missing or arrive
+ * with a wire type not matching their declared type keep their default values.
+ *
  * @return Extract a given Envelope's payload into the desired type.
  */
 template <typename T>
 inline T extractMessage(cluon::data::Envelope &&envelope) noexcept {
-    cluon::FromProtoVisitor decoder;
-
-    std::stringstream sstr(envelope.serializedData());
-    decoder.decodeFrom(sstr);
-
     T msg;
-    msg.accept(decoder);
+
+    cluon::FromProtoVisitor decoder;
+    decoder.decodeFrom(envelope.serializedData().data(), envelope.serializedData().size(), msg);
 
     return msg;
 }
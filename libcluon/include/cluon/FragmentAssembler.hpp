@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2017-2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_FRAGMENTASSEMBLER_HPP
+#define CLUON_FRAGMENTASSEMBLER_HPP
+
+#include "cluon/cluon.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cluon {
+
+/**
+ * Counters of a FragmentAssembler.
+ */
+struct FragmentAssemblerStatistics {
+    uint64_t numberOfReassembledMessages{0}; // Messages for which all fragments were received.
+    uint64_t numberOfEvictedMessages{0};     // Incomplete messages that were discarded due to timeout or memory limit.
+    uint64_t numberOfIncompleteMessages{0};  // Messages currently waiting for missing fragments.
+    uint64_t numberOfBufferedBytes{0};       // Memory currently reserved for incomplete messages.
+};
+
+/**
+This class splits serialized Envelopes that do not fit into one UDP datagram
+into fragments and puts received fragments back together.
+
+A fragment starts with the same five bytes and field dataType as an Envelope
+so that it can be filtered by dataType before it is reassembled:
+
+    0x0D 0xA5 LEN0 LEN1 LEN2 0x08 dataType (ZigZag-encoded VarInt)
+    sequenceNumber (uint32) fragmentIndex (uint16) numberOfFragments (uint16)
+    totalLength (uint32) payload
+
+All integers are little Endian; LEN0 LEN1 LEN2 is the number of bytes
+following the first five. All fragments of a message except the last one
+carry the same number of payload bytes.
+
+Incomplete messages are kept per sender and sequence number until all
+fragments have arrived; messages that exceed the timeout or do not fit into
+the memory limit anymore are discarded, oldest first:
+
+\code{.cpp}
+std::vector<std::string> fragments{cluon::FragmentAssembler::fragment(serializedEnvelope, dataType, 1, 65507)};
+
+cluon::FragmentAssembler assembler;
+for (auto &f : fragments) {
+    auto retVal = assembler.add(f.data(), f.size(), 0, std::chrono::steady_clock::now());
+    if (retVal.first) {
+        // retVal.second contains the serialized Envelope.
+    }
+}
+\endcode
+*/
+class LIBCLUON_API FragmentAssembler {
+   private:
+    FragmentAssembler(const FragmentAssembler &) = delete;
+    FragmentAssembler(FragmentAssembler &&)      = delete;
+    FragmentAssembler &operator=(const FragmentAssembler &) = delete;
+    FragmentAssembler &operator=(FragmentAssembler &&) = delete;
+
+   public:
+    /**
+     * Constructor.
+     *
+     * @param maxNumberOfBufferedBytes Memory limit for all incomplete messages.
+     * @param timeout Time after the first fragment of a message until an incomplete message is discarded.
+     */
+    FragmentAssembler(uint32_t maxNumberOfBufferedBytes = 64 * 1024 * 1024,
+                      std::chrono::milliseconds timeout = std::chrono::milliseconds(1000)) noexcept;
+
+    /**
+     * @param data Pointer to the bytes.
+     * @param length Number of bytes.
+     * @return true if the given bytes start with a fragment header.
+     */
+    static bool isFragment(const char *data, std::size_t length) noexcept;
+
+    /**
+     * This method splits a serialized Envelope into fragments.
+     *
+     * @param serializedEnvelope Envelope in format 0x0D 0xA4 LEN0 LEN1 LEN2 ...
+     * @param dataType dataType of the Envelope to be repeated in every fragment.
+     * @param sequenceNumber Number to identify the fragments of this Envelope.
+     * @param maxDatagramSize Maximum size of one fragment including its header.
+     * @return Fragments or an empty vector if the Envelope cannot be fragmented,
+     *         for instance when it exceeds the 24-bit length of the OD4 header.
+     */
+    static std::vector<std::string> fragment(const std::string &serializedEnvelope,
+                                             int32_t dataType,
+                                             uint32_t sequenceNumber,
+                                             std::size_t maxDatagramSize) noexcept;
+
+    /**
+     * This method adds a received fragment.
+     *
+     * @param data Pointer to the fragment.
+     * @param length Number of bytes of the fragment.
+     * @param sender Identifier of the sender, for instance address and port.
+     * @param now Time point when the fragment was received.
+     * @return pair(true, serialized Envelope) if this fragment completed a message.
+     */
+    std::pair<bool, std::string> add(const char *data, std::size_t length, uint64_t sender, std::chrono::steady_clock::time_point now) noexcept;
+
+    /**
+     * @return Counters of this FragmentAssembler.
+     */
+    FragmentAssemblerStatistics statistics() const noexcept;
+
+   private:
+    /**
+     * This method discards incomplete messages that are too old or, oldest
+     * first, until the given number of bytes fits; m_partialMessagesMutex must be held.
+     *
+     * @param now Current time point.
+     * @param numberOfBytesNeeded Number of bytes that need to fit into the memory limit.
+     */
+    void evict(std::chrono::steady_clock::time_point now, uint64_t numberOfBytesNeeded) noexcept;
+
+   private:
+    class PartialMessage {
+       public:
+        std::string m_data{};
+        std::vector<bool> m_receivedFragments{};
+        uint16_t m_numberOfMissingFragments{0};
+        std::chrono::steady_clock::time_point m_firstFragmentReceived{};
+    };
+
+    const uint32_t m_maxNumberOfBufferedBytes;
+    const std::chrono::milliseconds m_timeout;
+
+    mutable std::mutex m_partialMessagesMutex{};
+    std::map<std::pair<uint64_t, uint32_t>, PartialMessage> m_partialMessages{};
+    FragmentAssemblerStatistics m_statistics{};
+};
+} // namespace cluon
+
+#endif
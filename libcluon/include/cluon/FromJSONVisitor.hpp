@@ -14,6 +14,7 @@
 #include "cluon/cluon.hpp"
 
 #include <cstdint>
+#include <functional>
 #include <istream>
 #include <map>
 #include <string>
@@ -54,7 +55,7 @@ class LIBCLUON_API FromJSONVisitor {
      *
      * @param preset Pre-filled key/value map to handle nested fields.
      */
-    FromJSONVisitor(std::map<std::string, FromJSONVisitor::JSONKeyValue> &preset) noexcept;
+    FromJSONVisitor(std::map<std::string, FromJSONVisitor::JSONKeyValue, std::less<>> &preset) noexcept;
 
    public:
     FromJSONVisitor() noexcept;
@@ -72,32 +73,32 @@ class LIBCLUON_API FromJSONVisitor {
     // The following methods are provided to allow an instance of this class to
     // be used as visitor for an instance with the method signature void accept<T>(T&);
 
-    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept;
+    void preVisit(int32_t id, const char *shortName, const char *longName) noexcept;
     void postVisit() noexcept;
 
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept;
 
     template <typename T>
-    void visit(uint32_t &id, std::string &&typeName, std::string &&name, T &value) noexcept {
+    void visit(uint32_t &id, const char *typeName, const char *name, T &value) noexcept {
         (void)id;
         (void)typeName;
 
         if (0 < m_keyValues.count(name)) {
             try {
-                std::map<std::string, FromJSONVisitor::JSONKeyValue> v
-                    = linb::any_cast<std::map<std::string, FromJSONVisitor::JSONKeyValue>>(m_keyValues[name].m_value);
+                std::map<std::string, FromJSONVisitor::JSONKeyValue, std::less<>> v
+                    = linb::any_cast<std::map<std::string, FromJSONVisitor::JSONKeyValue, std::less<>>>(m_keyValues.find(name)->second.m_value);
                 cluon::FromJSONVisitor nestedJSONDecoder(v);
                 value.accept(nestedJSONDecoder);
             } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
@@ -105,6 +106,17 @@ class LIBCLUON_API FromJSONVisitor {
         }
     }
 
+    // The following methods forward the names to the methods above for
+    // messages that pass them as std::string.
+    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+        preVisit(id, shortName.c_str(), longName.c_str());
+    }
+
+    template <typename T>
+    void visit(uint32_t id, std::string &&typeName, std::string &&name, T &value) noexcept {
+        visit(id, typeName.c_str(), name.c_str(), value);
+    }
+
    public:
     /**
      * This method returns the base64-decoded representation for the given input.
@@ -115,11 +127,11 @@ class LIBCLUON_API FromJSONVisitor {
     static std::string decodeBase64(const std::string &input) noexcept;
 
    private:
-    std::map<std::string, FromJSONVisitor::JSONKeyValue> readKeyValues(std::string &input) noexcept;
+    std::map<std::string, FromJSONVisitor::JSONKeyValue, std::less<>> readKeyValues(std::string &input) noexcept;
 
    private:
-    std::map<std::string, FromJSONVisitor::JSONKeyValue> m_data{};
-    std::map<std::string, FromJSONVisitor::JSONKeyValue> &m_keyValues;
+    std::map<std::string, FromJSONVisitor::JSONKeyValue, std::less<>> m_data{};
+    std::map<std::string, FromJSONVisitor::JSONKeyValue, std::less<>> &m_keyValues;
 };
 } // namespace cluon
 
@@ -45,30 +45,30 @@ class LIBCLUON_API FromLCMVisitor {
     // The following methods are provided to allow an instance of this class to
     // be used as visitor for an instance with the method signature void accept<T>(T&);
 
-    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept;
+    void preVisit(int32_t id, const char *shortName, const char *longName) noexcept;
     void postVisit() noexcept;
 
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept;
 
     template <typename T>
-    void visit(uint32_t &id, std::string &&typeName, std::string &&name, T &value) noexcept {
+    void visit(uint32_t &id, const char *typeName, const char *name, T &value) noexcept {
         (void)id;
         (void)typeName;
         // No hash for the type but for name and dimension.
         calculateHash(name);
-        calculateHash(0);
+        calculateHash(static_cast<char>(0));
 
         cluon::FromLCMVisitor nestedLCMDecoder(m_buffer);
         value.accept(nestedLCMDecoder);
@@ -76,10 +76,21 @@ class LIBCLUON_API FromLCMVisitor {
         m_hashes.push_back(nestedLCMDecoder.hash());
     }
 
+    // The following methods forward the names to the methods above for
+    // messages that pass them as std::string.
+    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+        preVisit(id, shortName.c_str(), longName.c_str());
+    }
+
+    template <typename T>
+    void visit(uint32_t id, std::string &&typeName, std::string &&name, T &value) noexcept {
+        visit(id, typeName.c_str(), name.c_str(), value);
+    }
+
    private:
     int64_t hash() const noexcept;
     void calculateHash(char c) noexcept;
-    void calculateHash(const std::string &s) noexcept;
+    void calculateHash(const char *s) noexcept;
 
    private:
     int64_t m_calculatedHash{0x12345678};
@@ -16,14 +16,24 @@
 #include <cstdint>
 #include <cstddef>
 #include <array>
-#include <sstream>
+#include <istream>
 #include <string>
 #include <unordered_map>
-#include <vector>
 
 namespace cluon {
 /**
 This class decodes a given message from Proto format.
+
+Bytes that are already in memory can be decoded directly from a pointer and
+a length without wrapping them into a std::istream; when a message is passed
+as well, the decoded values are injected directly into its fields and nested
+messages are decoded in place:
+
+\code{.cpp}
+MyMessage msg;
+cluon::FromProtoVisitor protoDecoder;
+protoDecoder.decodeFrom(data.data(), data.size(), msg);
+\endcode
 */
 class LIBCLUON_API FromProtoVisitor {
    private:
@@ -45,48 +55,68 @@ class LIBCLUON_API FromProtoVisitor {
      */
     void decodeFrom(std::istream &in) noexcept;
 
+    /**
+     * This method decodes the given bytes into Proto.
+     *
+     * @param data Pointer to the bytes to decode.
+     * @param length Number of bytes to decode.
+     */
+    void decodeFrom(const char *data, std::size_t length) noexcept;
+
    public:
     // The following methods are provided to allow an instance of this class to
     // be used as visitor for an instance with the method signature void accept<T>(T&);
 
-    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept;
+    void preVisit(int32_t id, const char *shortName, const char *longName) noexcept;
     void postVisit() noexcept;
 
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept;
 
     template <typename T>
-    void visit(uint32_t &id, std::string &&typeName, std::string &&name, T &v) noexcept {
+    void visit(uint32_t &id, const char *typeName, const char *name, T &v) noexcept {
         (void)typeName;
         (void)name;
 
         if (m_callToDecodeFromWithDirectVisit) {
-            std::stringstream sstr{std::move(std::string(m_stringValue.data(), static_cast<std::size_t>(m_value)))};
-            cluon::FromProtoVisitor nestedProtoDecoder;
-            nestedProtoDecoder.decodeFrom(sstr, v);
+            // Decode the nested message in place; fields with a mismatching wire type are ignored.
+            if (ProtoConstants::LENGTH_DELIMITED == m_protoType) {
+                cluon::FromProtoVisitor nestedProtoDecoder;
+                nestedProtoDecoder.decodeFrom(m_lengthDelimitedData, static_cast<std::size_t>(m_value), v);
+            }
         }
         else if (0 < m_mapOfKeyValues.count(id)) {
-            try {
-                std::stringstream sstr{linb::any_cast<std::string>(m_mapOfKeyValues[id])};
+            const std::string *nestedData{linb::any_cast<std::string>(&m_mapOfKeyValues[id])};
+            if (nullptr != nestedData) {
                 cluon::FromProtoVisitor nestedProtoDecoder;
-                nestedProtoDecoder.decodeFrom(sstr);
+                nestedProtoDecoder.decodeFrom(nestedData->data(), nestedData->size());
                 v.accept(nestedProtoDecoder);
-            } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
             }
         }
     }
 
+    // The following methods forward the names to the methods above for
+    // messages that pass them as std::string.
+    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+        preVisit(id, shortName.c_str(), longName.c_str());
+    }
+
+    template <typename T>
+    void visit(uint32_t id, std::string &&typeName, std::string &&name, T &value) noexcept {
+        visit(id, typeName.c_str(), name.c_str(), value);
+    }
+
    public:
     /**
      * This method decodes a given istream into corresponding fields of v.
@@ -96,48 +126,24 @@ class LIBCLUON_API FromProtoVisitor {
      */
     template<typename T>
     void decodeFrom(std::istream &in, T &v) noexcept {
+        readFromStream(in);
+        decodeFrom(m_streamBuffer.data(), m_streamBuffer.size(), v);
+    }
+
+    /**
+     * This method decodes the given bytes into corresponding fields of v.
+     *
+     * @param data Pointer to the bytes to decode.
+     * @param length Number of bytes to decode.
+     * @param v Data structure to receive the decoded values.
+     */
+    template<typename T>
+    void decodeFrom(const char *data, std::size_t length, T &v) noexcept {
         m_callToDecodeFromWithDirectVisit = true;
-        while (in.good()) {
-            // First stage: Read keyFieldType (encoded as VarInt).
-            if (0 < fromVarInt(in, m_keyFieldType)) {
-                // Succeeded to read keyFieldType entry; extract information.
-                m_protoType = static_cast<ProtoConstants>(m_keyFieldType & 0x7);
-                m_fieldId = static_cast<uint32_t>(m_keyFieldType >> 3);
-                switch (m_protoType) {
-                    case ProtoConstants::VARINT:
-                    {
-                        // Directly decode VarInt value.
-                        fromVarInt(in, m_value);
-                        v.accept(m_fieldId, *this);
-                    }
-                    break;
-                    case ProtoConstants::EIGHT_BYTES:
-                    {
-                        readBytesFromStream(in, sizeof(double), m_doubleValue.buffer.data());
-                        m_doubleValue.uint64Value = le64toh(m_doubleValue.uint64Value);
-                        v.accept(m_fieldId, *this);
-                    }
-                    break;
-                    case ProtoConstants::FOUR_BYTES:
-                    {
-                        readBytesFromStream(in, sizeof(float), m_floatValue.buffer.data());
-                        m_floatValue.uint32Value = le32toh(m_floatValue.uint32Value);
-                        v.accept(m_fieldId, *this);
-                    }
-                    break;
-                    case ProtoConstants::LENGTH_DELIMITED:
-                    {
-                        fromVarInt(in, m_value);
-                        const std::size_t BYTES_TO_READ_FROM_STREAM{static_cast<std::size_t>(m_value)};
-                        if (m_stringValue.capacity() < BYTES_TO_READ_FROM_STREAM) {
-                            m_stringValue.reserve(BYTES_TO_READ_FROM_STREAM);
-                        }
-                        readBytesFromStream(in, BYTES_TO_READ_FROM_STREAM, m_stringValue.data());
-                        v.accept(m_fieldId, *this);
-                    }
-                    break;
-                }
-            }
+        const char *position{data};
+        const char *end{(nullptr == data) ? data : data + length};
+        while (decodeNextField(position, end)) {
+            v.accept(m_fieldId, *this);
         }
         m_callToDecodeFromWithDirectVisit = false;
     }
@@ -148,9 +154,32 @@ class LIBCLUON_API FromProtoVisitor {
     int32_t fromZigZag32(uint32_t v) noexcept;
     int64_t fromZigZag64(uint64_t v) noexcept;
 
-    std::size_t fromVarInt(std::istream &in, uint64_t &value) noexcept;
+    /**
+     * This method decodes a VarInt.
+     *
+     * @param position Current position; moved behind the VarInt.
+     * @param end End of the bytes to decode.
+     * @param value Decoded value.
+     * @return Number of bytes read or 0 if the VarInt is incomplete.
+     */
+    std::size_t fromVarInt(const char *&position, const char *end, uint64_t &value) noexcept;
 
-    void readBytesFromStream(std::istream &in, std::size_t bytesToReadFromStream, char *buffer) noexcept;
+    /**
+     * This method decodes the next key/value pair into m_fieldId and m_value,
+     * m_doubleValue, m_floatValue, or m_lengthDelimitedData, respectively.
+     *
+     * @param position Current position; moved behind the decoded field.
+     * @param end End of the bytes to decode.
+     * @return true if a complete field was decoded.
+     */
+    bool decodeNextField(const char *&position, const char *end) noexcept;
+
+    /**
+     * This method reads the remaining bytes from the given istream into m_streamBuffer.
+     *
+     * @param in istream to read from.
+     */
+    void readFromStream(std::istream &in) noexcept;
 
    private:
     // This Boolean flag indicates whether we consecutively decode from istream
@@ -160,6 +189,7 @@ class LIBCLUON_API FromProtoVisitor {
 
    private:
     // Fields necessary to decode from an istream.
+    std::string m_streamBuffer{};
     uint64_t m_value{0};
 
     // Union buffer for double values.
@@ -176,8 +206,8 @@ class LIBCLUON_API FromProtoVisitor {
         float floatValue{0};
     } m_floatValue;
 
-    // Buffer for strings.
-    std::vector<char> m_stringValue;
+    // Strings and nested messages point into the bytes to decode; m_value holds their length.
+    const char *m_lengthDelimitedData{nullptr};
 
     uint64_t m_keyFieldType{0};
     ProtoConstants m_protoType{ProtoConstants::VARINT};
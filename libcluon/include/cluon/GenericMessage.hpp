@@ -47,9 +47,6 @@ GenericMessage's actual values.
 \code{.cpp}
 // protoEncodedData is provided from somewhere, i.e., via network for example
 std::string protoEncodedData = <...>
-std::stringstream sstr{protoEncodedData};
-cluon::FromProtoVisitor protoDecoder;
-protoDecoder.decodeFrom(sstr);
 
 const char *messageSpecification = R"(
 message MyMessage [id = 123] {
@@ -63,8 +60,9 @@ if (cluon::MessageParser::MessageParserErrorCodes::NO_MESSAGEPARSER_ERROR == ret
     cluon::GenericMessage gm;
     auto listOfMetaMessages = retVal.first;
     gm.createFrom(listOfMetaMessages[0], listOfMetaMessages);
-    // Set values in GenericMessage from protoDecoder.
-    gm.accept(protoDecoder);
+    // Decode the values directly into the GenericMessage.
+    cluon::FromProtoVisitor protoDecoder;
+    protoDecoder.decodeFrom(protoEncodedData.data(), protoEncodedData.size(), gm);
 }
 \endcode
 
@@ -142,9 +140,6 @@ std::cout << j.json();
 \code{.cpp}
 // protoEncodedData is provided from somewhere, i.e., via network for example
 std::string protoEncodedData = <...>
-std::stringstream sstr{protoEncodedData};
-cluon::FromProtoVisitor protoDecoder;
-protoDecoder.decodeFrom(sstr);
 
 const char *messageSpecification = R"(
 message MyMessage [id = 123] {
@@ -158,8 +153,9 @@ if (cluon::MessageParser::MessageParserErrorCodes::NO_MESSAGEPARSER_ERROR == ret
     cluon::GenericMessage gm;
     auto listOfMetaMessages = retVal.first;
     gm.createFrom(listOfMetaMessages[0], listOfMetaMessages);
-    // Set values in GenericMessage from protoDecoder.
-    gm.accept(protoDecoder);
+    // Decode the values directly into the GenericMessage.
+    cluon::FromProtoVisitor protoDecoder;
+    protoDecoder.decodeFrom(protoEncodedData.data(), protoEncodedData.size(), gm);
 }
 
 cluon::ToJSONVisitor j;
@@ -182,25 +178,25 @@ class LIBCLUON_API GenericMessage {
        public:
         // The following methods are provided to allow an instance of this class to
         // be used as visitor for an instance with the method signature void accept<T>(T&);
-        void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept;
+        void preVisit(int32_t id, const char *shortName, const char *longName) noexcept;
         void postVisit() noexcept;
 
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept;
-        void visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept;
+        void visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept;
 
         template <typename T>
-        void visit(uint32_t &id, std::string &&typeName, std::string &&name, T &value) noexcept {
+        void visit(uint32_t &id, const char *typeName, const char *name, T &value) noexcept {
             cluon::MetaMessage::MetaField mf;
             mf.fieldIdentifier(id).fieldDataType(cluon::MetaMessage::MetaField::MESSAGE_T).fieldDataTypeName(typeName).fieldName(name);
 
@@ -211,6 +207,17 @@ class LIBCLUON_API GenericMessage {
             m_metaMessage.add(std::move(mf));
         }
 
+        // The following methods forward the names to the methods above for
+        // messages that pass them as std::string.
+        void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+            preVisit(id, shortName.c_str(), longName.c_str());
+        }
+
+        template <typename T>
+        void visit(uint32_t id, std::string &&typeName, std::string &&name, T &value) noexcept {
+            visit(id, typeName.c_str(), name.c_str(), value);
+        }
+
        public:
         /**
          * @return MetaMessage for this GenericMessage.
@@ -269,25 +276,25 @@ class LIBCLUON_API GenericMessage {
    public:
     // The following methods are provided to allow an instance of this class to
     // be used as visitor for an instance with the method signature void accept<T>(T&);
-    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept;
+    void preVisit(int32_t id, const char *shortName, const char *longName) noexcept;
     void postVisit() noexcept;
 
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept;
 
     template <typename T>
-    void visit(uint32_t &id, std::string &&typeName, std::string &&name, T &value) noexcept {
+    void visit(uint32_t &id, const char *typeName, const char *name, T &value) noexcept {
         (void)typeName;
         (void)name;
         if (0 < m_intermediateDataRepresentation.count(id)) {
@@ -299,6 +306,17 @@ class LIBCLUON_API GenericMessage {
         }
     }
 
+    // The following methods forward the names to the methods above for
+    // messages that pass them as std::string.
+    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+        preVisit(id, shortName.c_str(), longName.c_str());
+    }
+
+    template <typename T>
+    void visit(uint32_t id, std::string &&typeName, std::string &&name, T &value) noexcept {
+        visit(id, typeName.c_str(), name.c_str(), value);
+    }
+
    public:
     /**
      * This method allows other instances to visit this GenericMessage for
@@ -342,86 +360,86 @@ class LIBCLUON_API GenericMessage {
             if (f.fieldDataType() == MetaMessage::MetaField::BOOL_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<bool &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (f.fieldDataType() == MetaMessage::MetaField::CHAR_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<char &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (f.fieldDataType() == MetaMessage::MetaField::UINT8_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<uint8_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (f.fieldDataType() == MetaMessage::MetaField::INT8_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<int8_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (f.fieldDataType() == MetaMessage::MetaField::UINT16_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<uint16_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (f.fieldDataType() == MetaMessage::MetaField::INT16_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<int16_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (f.fieldDataType() == MetaMessage::MetaField::UINT32_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<uint32_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (f.fieldDataType() == MetaMessage::MetaField::INT32_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<int32_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (f.fieldDataType() == MetaMessage::MetaField::UINT64_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<uint64_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (f.fieldDataType() == MetaMessage::MetaField::INT64_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<int64_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (f.fieldDataType() == MetaMessage::MetaField::FLOAT_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<float &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (f.fieldDataType() == MetaMessage::MetaField::DOUBLE_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<double &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (((f.fieldDataType() == MetaMessage::MetaField::STRING_T) || (f.fieldDataType() == MetaMessage::MetaField::BYTES_T))
                        && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<std::string &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             } else if (f.fieldDataType() == MetaMessage::MetaField::MESSAGE_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                 try {
                     auto &v = linb::any_cast<cluon::GenericMessage &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                    doTripletForwardVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, _preVisit, _visit, _postVisit);
+                    doTripletForwardVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, _preVisit, _visit, _postVisit);
                 } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                 }
             }
@@ -440,86 +458,86 @@ class LIBCLUON_API GenericMessage {
                 if (f.fieldDataType() == MetaMessage::MetaField::BOOL_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<bool &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (f.fieldDataType() == MetaMessage::MetaField::CHAR_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<char &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (f.fieldDataType() == MetaMessage::MetaField::UINT8_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<uint8_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (f.fieldDataType() == MetaMessage::MetaField::INT8_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<int8_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (f.fieldDataType() == MetaMessage::MetaField::UINT16_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<uint16_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (f.fieldDataType() == MetaMessage::MetaField::INT16_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<int16_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (f.fieldDataType() == MetaMessage::MetaField::UINT32_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<uint32_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (f.fieldDataType() == MetaMessage::MetaField::INT32_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<int32_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (f.fieldDataType() == MetaMessage::MetaField::UINT64_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<uint64_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (f.fieldDataType() == MetaMessage::MetaField::INT64_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<int64_t &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (f.fieldDataType() == MetaMessage::MetaField::FLOAT_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<float &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (f.fieldDataType() == MetaMessage::MetaField::DOUBLE_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<double &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (((f.fieldDataType() == MetaMessage::MetaField::STRING_T) || (f.fieldDataType() == MetaMessage::MetaField::BYTES_T))
                            && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<std::string &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 } else if (f.fieldDataType() == MetaMessage::MetaField::MESSAGE_T && (0 < m_intermediateDataRepresentation.count(f.fieldIdentifier()))) {
                     try {
                         auto &v = linb::any_cast<cluon::GenericMessage &>(m_intermediateDataRepresentation[f.fieldIdentifier()]);
-                        doVisit(f.fieldIdentifier(), std::move(f.fieldDataTypeName()), std::move(f.fieldName()), v, visitor);
+                        doVisit(f.fieldIdentifier(), f.fieldDataTypeName().c_str(), f.fieldName().c_str(), v, visitor);
                     } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
                     }
                 }
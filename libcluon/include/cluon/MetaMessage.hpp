@@ -74,7 +74,7 @@ class LIBCLUON_API MetaMessage {
         /**
          * @return Type name of this field.
          */
-        std::string fieldDataTypeName() const noexcept;
+        const std::string &fieldDataTypeName() const noexcept;
         /**
          * This method sets the type name for this field.
          *
@@ -86,7 +86,7 @@ class LIBCLUON_API MetaMessage {
         /**
          * @return Name of this field.
          */
-        std::string fieldName() const noexcept;
+        const std::string &fieldName() const noexcept;
         /**
          * This method sets the name for this field.
          *
@@ -20,6 +20,15 @@ namespace cluon {
 This class transforms a given MetaMessage to a C++ header and source content.
 
 Transformation is using https://github.com/kainjow/Mustache.
+
+Optionally, the generated messages are extended by the methods
+`encodeProto(std::string &buffer)` and `decodeProto(const char *data, std::size_t length)`
+that have the field identifiers and wire types compiled in; thus, they encode
+and decode Proto without any visitor:
+
+\code{.cpp}
+cluon::MetaMessageToCPPTransformator transformation{true};
+\endcode
 */
 class LIBCLUON_API MetaMessageToCPPTransformator {
    private:
@@ -31,6 +40,13 @@ class LIBCLUON_API MetaMessageToCPPTransformator {
     MetaMessageToCPPTransformator()                                      = default;
     MetaMessageToCPPTransformator(const MetaMessageToCPPTransformator &) = default;
 
+    /**
+     * Constructor.
+     *
+     * @param generateProtoCodec true to additionally generate the methods encodeProto and decodeProto.
+     */
+    explicit MetaMessageToCPPTransformator(bool generateProtoCodec) noexcept;
+
     /**
      * The method is called from MetaMessage to visit itself using this transformator.
      *
@@ -46,6 +62,7 @@ class LIBCLUON_API MetaMessageToCPPTransformator {
    private:
     kainjow::mustache::data m_dataToBeRendered{};
     kainjow::mustache::data m_fields{kainjow::mustache::data::type::list};
+    bool m_generateProtoCodec{false};
 };
 } // namespace cluon
 
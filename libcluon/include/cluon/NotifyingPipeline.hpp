@@ -13,13 +13,80 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <new>
 #include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace cluon {
 
+/**
+ * Storage backends for NotifyingPipeline.
+ */
+enum class NotifyingPipelineBackend : uint8_t {
+    DEQUE     = 0, // std::deque guarded by a mutex; add() may be called from any thread.
+    SPSC_RING = 1, // Lock-free ring buffer; add() must only be called from one single thread.
+};
+
+/**
+ * Behavior of NotifyingPipeline::add() when the capacity is reached.
+ */
+enum class NotifyingPipelineOverflowPolicy : uint8_t {
+    BLOCK       = 0, // Wake the consumer and wait for a free slot.
+    DROP_OLDEST = 1, // Discard the oldest waiting entry ("latest wins").
+    DROP_NEWEST = 2, // Discard the entry that is about to be added.
+};
+
+/**
+ * Counters of a NotifyingPipeline.
+ */
+struct NotifyingPipelineStatistics {
+    uint64_t numberOfQueuedEntries{0};  // Entries that were accepted by add().
+    uint64_t numberOfDroppedEntries{0}; // Entries that were discarded due to the overflow policy.
+    uint64_t highWaterMark{0};          // Maximum number of entries that were waiting at the same time.
+};
+
+/**
+This class passes entries from a producer to a delegate that is running in
+its own thread. Entries are queued with add() and the delegate is woken up
+with notifyAll(); thus, a producer can queue several entries before waking up
+the consumer once.
+
+The storage is selected per pipeline: The default backend is a std::deque
+guarded by a mutex. When there is exactly one producing thread, a ring buffer
+can be used instead that does not lock on add() and that only takes the lock
+on notifyAll() when the consumer is actually sleeping; likewise, a producer
+that is blocked on a full ring buffer sleeps until the consumer has freed a
+slot. Both backends only require T to be move constructible.
+
+Instead of a delegate that is called per entry, a batch delegate of type
+`std::function<void(std::vector<T> &&)>` can be passed that receives all
+entries that are waiting at once. The DEQUE backend then takes the whole
+queue with a single lock acquisition; such a batch does no longer count
+towards the capacity of the pipeline.
+
+A pipeline can be bounded by a capacity (the ring buffer always is). When
+the capacity is reached, add() behaves according to the overflow policy that
+can be changed at any time; the number of queued and dropped entries as well
+as the high-water mark can be queried with statistics():
+
+\code{.cpp}
+cluon::NotifyingPipeline<std::string> pipeline(
+    [](std::string &&entry) { std::cout << entry << std::endl; },
+    cluon::NotifyingPipelineBackend::SPSC_RING, 1024,
+    cluon::NotifyingPipelineOverflowPolicy::DROP_OLDEST);
+pipeline.add("Hello");
+pipeline.add("World");
+pipeline.notifyAll();
+\endcode
+*/
 template <class T>
 class LIBCLUON_API NotifyingPipeline {
    private:
@@ -28,9 +95,98 @@ class LIBCLUON_API NotifyingPipeline {
     NotifyingPipeline &operator=(const NotifyingPipeline &) = delete;
     NotifyingPipeline &operator=(NotifyingPipeline &&) = delete;
 
+   private:
+    enum : std::size_t {
+        CACHE_LINE_SIZE = 64,
+    };
+
+    /**
+     * Index into the ring buffer that is padded by a complete cache line on
+     * both sides so that producer and consumer do not invalidate each other's
+     * cache lines. Padding is used instead of alignas(CACHE_LINE_SIZE) as
+     * C++14 does not allocate over-aligned types with the requested alignment.
+     */
+    struct PaddedIndex {
+        char m_frontPadding[CACHE_LINE_SIZE];
+        std::atomic<std::size_t> m_value{0};
+        char m_backPadding[CACHE_LINE_SIZE - sizeof(std::atomic<std::size_t>)];
+    };
+
+    /**
+     * Slot in the ring buffer; its sequence number tells whether the slot
+     * is free for the producer (sequence == position) or filled for the
+     * consumer (sequence == position + 1). The entry is only constructed
+     * while the slot is filled.
+     */
+    struct RingSlot {
+        std::atomic<std::size_t> m_sequence{0};
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type m_storage;
+
+        inline T &entry() noexcept { return *reinterpret_cast<T *>(&m_storage); } // NOLINT
+    };
+
    public:
-    NotifyingPipeline(std::function<void(T &&)> delegate)
-        : m_delegate(delegate) {
+    /**
+     * Constructor.
+     *
+     * @param delegate Functional (noexcept) to handle the entries one by one.
+     * @param backend Storage backend to use.
+     * @param capacity Maximum number of waiting entries (0 = unbounded for DEQUE); SPSC_RING rounds up to the next power of two.
+     * @param overflowPolicy Behavior of add() when the capacity is reached.
+     */
+    NotifyingPipeline(std::function<void(T &&)> delegate,
+                      NotifyingPipelineBackend backend              = NotifyingPipelineBackend::DEQUE,
+                      uint32_t capacity                             = 0,
+                      NotifyingPipelineOverflowPolicy overflowPolicy = NotifyingPipelineOverflowPolicy::BLOCK)
+        : NotifyingPipeline(std::move(delegate), nullptr, backend, capacity, overflowPolicy) {}
+
+    /**
+     * Constructor.
+     *
+     * @param batchDelegate Functional (noexcept) to handle all entries that are waiting at once.
+     * @param backend Storage backend to use.
+     * @param capacity Maximum number of waiting entries (0 = unbounded for DEQUE); SPSC_RING rounds up to the next power of two.
+     * @param overflowPolicy Behavior of add() when the capacity is reached.
+     */
+    NotifyingPipeline(std::function<void(std::vector<T> &&)> batchDelegate,
+                      NotifyingPipelineBackend backend              = NotifyingPipelineBackend::DEQUE,
+                      uint32_t capacity                             = 0,
+                      NotifyingPipelineOverflowPolicy overflowPolicy = NotifyingPipelineOverflowPolicy::BLOCK)
+        : NotifyingPipeline(nullptr, std::move(batchDelegate), backend, capacity, overflowPolicy) {}
+
+    /**
+     * Constructor for a pipeline without delegate.
+     */
+    NotifyingPipeline(std::nullptr_t,
+                      NotifyingPipelineBackend backend              = NotifyingPipelineBackend::DEQUE,
+                      uint32_t capacity                             = 0,
+                      NotifyingPipelineOverflowPolicy overflowPolicy = NotifyingPipelineOverflowPolicy::BLOCK)
+        : NotifyingPipeline(nullptr, nullptr, backend, capacity, overflowPolicy) {}
+
+   private:
+    NotifyingPipeline(std::function<void(T &&)> delegate,
+                      std::function<void(std::vector<T> &&)> batchDelegate,
+                      NotifyingPipelineBackend backend,
+                      uint32_t capacity,
+                      NotifyingPipelineOverflowPolicy overflowPolicy)
+        : m_delegate(std::move(delegate))
+        , m_batchDelegate(std::move(batchDelegate))
+        , m_backend(backend)
+        , m_capacity(capacity)
+        , m_overflowPolicy(overflowPolicy) {
+        if (NotifyingPipelineBackend::SPSC_RING == m_backend) {
+            std::size_t ringCapacity{1};
+            while (ringCapacity < capacity) {
+                ringCapacity <<= 1;
+            }
+            m_ring.reset(new RingSlot[ringCapacity]);
+            for (std::size_t i{0}; i < ringCapacity; i++) {
+                m_ring[i].m_sequence.store(i, std::memory_order_relaxed);
+            }
+            m_capacity = ringCapacity;
+            m_ringMask = ringCapacity - 1;
+        }
+
         m_pipelineThread = std::thread(&NotifyingPipeline::processPipeline, this);
 
         // Let the operating system spawn the thread.
@@ -38,11 +194,9 @@ class LIBCLUON_API NotifyingPipeline {
         do { std::this_thread::sleep_for(1ms); } while (!m_pipelineThreadRunning.load());
     }
 
+   public:
     ~NotifyingPipeline() {
-        m_pipelineThreadRunning.store(false);
-
-        // Wake any waiting threads.
-        m_pipelineCondition.notify_all();
+        stop();
 
         // Joining the thread could fail.
         try {
@@ -50,28 +204,260 @@ class LIBCLUON_API NotifyingPipeline {
                 m_pipelineThread.join();
             }
         } catch (...) {} // LCOV_EXCL_LINE
+
+        // Destroy the entries that are still waiting in the ring buffer.
+        if (m_ring) {
+            for (std::size_t position{m_ringHead.m_value.load()}; position != m_ringTail; position++) {
+                RingSlot &slot = m_ring[position & m_ringMask];
+                if ((position + 1) == slot.m_sequence.load()) {
+                    slot.entry().~T();
+                }
+            }
+        }
     }
 
    public:
     inline void add(T &&entry) noexcept {
-        std::unique_lock<std::mutex> lck(m_pipelineMutex);
-        m_pipeline.emplace_back(entry);
+        if (NotifyingPipelineBackend::SPSC_RING == m_backend) {
+            addToRing(std::move(entry));
+        } else {
+            addToDeque(std::move(entry));
+        }
     }
 
-    inline void notifyAll() noexcept { m_pipelineCondition.notify_all(); }
+    inline void notifyAll() noexcept {
+        if (NotifyingPipelineBackend::SPSC_RING == m_backend) {
+            // Pairs with the fence in processRing() to not miss a sleeping consumer.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!m_consumerIsWaiting.load(std::memory_order_relaxed)) {
+                // The consumer is still busy and will find the new entries itself.
+                return;
+            }
+            std::lock_guard<std::mutex> lck(m_pipelineMutex);
+        }
+        m_pipelineCondition.notify_all();
+    }
 
     inline bool isRunning() noexcept { return m_pipelineThreadRunning.load(); }
 
+    /**
+     * This method stops the delegate from being called for further entries
+     * and wakes a producer that is blocked in add(); entries that are added
+     * afterwards are not processed anymore.
+     */
+    inline void stop() noexcept {
+        m_pipelineThreadRunning.store(false);
+
+        // Wake any waiting threads; the lock ensures that the consumer is either waiting or will see the stop flag.
+        {
+            std::lock_guard<std::mutex> lck(m_pipelineMutex);
+        }
+        m_pipelineCondition.notify_all();
+        m_freeSlotCondition.notify_all();
+    }
+
+    /**
+     * This method changes the behavior of add() when the capacity is reached.
+     *
+     * @param overflowPolicy Policy to apply.
+     */
+    inline void setOverflowPolicy(NotifyingPipelineOverflowPolicy overflowPolicy) noexcept { m_overflowPolicy.store(overflowPolicy); }
+
+    /**
+     * @return Counters of this pipeline.
+     */
+    inline NotifyingPipelineStatistics statistics() const noexcept {
+        NotifyingPipelineStatistics stats;
+        stats.numberOfQueuedEntries  = m_numberOfQueuedEntries.load(std::memory_order_relaxed);
+        stats.numberOfDroppedEntries = m_numberOfDroppedEntries.load(std::memory_order_relaxed);
+        stats.highWaterMark          = m_highWaterMark.load(std::memory_order_relaxed);
+        return stats;
+    }
+
    private:
+    inline void updateHighWaterMark(uint64_t numberOfWaitingEntries) noexcept {
+        // Only called from the producer side; thus, no compare-and-swap needed.
+        if (numberOfWaitingEntries > m_highWaterMark.load(std::memory_order_relaxed)) {
+            m_highWaterMark.store(numberOfWaitingEntries, std::memory_order_relaxed);
+        }
+    }
+
+    inline void addToDeque(T &&entry) noexcept {
+        std::unique_lock<std::mutex> lck(m_pipelineMutex);
+        if ((0 < m_capacity) && !(m_pipeline.size() < m_capacity)) {
+            switch (m_overflowPolicy.load()) {
+                case NotifyingPipelineOverflowPolicy::DROP_NEWEST:
+                    m_numberOfDroppedEntries++;
+                    return;
+                case NotifyingPipelineOverflowPolicy::DROP_OLDEST:
+                    m_pipeline.pop_front();
+                    m_numberOfDroppedEntries++;
+                    break;
+                case NotifyingPipelineOverflowPolicy::BLOCK:
+                    // Wake the consumer as add() might be called several times before notifyAll().
+                    m_pipelineCondition.notify_all();
+                    m_freeSlotCondition.wait(
+                        lck, [this] { return (!this->m_pipelineThreadRunning.load() || (this->m_pipeline.size() < this->m_capacity)); });
+                    if (!m_pipelineThreadRunning.load()) {
+                        return; // LCOV_EXCL_LINE
+                    }
+                    break;
+            }
+        }
+        m_pipeline.emplace_back(std::move(entry));
+        m_numberOfQueuedEntries++;
+        updateHighWaterMark(m_pipeline.size());
+    }
+
+    inline bool isRingEmpty() const noexcept {
+        const std::size_t HEAD{m_ringHead.m_value.load(std::memory_order_acquire)};
+        return (HEAD + 1) != m_ring[HEAD & m_ringMask].m_sequence.load(std::memory_order_acquire);
+    }
+
+    inline void addToRing(T &&entry) noexcept {
+        const std::size_t TAIL{m_ringTail};
+        RingSlot &slot = m_ring[TAIL & m_ringMask];
+        bool hasDropped{false};
+        while (TAIL != slot.m_sequence.load(std::memory_order_acquire)) {
+            const std::size_t HEAD{m_ringHead.m_value.load(std::memory_order_acquire)};
+            if (hasDropped || ((TAIL - HEAD) < m_capacity)) {
+                // The consumer is about to free the slot.
+                std::this_thread::yield();
+                continue;
+            }
+
+            // The ring buffer is full.
+            const NotifyingPipelineOverflowPolicy POLICY{m_overflowPolicy.load()};
+            if (NotifyingPipelineOverflowPolicy::DROP_NEWEST == POLICY) {
+                m_numberOfDroppedEntries++;
+                return;
+            }
+            if (NotifyingPipelineOverflowPolicy::DROP_OLDEST == POLICY) {
+                // Claim the oldest entry like a consumer would do; the consumer might be faster.
+                std::size_t head{HEAD};
+                if (m_ringHead.m_value.compare_exchange_strong(head, HEAD + 1, std::memory_order_acq_rel)) {
+                    RingSlot &oldest = m_ring[HEAD & m_ringMask];
+                    // Release any resources held by the discarded entry.
+                    oldest.entry().~T();
+                    oldest.m_sequence.store(HEAD + m_capacity, std::memory_order_release);
+                    m_numberOfDroppedEntries++;
+                    hasDropped = true;
+                }
+                continue;
+            }
+
+            // Wake the consumer and sleep until it has freed the slot.
+            notifyAll();
+            {
+                std::unique_lock<std::mutex> lck(m_pipelineMutex);
+                m_producerIsWaiting.store(true, std::memory_order_relaxed);
+                // Pairs with the fence in processRing() to not miss a freed slot.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                m_freeSlotCondition.wait(lck, [this, &slot, TAIL] {
+                    return (!this->m_pipelineThreadRunning.load() || (TAIL == slot.m_sequence.load(std::memory_order_acquire)));
+                });
+                m_producerIsWaiting.store(false, std::memory_order_relaxed);
+            }
+            if (!m_pipelineThreadRunning.load()) {
+                return; // LCOV_EXCL_LINE
+            }
+        }
+        new (&slot.m_storage) T(std::move(entry));
+        slot.m_sequence.store(TAIL + 1, std::memory_order_release);
+        m_ringTail = TAIL + 1;
+
+        m_numberOfQueuedEntries++;
+        updateHighWaterMark(TAIL + 1 - m_ringHead.m_value.load(std::memory_order_relaxed));
+    }
+
+    inline void processRing() noexcept {
+        while (m_pipelineThreadRunning.load()) {
+            {
+                std::unique_lock<std::mutex> lck(m_pipelineMutex);
+                m_consumerIsWaiting.store(true, std::memory_order_relaxed);
+                // Pairs with the fence in notifyAll() to not miss any new entries.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                m_pipelineCondition.wait(lck, [this] { return (!this->m_pipelineThreadRunning.load() || !this->isRingEmpty()); });
+                m_consumerIsWaiting.store(false, std::memory_order_relaxed);
+            }
+
+            // Drain all entries that are available without holding the lock.
+            const bool IS_BATCH{nullptr != m_batchDelegate};
+            while (true) {
+                std::size_t head{m_ringHead.m_value.load(std::memory_order_acquire)};
+                RingSlot &slot = m_ring[head & m_ringMask];
+                if ((head + 1) != slot.m_sequence.load(std::memory_order_acquire)) {
+                    break;
+                }
+                // The producer might have dropped this entry in the meantime.
+                if (m_ringHead.m_value.compare_exchange_strong(head, head + 1, std::memory_order_acq_rel)) {
+                    T entry{std::move(slot.entry())};
+                    slot.entry().~T();
+                    // Release the slot before calling the delegate so that the producer can continue.
+                    slot.m_sequence.store(head + m_capacity, std::memory_order_release);
+                    // Pairs with the fence in addToRing() to wake a producer that is blocked on a full ring.
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (m_producerIsWaiting.load(std::memory_order_relaxed)) {
+                        std::lock_guard<std::mutex> lck(m_pipelineMutex);
+                        m_freeSlotCondition.notify_one();
+                    }
+
+                    if (IS_BATCH) {
+                        m_batch.emplace_back(std::move(entry));
+                        // Limit the batch when the producer is faster than the consumer.
+                        if (!(m_batch.size() < m_capacity)) {
+                            processBatch();
+                        }
+                    } else if (nullptr != m_delegate) {
+                        m_delegate(std::move(entry));
+                    }
+                }
+            }
+            if (IS_BATCH && !m_batch.empty()) {
+                processBatch();
+            }
+        }
+    }
+
+    inline void processBatch() noexcept {
+        m_batchDelegate(std::move(m_batch));
+        // The delegate might have kept the entries; anyway, the vector is reused.
+        m_batch.clear();
+    }
+
     inline void processPipeline() noexcept {
         // Indicate to caller that we are ready.
         m_pipelineThreadRunning.store(true);
 
+        if (NotifyingPipelineBackend::SPSC_RING == m_backend) {
+            processRing();
+            return;
+        }
+
         while (m_pipelineThreadRunning.load()) {
             std::unique_lock<std::mutex> lck(m_pipelineMutex);
             // Wait until the thread should stop or data is available.
             m_pipelineCondition.wait(lck, [this] { return (!this->m_pipelineThreadRunning.load() || !this->m_pipeline.empty()); });
 
+            if (nullptr != m_batchDelegate) {
+                // Take all waiting entries at once with a single lock acquisition.
+                m_takenEntries.swap(m_pipeline);
+                lck.unlock();
+                if (0 < m_capacity) {
+                    m_freeSlotCondition.notify_all();
+                }
+
+                if (!m_takenEntries.empty()) {
+                    m_batch.reserve(m_takenEntries.size());
+                    for (auto &entry : m_takenEntries) {
+                        m_batch.emplace_back(std::move(entry));
+                    }
+                    m_takenEntries.clear();
+                    processBatch();
+                }
+                continue;
+            }
+
             // The condition will automatically lock the mutex after waking up.
             // As we are locking per entry, we need to unlock the mutex first.
             lck.unlock();
@@ -83,35 +469,55 @@ class LIBCLUON_API NotifyingPipeline {
                 lck.unlock();
             }
             for (uint32_t i{0}; i < entries; i++) {
-                T entry;
-                {
-                    lck.lock();
-                    entry = m_pipeline.front();
+                // Entries are moved out of the pipeline to support move-only types.
+                lck.lock();
+                if (m_pipeline.empty()) {
+                    // Entries might have been dropped in the meantime.
                     lck.unlock();
+                    break;
+                }
+                T entry{std::move(m_pipeline.front())};
+                m_pipeline.pop_front();
+                lck.unlock();
+                if (0 < m_capacity) {
+                    m_freeSlotCondition.notify_one();
                 }
 
                 if (nullptr != m_delegate) {
                     m_delegate(std::move(entry));
                 }
-
-                {
-                    lck.lock();
-                    m_pipeline.pop_front();
-                    lck.unlock();
-                }
             }
         }
     }
 
    private:
     std::function<void(T &&)> m_delegate;
+    std::function<void(std::vector<T> &&)> m_batchDelegate;
+    std::deque<T> m_takenEntries{}; // Only accessed by the consumer.
+    std::vector<T> m_batch{};       // Only accessed by the consumer.
+    NotifyingPipelineBackend m_backend;
+    std::size_t m_capacity;
+    std::atomic<NotifyingPipelineOverflowPolicy> m_overflowPolicy;
 
     std::atomic<bool> m_pipelineThreadRunning{false};
     std::thread m_pipelineThread{};
     std::mutex m_pipelineMutex{};
     std::condition_variable m_pipelineCondition{};
+    std::condition_variable m_freeSlotCondition{};
 
     std::deque<T> m_pipeline{};
+
+    std::unique_ptr<RingSlot[]> m_ring{};
+    std::size_t m_ringMask{0};
+    PaddedIndex m_ringHead{};
+    std::size_t m_ringTail{0}; // Only accessed by the producer.
+    char m_ringTailPadding[CACHE_LINE_SIZE - sizeof(std::size_t)]{};
+    std::atomic<bool> m_consumerIsWaiting{false};
+    std::atomic<bool> m_producerIsWaiting{false};
+
+    std::atomic<uint64_t> m_numberOfQueuedEntries{0};
+    std::atomic<uint64_t> m_numberOfDroppedEntries{0};
+    std::atomic<uint64_t> m_highWaterMark{0};
 };
 } // namespace cluon
 
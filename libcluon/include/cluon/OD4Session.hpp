@@ -9,6 +9,9 @@
 #ifndef CLUON_OD4SESSION_HPP
 #define CLUON_OD4SESSION_HPP
 
+#include "cluon/BufferPool.hpp"
+#include "cluon/Envelope.hpp"
+#include "cluon/FragmentAssembler.hpp"
 #include "cluon/Time.hpp"
 #include "cluon/ToProtoVisitor.hpp"
 #include "cluon/UDPReceiver.hpp"
@@ -16,6 +19,7 @@
 #include "cluon/cluon.hpp"
 #include "cluon/cluonDataStructures.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <functional>
@@ -24,6 +28,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace cluon {
 /**
@@ -72,8 +77,48 @@ od4.timeTrigger(FREQ, [](){
   return false;
 }); // This call blocks until the lambda returns false.
 \endcode
+
+By default, all delegates are called one after another from the thread that
+receives the Envelopes; thus, a slow delegate delays all other ones. To avoid
+that, a pool of worker threads can be requested when creating the OD4Session.
+Envelopes are then distributed to the workers by their dataType so that all
+Envelopes of the same type are still handled in order while different types
+are handled in parallel:
+
+\code{.cpp}
+cluon::OD4Session od4{111, nullptr, 4}; // Four workers.
+...
+for (auto stats : od4.workerStatistics()) {
+    std::cout << stats.queueDepth << " waiting, " << stats.averageLatencyInMicroseconds << " us latency" << std::endl;
+}
+\endcode
+
+Envelopes that do not fit into one UDP datagram are transparently split into
+fragments when sent and reassembled by the receiving OD4Sessions (see
+cluon::FragmentAssembler); Envelopes whose fragments do not arrive completely
+within one second are discarded. The number of reassembled and discarded
+Envelopes can be queried with `fragmentStatistics()`.
 */
 class LIBCLUON_API OD4Session {
+   private:
+    enum {
+        RECEIVE_BATCH_SIZE    = 16, // Number of datagrams to drain per system call where supported.
+        WORKER_QUEUE_CAPACITY = 1024,
+    };
+
+   public:
+    /**
+     * Counters of one worker thread.
+     */
+    struct WorkerStatistics {
+        uint64_t numberOfProcessedEnvelopes{0};   // Envelopes that were passed to a delegate.
+        uint64_t numberOfDroppedEnvelopes{0};     // Oldest Envelopes that were discarded as the worker was too slow.
+        uint64_t queueDepth{0};                   // Envelopes currently waiting for this worker.
+        uint64_t highWaterMark{0};                // Maximum number of Envelopes that were waiting at the same time.
+        int64_t averageLatencyInMicroseconds{0};  // Average time that an Envelope waited for this worker.
+        int64_t maximumLatencyInMicroseconds{0};  // Maximum time that an Envelope waited for this worker.
+    };
+
    private:
     OD4Session(const OD4Session &) = delete;
     OD4Session(OD4Session &&)      = delete;
@@ -89,11 +134,16 @@ class LIBCLUON_API OD4Session {
      *        if a nullptr is passed, the method dataTrigger can be used to set
      *        message specific delegates. Please note that it is NOT possible
      *        to have both: a delegate for "catch-all" and the data-triggered ones.
+     * @param numberOfWorkers Number of threads to call the delegates; 0 calls them from the receiving thread.
      */
-    OD4Session(uint16_t CID, std::function<void(cluon::data::Envelope &&envelope)> delegate = nullptr) noexcept;
+    OD4Session(uint16_t CID, std::function<void(cluon::data::Envelope &&envelope)> delegate = nullptr, uint16_t numberOfWorkers = 0) noexcept;
+    ~OD4Session() noexcept;
 
     /**
      * This method will send a given Envelope to this OpenDaVINCI v4 session.
+     * Envelopes that do not fit into one UDP datagram are fragmented; the
+     * encoded Envelope must not exceed 16,777,215 bytes, the maximum length
+     * of the OD4 header, otherwise it is not sent.
      *
      * @param envelope to be sent.
      */
@@ -124,6 +174,12 @@ class LIBCLUON_API OD4Session {
     /**
      * This method will send a given message to this OpenDaVINCI v4 session.
      *
+     * The message is encoded without holding any lock into buffers that
+     * belong to the calling thread and that are reused for its subsequent
+     * messages unless they grew beyond 64 KB; only writing to the socket is
+     * synchronized. Thus, several threads can send concurrently. As for
+     * Envelopes, the encoded message must not exceed 16,777,215 bytes.
+     *
      * @param message Message to be sent.
      * @param sampleTimeStamp Time point when this sample to be sent was captured (default = sent time point).
      * @param senderStamp Optional sender stamp (default = 0).
@@ -131,40 +187,156 @@ class LIBCLUON_API OD4Session {
     template <typename T>
     void send(T &message, const cluon::data::TimeStamp &sampleTimeStamp = cluon::data::TimeStamp(), uint32_t senderStamp = 0) noexcept {
         try {
-            std::lock_guard<std::mutex> lck(m_senderMutex);
-            cluon::ToProtoVisitor protoEncoder;
-
-            cluon::data::Envelope envelope;
-            {
-                envelope.dataType(static_cast<int32_t>(message.ID()));
-                message.accept(protoEncoder);
-                envelope.serializedData(protoEncoder.encodedData());
-                envelope.sent(cluon::time::now());
-                envelope.sampleTimeStamp((0 == (sampleTimeStamp.seconds() + sampleTimeStamp.microseconds())) ? envelope.sent() : sampleTimeStamp);
-                envelope.senderStamp(senderStamp);
-            }
+            thread_local std::string payload;
+            thread_local cluon::data::Envelope envelope;
+            thread_local std::string dataToSend;
+
+            // Encode into the memory of the previous payload.
+            payload.clear();
+            cluon::ToProtoVisitor protoEncoder{std::move(payload)};
+            message.accept(protoEncoder);
 
-            send(std::move(envelope));
+            // The payload is moved into the Envelope instead of being copied.
+            envelope.dataType(static_cast<int32_t>(message.ID()));
+            envelope.serializedData(protoEncoder.releaseEncodedData());
+            envelope.sent(cluon::time::now());
+            envelope.sampleTimeStamp((0 == (sampleTimeStamp.seconds() + sampleTimeStamp.microseconds())) ? envelope.sent() : sampleTimeStamp);
+            envelope.senderStamp(senderStamp);
+
+            cluon::serializeEnvelope(envelope, dataToSend);
+            sendInternal(dataToSend);
+
+            // Take the memory of the payload back for the next message.
+            PayloadSwapper payloadSwapper{payload};
+            envelope.accept(2, payloadSwapper);
+
+            // Do not keep the memory of an occasional large message for the lifetime of the thread.
+            constexpr std::size_t MAX_RETAINED_CAPACITY{64 * 1024};
+            if (MAX_RETAINED_CAPACITY < dataToSend.capacity()) {
+                std::string().swap(payload);
+                std::string().swap(dataToSend);
+            }
         } catch (...) {} // LCOV_EXCL_LINE
     }
 
+   private:
+    /**
+     * This visitor swaps the payload of an Envelope with the given buffer
+     * so that its memory can be reused without copying.
+     */
+    class PayloadSwapper {
+       public:
+        explicit PayloadSwapper(std::string &buffer) noexcept
+            : m_buffer(buffer) {}
+
+        void visit(uint32_t, const char *, const char *, std::string &v) noexcept { m_buffer.swap(v); }
+
+        template <typename V>
+        void visit(uint32_t, const char *, const char *, V &) noexcept {}
+
+        template <typename V>
+        void visit(uint32_t id, std::string &&typeName, std::string &&name, V &v) noexcept {
+            visit(id, typeName.c_str(), name.c_str(), v);
+        }
+
+       private:
+        std::string &m_buffer;
+    };
+
    public:
     bool isRunning() noexcept;
 
+    /**
+     * This method changes how received Envelopes are queued when the delegates are too slow.
+     *
+     * @param overflowPolicy Policy to apply.
+     */
+    void setOverflowPolicy(cluon::NotifyingPipelineOverflowPolicy overflowPolicy) noexcept;
+
+    /**
+     * @return Counters of the pipeline between the receiving socket and the delegates.
+     */
+    cluon::NotifyingPipelineStatistics pipelineStatistics() const noexcept;
+
+    /**
+     * @return Counters per worker thread (empty when no workers were requested).
+     */
+    std::vector<WorkerStatistics> workerStatistics() const noexcept;
+
+    /**
+     * @return Counters of the reassembly of fragmented Envelopes.
+     */
+    cluon::FragmentAssemblerStatistics fragmentStatistics() const noexcept;
+
+    /**
+     * This method installs a socket filter (Linux only) that lets the kernel
+     * discard all Envelopes for which no data-triggered delegate is set;
+     * the filter is regenerated whenever dataTrigger is called. The filter
+     * cannot be used together with a "catch-all" delegate.
+     *
+     * @param enable true to install the filter, false to remove it.
+     * @return true if the filter was installed or removed successfully.
+     */
+    bool useSocketFilter(bool enable) noexcept;
+
+   private:
+    void callback(cluon::PooledBuffer &&data, const struct sockaddr_in &from, std::chrono::system_clock::time_point &&timepoint) noexcept;
+    void dispatch(cluon::data::Envelope &&envelope) noexcept;
+
+    /**
+     * This method looks up the data-triggered delegate without taking any lock.
+     *
+     * @param messageIdentifier Message identifier to look up.
+     * @return Delegate or nullptr if none is registered.
+     */
+    std::shared_ptr<const std::function<void(cluon::data::Envelope &&envelope)>> findDataTriggeredDelegate(int32_t messageIdentifier) noexcept;
+
+    /**
+     * This method generates and attaches the socket filter for the currently
+     * set data-triggered delegates; m_mapOfDataTriggeredDelegatesMutex must be held.
+     *
+     * @return true if the filter was attached.
+     */
+    bool updateSocketFilter() noexcept;
+    void sendInternal(const std::string &dataToSend) noexcept;
+
    private:
-    void callback(std::string &&data, std::string &&from, std::chrono::system_clock::time_point &&timepoint) noexcept;
-    void sendInternal(std::string &&dataToSend) noexcept;
+    class WorkerEntry {
+       public:
+        cluon::data::Envelope m_envelope{};
+        std::chrono::steady_clock::time_point m_enqueued{};
+    };
+
+    class Worker {
+       public:
+        std::atomic<uint64_t> m_numberOfProcessedEnvelopes{0};
+        std::atomic<int64_t> m_sumOfLatencies{0};
+        std::atomic<int64_t> m_maximumLatency{0};
+        // Declared last to stop the thread before the counters are destroyed.
+        std::unique_ptr<cluon::NotifyingPipeline<WorkerEntry>> m_pipeline{nullptr};
+    };
 
    private:
     std::unique_ptr<cluon::UDPReceiver> m_receiver;
     cluon::UDPSender m_sender;
 
-    std::mutex m_senderMutex{};
+    std::atomic<uint32_t> m_fragmentSequenceNumber{0};
+    cluon::FragmentAssembler m_fragmentAssembler{};
 
     std::function<void(cluon::data::Envelope &&envelope)> m_delegate{nullptr};
 
     std::mutex m_mapOfDataTriggeredDelegatesMutex{};
     std::unordered_map<int32_t, std::function<void(cluon::data::Envelope &&envelope)>, UseUInt32ValueAsHashKey> m_mapOfDataTriggeredDelegates{};
+
+    // Immutable copy of m_mapOfDataTriggeredDelegates sorted by message identifier that
+    // is replaced atomically on every change so that the receiving side does not lock.
+    using DispatchTable = std::vector<std::pair<int32_t, std::shared_ptr<const std::function<void(cluon::data::Envelope &&envelope)>>>>;
+    std::atomic<DispatchTable *> m_dispatchTable{nullptr};
+    std::atomic<uint32_t> m_numberOfDispatchTableReaders{0};
+    std::vector<std::unique_ptr<DispatchTable>> m_retiredDispatchTables{}; // Protected by m_mapOfDataTriggeredDelegatesMutex.
+    bool m_useSocketFilter{false};                                         // Protected by m_mapOfDataTriggeredDelegatesMutex.
+
+    std::vector<std::unique_ptr<Worker>> m_workers{};
 };
 
 } // namespace cluon
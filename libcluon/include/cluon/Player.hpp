@@ -12,6 +12,7 @@
 #include "cluon/cluon.hpp"
 #include "cluon/cluonDataStructures.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <fstream>
@@ -22,20 +23,10 @@
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 namespace cluon {
 
-class LIBCLUON_API IndexEntry {
-   public:
-    IndexEntry() = default;
-    IndexEntry(const int64_t &sampleTimeStamp, const uint64_t &filePosition) noexcept;
-
-   public:
-    int64_t m_sampleTimeStamp{0};
-    uint64_t m_filePosition{0};
-    bool m_available{0};
-};
-
 class LIBCLUON_API Player {
    private:
     enum {
@@ -44,6 +35,7 @@ class LIBCLUON_API Player {
         MAX_DELAY_IN_MICROSECONDS       = 1 * ONE_SECOND_IN_MICROSECONDS,
         LOOK_AHEAD_IN_S                 = 30,
         MIN_ENTRIES_FOR_LOOK_AHEAD      = 5000,
+        READ_AHEAD_IN_BYTES             = 16 * 1024 * 1024,
     };
 
    private:
@@ -54,7 +46,19 @@ class LIBCLUON_API Player {
 
    public:
     /**
-     * Constructor.
+     * Constructor. The index of the given file is loaded from its index file
+     * (see cluon::RecFileIndex) if available; otherwise, the file is scanned
+     * and the index file is written for the next time.
+     *
+     * On POSIX systems, the file is mapped into memory and Envelopes are
+     * decoded directly from the mapping while the kernel is advised to read
+     * ahead from the current playback position; the background thread then
+     * only publishes cluon::data::PlayerStatus. If the file cannot be mapped,
+     * Envelopes are read into a cache that is filled from the background
+     * thread when threading is enabled. As accessing a mapping beyond the end
+     * of a truncated file raises SIGBUS, the size of the file is checked
+     * before an Envelope is decoded from the mapping; once the file has
+     * shrunk, the remaining Envelopes are read through the file stream.
      *
      * @param file File to play.
      * @param autoRewind True if the file should be rewind at EOF.
@@ -84,8 +88,23 @@ class LIBCLUON_API Player {
      */
     void rewind() noexcept;
 
+    /**
+     * This method moves the playback position to the given ratio of
+     * all cluon::data::Envelopes in the .rec file.
+     *
+     * @param ratio Position between 0 (first Envelope) and 1 (last Envelope).
+     */
     void seekTo(float ratio) noexcept;
 
+    /**
+     * This method moves the playback position to the first
+     * cluon::data::Envelope with a sample time stamp not before
+     * the given one.
+     *
+     * @param sampleTimeStamp Sample time stamp to seek to.
+     */
+    void seekToSampleTimeStamp(const cluon::data::TimeStamp &sampleTimeStamp) noexcept;
+
     /**
      * @return total amount of cluon::data::Envelopes in the .rec file.
      */
@@ -98,10 +117,42 @@ class LIBCLUON_API Player {
     /**
      * This method initializes the global index where the sample
      * time stamps are sorted chronocally and mapped to the
-     * corresponding cluon::data::Envelope in the rec file.
+     * corresponding cluon::data::Envelope in the rec file; the
+     * entries are loaded from or stored to the index file.
      */
     void initializeIndex() noexcept;
 
+    /**
+     * This method maps the .rec file into memory; if that fails,
+     * the .rec file is read through m_recFile.
+     */
+    void mapRecFile() noexcept;
+    void unmapRecFile() noexcept;
+
+    /**
+     * This method advises the kernel to read ahead from the given
+     * position in the mapped .rec file unless that was already done.
+     *
+     * @param filePosition Position of the Envelope to be replayed next.
+     */
+    void adviseReadAhead(const uint64_t &filePosition) noexcept;
+
+    /**
+     * This method checks whether the mapped .rec file was truncated after
+     * it was mapped; once it was, the mapping is not used anymore.
+     *
+     * @return true if Envelopes can be decoded from the mapping.
+     */
+    bool isMappedRecFileIntact() noexcept;
+
+    /**
+     * This method moves the playback position to the given entry
+     * of the index and refills the cache from there.
+     *
+     * @param entry Position in the index of the Envelope to be replayed next.
+     */
+    void seekToEntry(std::size_t entry) noexcept;
+
     /**
      * This method computes the initially required amount of
      * cluon::data::Envelope in the cache and fill the cache accordingly.
@@ -142,22 +193,33 @@ class LIBCLUON_API Player {
     std::fstream m_recFile;
     bool m_recFileValid;
 
+    // Read-only mapping of the .rec file; nullptr if the .rec file is read through m_recFile.
+    const char *m_mappedRecFile;
+    std::size_t m_mappedRecFileSize;
+    // File descriptor of the mapped .rec file to detect truncation.
+    int m_mappedRecFileDescriptor;
+    bool m_mappedRecFileTruncated;
+    // Range in the mapping for which the kernel was advised to read ahead.
+    uint64_t m_readAheadBegin;
+    uint64_t m_readAheadEnd;
+
    private: // Player states.
     bool m_autoRewind;
 
    private: // Index and cache management.
-    // Global index: Mapping SampleTimeStamp --> cache entry (holding the actual content from .rec file).
+    // Global index sorted by sample time stamp with one column per attribute:
+    // entry i refers to the Envelope at m_indexFilePositions[i] in the .rec file.
     mutable std::mutex m_indexMutex;
-    std::multimap<int64_t, IndexEntry> m_index;
+    std::vector<int64_t> m_indexSampleTimeStamps;
+    std::vector<uint64_t> m_indexFilePositions;
 
-    // Pointers to the current envelope to be replayed and the
-    // envelope that has be replayed from the global index.
-    std::multimap<int64_t, IndexEntry>::iterator m_previousPreviousEnvelopeAlreadyReplayed;
-    std::multimap<int64_t, IndexEntry>::iterator m_previousEnvelopeAlreadyReplayed;
-    std::multimap<int64_t, IndexEntry>::iterator m_currentEnvelopeToReplay;
+    // Positions in the global index of the current envelope to be
+    // replayed and the envelope that has been replayed before.
+    std::size_t m_previousEnvelopeAlreadyReplayed;
+    std::size_t m_currentEnvelopeToReplay;
 
-    // Information about the index.
-    std::multimap<int64_t, IndexEntry>::iterator m_nextEntryToReadFromRecFile;
+    // Position in the global index of the next envelope to be read into the cache.
+    std::size_t m_nextEntryToReadFromRecFile;
 
     uint32_t m_desiredInitialLevel;
 
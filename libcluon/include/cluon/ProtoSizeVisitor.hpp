@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_PROTOSIZEVISITOR_HPP
+#define CLUON_PROTOSIZEVISITOR_HPP
+
+#include "cluon/ProtoConstants.hpp"
+#include "cluon/cluon.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace cluon {
+/**
+This class computes the number of bytes that cluon::ToProtoVisitor would
+produce for a given message without encoding it; thus, a buffer can be
+allocated once with the exact size before the message is encoded into it:
+
+\code{.cpp}
+MyMessage msg;
+cluon::ProtoSizeVisitor protoSize;
+msg.accept(protoSize);
+const std::size_t SIZE = protoSize.encodedSize();
+\endcode
+*/
+class LIBCLUON_API ProtoSizeVisitor {
+   private:
+    ProtoSizeVisitor(const ProtoSizeVisitor &) = delete;
+    ProtoSizeVisitor(ProtoSizeVisitor &&)      = delete;
+    ProtoSizeVisitor &operator=(const ProtoSizeVisitor &) = delete;
+    ProtoSizeVisitor &operator=(ProtoSizeVisitor &&) = delete;
+
+   public:
+    ProtoSizeVisitor()  = default;
+    ~ProtoSizeVisitor() = default;
+
+    /**
+     * @return Number of bytes of the visited message(s) in Proto format.
+     */
+    std::size_t encodedSize() const noexcept;
+
+    /**
+     * This method resets the computed size to 0.
+     */
+    void reset() noexcept;
+
+    /**
+     * @param v Value to encode.
+     * @return Number of bytes for the given value encoded as VarInt.
+     */
+    static std::size_t sizeOfVarInt(uint64_t v) noexcept;
+
+   public:
+    // The following methods are provided to allow an instance of this class to
+    // be used as visitor for an instance with the method signature void accept<T>(T&);
+
+    void preVisit(int32_t id, const char *shortName, const char *longName) noexcept;
+    void postVisit() noexcept;
+
+    void visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept;
+
+    template <typename T>
+    void visit(uint32_t &id, const char *typeName, const char *name, T &value) noexcept {
+        (void)typeName;
+        (void)name;
+
+        ProtoSizeVisitor nestedProtoSize;
+        value.accept(nestedProtoSize);
+        sizeOfLengthDelimited(id, nestedProtoSize.encodedSize());
+    }
+
+    // The following methods forward the names to the methods above for
+    // messages that pass them as std::string.
+    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+        preVisit(id, shortName.c_str(), longName.c_str());
+    }
+
+    template <typename T>
+    void visit(uint32_t id, std::string &&typeName, std::string &&name, T &value) noexcept {
+        visit(id, typeName.c_str(), name.c_str(), value);
+    }
+
+   private:
+    void sizeOfKeyValue(uint32_t id, ProtoConstants protoType, std::size_t sizeOfValue) noexcept;
+    void sizeOfLengthDelimited(uint32_t id, std::size_t length) noexcept;
+
+   private:
+    std::size_t m_size{0};
+};
+} // namespace cluon
+
+#endif
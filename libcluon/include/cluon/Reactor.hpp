@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2017-2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_REACTOR_HPP
+#define CLUON_REACTOR_HPP
+
+#include "cluon/cluon.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace cluon {
+/**
+This class waits in a single thread for incoming data on an arbitrary number
+of sockets and calls a user-supplied delegate whenever a socket is readable.
+
+On Linux, the thread is blocked in `epoll_wait` without any timeout and is
+only woken up by the kernel when data arrives or by an `eventfd` when the
+Reactor is destroyed; thus, an idle Reactor does not consume any CPU time.
+On other platforms, `select` is used with a timeout of 20ms.
+
+cluon::UDPReceiver and cluon::TCPConnection create their own Reactor by
+default. To let many cluon::UDPReceivers share one thread, a Reactor can be
+passed to their constructor:
+
+\code{.cpp}
+auto reactor = std::make_shared<cluon::Reactor>();
+cluon::UDPReceiver receiverA(reactor, "225.0.0.111", 12175, delegateA);
+cluon::UDPReceiver receiverB(reactor, "225.0.0.112", 12175, delegateB);
+\endcode
+
+As all delegates are called from the same thread, they should return quickly.
+*/
+class LIBCLUON_API Reactor {
+   private:
+    Reactor(const Reactor &) = delete;
+    Reactor(Reactor &&)      = delete;
+    Reactor &operator=(const Reactor &) = delete;
+    Reactor &operator=(Reactor &&) = delete;
+
+   public:
+    Reactor() noexcept;
+    ~Reactor() noexcept;
+
+    /**
+     * @return true if the Reactor could successfully be created and is waiting for data.
+     */
+    bool isRunning() const noexcept;
+
+    /**
+     * This method registers a socket to be watched for incoming data.
+     *
+     * @param fileDescriptor Socket to watch.
+     * @param delegate Functional (noexcept) to be called from the Reactor's thread whenever the socket is readable.
+     * @return true if the socket was registered.
+     */
+    bool add(int32_t fileDescriptor, std::function<void()> delegate) noexcept;
+
+    /**
+     * This method unregisters a socket. When called from outside the
+     * Reactor's thread, it waits until the socket's delegate has returned;
+     * afterwards, the delegate is not called anymore.
+     *
+     * @param fileDescriptor Socket to unregister.
+     */
+    void remove(int32_t fileDescriptor) noexcept;
+
+    /**
+     * @return Number of currently registered sockets.
+     */
+    std::size_t numberOfFileDescriptors() const noexcept;
+
+   private:
+    void run() noexcept;
+    void dispatch(int32_t fileDescriptor) noexcept;
+
+   private:
+    enum {
+        MAX_EVENTS = 64, // Number of events to fetch per epoll_wait.
+    };
+
+#ifdef __linux__
+    int32_t m_epollFileDescriptor{-1};
+    int32_t m_wakeUpFileDescriptor{-1};
+#endif
+
+    mutable std::mutex m_delegatesMutex{};
+    std::condition_variable m_delegateReturned{};
+    std::map<int32_t, std::shared_ptr<std::function<void()>>> m_delegates{};
+    const std::function<void()> *m_runningDelegate{nullptr}; // Protected by m_delegatesMutex.
+
+    std::atomic<bool> m_reactorThreadRunning{false};
+    std::thread m_reactorThread{};
+};
+} // namespace cluon
+
+#endif
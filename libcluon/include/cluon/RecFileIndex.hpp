@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_RECFILEINDEX_HPP
+#define CLUON_RECFILEINDEX_HPP
+
+#include "cluon/cluon.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cluon {
+
+/**
+ * Location and meta information of one cluon::data::Envelope in a .rec file.
+ */
+class LIBCLUON_API RecFileIndexEntry {
+   public:
+    int64_t m_sampleTimeStamp{0};
+    uint64_t m_filePosition{0};
+    int32_t m_dataType{0};
+    uint32_t m_senderStamp{0};
+    uint32_t m_length{0};
+};
+
+/**
+This class creates, stores, and loads the index of a .rec file in a sidecar
+file next to it (<file>.rec.idx) so that a recording needs to be scanned only
+once:
+
+\code{.cpp}
+auto index = cluon::RecFileIndex::read("myRecording.rec");
+if (!index.first) {
+    std::fstream recFile("myRecording.rec", std::ios::in | std::ios::binary);
+    index.second = cluon::RecFileIndex::build(recFile);
+    cluon::RecFileIndex::write("myRecording.rec", index.second);
+}
+\endcode
+
+The index file stores all values in little Endian:
+
+    Header (48 bytes):
+      char[8]  "CLUONIDX"
+      uint32_t version
+      uint32_t size of one entry in bytes
+      uint64_t size of the .rec file in bytes
+      uint64_t FNV-1a checksum over the first and last 64KB of the .rec file
+      uint64_t number of entries
+      uint64_t FNV-1a checksum over all entries
+    Entry (32 bytes), in order of appearance in the .rec file:
+      int64_t  sample time stamp in microseconds
+      uint64_t position of the Envelope in the .rec file
+      int32_t  dataType
+      uint32_t senderStamp
+      uint32_t length of the Envelope including its OD4 header
+      uint32_t reserved
+
+An index file is only accepted when size and checksum of the .rec file
+match; thus, an index for a recording that was modified or replaced
+afterwards is ignored.
+*/
+class LIBCLUON_API RecFileIndex {
+   private:
+    enum : uint32_t {
+        INDEX_FILE_VERSION           = 1,
+        INDEX_FILE_HEADER_SIZE       = 48,
+        INDEX_FILE_ENTRY_SIZE        = 32,
+        INDEX_FILE_ENTRIES_PER_BLOCK = 32 * 1024,
+        FINGERPRINT_BLOCK_SIZE       = 64 * 1024,
+        MIN_BUILD_BLOCK_SIZE         = 64 * 1024,
+        BUILD_BLOCK_SIZE             = 8 * 1024 * 1024,
+        BUILD_CHUNK_SIZE             = 64 * 1024 * 1024,
+    };
+
+   private:
+    RecFileIndex()                     = delete;
+    RecFileIndex(const RecFileIndex &) = delete;
+    RecFileIndex(RecFileIndex &&)      = delete;
+    RecFileIndex &operator=(const RecFileIndex &) = delete;
+    RecFileIndex &operator=(RecFileIndex &&) = delete;
+
+   public:
+    /**
+     * @param recFile Name of the .rec file.
+     * @return Name of the index file belonging to the given .rec file.
+     */
+    static std::string indexFileFor(const std::string &recFile) noexcept;
+
+    /**
+     * This method scans the given .rec file from its beginning and
+     * creates one entry per contained cluon::data::Envelope; only the
+     * Envelopes' headers are scanned while their payloads are skipped.
+     *
+     * @param recFile Stream to the .rec file.
+     * @return Entries in order of appearance in the .rec file.
+     */
+    static std::vector<RecFileIndexEntry> build(std::istream &recFile) noexcept;
+
+    /**
+     * This method splits the given .rec file into chunks that are scanned
+     * concurrently and merges the results. A chunk starts at the first
+     * complete and well-formed Envelope within its range; if that position
+     * is not where the Envelopes of the preceding chunk end (for instance,
+     * because a payload contained an OD4 header), the chunk is scanned again
+     * from there. Thus, the entries are the same as from the sequential scan.
+     *
+     * @param recFile Name of the .rec file.
+     * @param numberOfThreads Number of threads to scan chunks; 0 to use one per hardware thread.
+     * @param bytesPerChunk Size of the chunks in bytes.
+     * @return Entries in order of appearance in the .rec file.
+     */
+    static std::vector<RecFileIndexEntry> build(const std::string &recFile, uint32_t numberOfThreads = 0, uint64_t bytesPerChunk = BUILD_CHUNK_SIZE) noexcept;
+
+    /**
+     * This method loads the index file belonging to the given .rec file.
+     *
+     * @param recFile Name of the .rec file.
+     * @return pair(true, entries) if a valid index file for the given .rec file was found.
+     */
+    static std::pair<bool, std::vector<RecFileIndexEntry>> read(const std::string &recFile) noexcept;
+
+    /**
+     * This method stores the given entries in the index file belonging
+     * to the given .rec file.
+     *
+     * @param recFile Name of the .rec file.
+     * @param entries Entries to store.
+     * @return true if the index file was written.
+     */
+    static bool write(const std::string &recFile, const std::vector<RecFileIndexEntry> &entries) noexcept;
+
+   private:
+    /**
+     * This method scans the Envelopes of the given .rec file that start
+     * within [begin, end) without decoding their payloads.
+     *
+     * @param recFile Stream to the .rec file.
+     * @param begin Position to start scanning at.
+     * @param end Position at or after which no more Envelopes are scanned.
+     * @param resynchronize If true, scanning starts at the first complete and well-formed Envelope at or after begin.
+     * @param logProgress If true, the progress is logged to std::clog.
+     * @param buffer Buffer for reading the .rec file; its memory is reused.
+     * @param entries Entries to append to.
+     * @return pair(position of the first scanned Envelope or end if none was found,
+     *              position after the last scanned Envelope or max if the end of the .rec file was reached).
+     */
+    static std::pair<uint64_t, uint64_t> scan(std::istream &recFile, uint64_t begin, uint64_t end, bool resynchronize, bool logProgress,
+                                              std::string &buffer, std::vector<RecFileIndexEntry> &entries) noexcept;
+
+    /**
+     * @param recFile Name of the .rec file.
+     * @return pair(size of the .rec file, checksum over its first and last 64KB); size is -1 if the file cannot be read.
+     */
+    static std::pair<int64_t, uint64_t> fingerprint(const std::string &recFile) noexcept;
+
+    /**
+     * @param data Pointer to the bytes.
+     * @param length Number of bytes.
+     * @param hash Hash to continue from.
+     * @return FNV-1a hash of the given bytes.
+     */
+    static uint64_t fnv1a(const char *data, std::size_t length, uint64_t hash = 14695981039346656037ull) noexcept;
+
+    static void appendUInt32(std::string &out, uint32_t v) noexcept;
+    static void appendUInt64(std::string &out, uint64_t v) noexcept;
+    static uint32_t readUInt32(const char *data) noexcept;
+    static uint64_t readUInt64(const char *data) noexcept;
+};
+} // namespace cluon
+
+#endif
@@ -10,6 +10,7 @@
 #define CLUON_TCPCONNECTION_HPP
 
 #include "cluon/NotifyingPipeline.hpp"
+#include "cluon/Reactor.hpp"
 #include "cluon/cluon.hpp"
 
 // clang-format off
@@ -29,6 +30,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace cluon {
 /**
@@ -140,6 +142,16 @@ class LIBCLUON_API TCPConnection {
      */
     void closeSocket(int errorCode) noexcept;
     void startReadingFromSocket() noexcept;
+
+    /**
+     * This method registers the socket with the Reactor once a newDataDelegate
+     * is set; m_newDataDelegateMutex must be held.
+     */
+    void registerWithReactor() noexcept;
+
+    /**
+     * This method is called from the Reactor whenever the socket is readable.
+     */
     void readFromSocket() noexcept;
 
    private:
@@ -147,16 +159,22 @@ class LIBCLUON_API TCPConnection {
     int32_t m_socket{-1};
     struct sockaddr_in m_address {};
 
-    std::atomic<bool> m_readFromSocketThreadRunning{false};
-    std::thread m_readFromSocketThread{};
+    std::atomic<bool> m_isReadingFromSocket{false};
+    std::shared_ptr<cluon::Reactor> m_reactor{};
+    std::vector<char> m_buffer{};
 
     std::mutex m_newDataDelegateMutex{};
     std::function<void(std::string &&, std::chrono::system_clock::time_point)> m_newDataDelegate{};
+    bool m_isRegisteredWithReactor{false}; // Protected by m_newDataDelegateMutex.
 
     mutable std::mutex m_connectionLostDelegateMutex{};
     std::function<void()> m_connectionLostDelegate{};
 
    private:
+    enum {
+        PIPELINE_CAPACITY = 1024,
+    };
+
     class PipelineEntry {
        public:
         std::string m_data;
@@ -10,15 +10,31 @@
 #define CLUON_TOPROTOVISITOR_HPP
 
 #include "cluon/ProtoConstants.hpp"
+#include "cluon/ProtoSizeVisitor.hpp"
 #include "cluon/cluon.hpp"
 
+#include <cstddef>
 #include <cstdint>
-#include <sstream>
 #include <string>
 
 namespace cluon {
 /**
 This class encodes a given message in Proto format.
+
+The bytes are written into one contiguous buffer; the length of a nested
+message is computed with cluon::ProtoSizeVisitor and written before the nested
+message is encoded into the same buffer. To encode many messages with the
+same instance without reallocating memory, call `reset()` before visiting the
+next message:
+
+\code{.cpp}
+cluon::ToProtoVisitor protoEncoder;
+for (auto &msg : messages) {
+    protoEncoder.reset();
+    msg.accept(protoEncoder);
+    const std::string &data = protoEncoder.encodedBuffer();
+}
+\endcode
 */
 class LIBCLUON_API ToProtoVisitor {
    private:
@@ -31,56 +47,96 @@ class LIBCLUON_API ToProtoVisitor {
     ToProtoVisitor()  = default;
     ~ToProtoVisitor() = default;
 
+    /**
+     * Constructor to append the encoded data to the bytes already in the
+     * given buffer; the buffer's memory is taken over so that a buffer that
+     * was reserved with the final size is not reallocated while encoding.
+     *
+     * @param buffer Buffer to append the encoded data to.
+     */
+    explicit ToProtoVisitor(std::string &&buffer) noexcept;
+
     /**
      * @return Encoded data in Proto format.
      */
     std::string encodedData() const noexcept;
 
+    /**
+     * @return Reference to the encoded data in Proto format that is valid until the next call to visit or reset.
+     */
+    const std::string &encodedBuffer() const noexcept;
+
+    /**
+     * This method moves the encoded data out of this visitor without copying
+     * it; the visitor is empty afterwards.
+     *
+     * @return Encoded data in Proto format.
+     */
+    std::string releaseEncodedData() noexcept;
+
+    /**
+     * This method discards the encoded data but keeps the allocated memory.
+     */
+    void reset() noexcept;
+
    public:
     // The following methods are provided to allow an instance of this class to
     // be used as visitor for an instance with the method signature void accept<T>(T&);
 
-    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept;
+    void preVisit(int32_t id, const char *shortName, const char *longName) noexcept;
     void postVisit() noexcept;
 
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept;
-    void visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept;
+    void visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept;
 
     template <typename T>
-    void visit(uint32_t &id, std::string &&typeName, std::string &&name, T &value) noexcept {
+    void visit(uint32_t &id, const char *typeName, const char *name, T &value) noexcept {
         (void)typeName;
         (void)name;
 
-        toVarInt(m_buffer, std::move(encodeKey(id, static_cast<uint8_t>(ProtoConstants::LENGTH_DELIMITED))));
-        cluon::ToProtoVisitor nestedProtoEncoder;
-        value.accept(nestedProtoEncoder);
-        encode(m_buffer, std::move(nestedProtoEncoder.encodedData()));
+        toVarInt(m_buffer, encodeKey(id, static_cast<uint8_t>(ProtoConstants::LENGTH_DELIMITED)));
+        // Write the length of the nested message first and encode it in place afterwards.
+        cluon::ProtoSizeVisitor nestedProtoSize;
+        value.accept(nestedProtoSize);
+        toVarInt(m_buffer, nestedProtoSize.encodedSize());
+        value.accept(*this);
+    }
+
+    // The following methods forward the names to the methods above for
+    // messages that pass them as std::string.
+    void preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+        preVisit(id, shortName.c_str(), longName.c_str());
+    }
+
+    template <typename T>
+    void visit(uint32_t id, std::string &&typeName, std::string &&name, T &value) noexcept {
+        visit(id, typeName.c_str(), name.c_str(), value);
     }
 
    private:
-    std::size_t encode(std::ostream &o, bool &v) noexcept;
-    std::size_t encode(std::ostream &o, int8_t &v) noexcept;
-    std::size_t encode(std::ostream &o, uint8_t &v) noexcept;
-    std::size_t encode(std::ostream &o, int16_t &v) noexcept;
-    std::size_t encode(std::ostream &o, uint16_t &v) noexcept;
-    std::size_t encode(std::ostream &o, int32_t &v) noexcept;
-    std::size_t encode(std::ostream &o, uint32_t &v) noexcept;
-    std::size_t encode(std::ostream &o, int64_t &v) noexcept;
-    std::size_t encode(std::ostream &o, uint64_t &v) noexcept;
-    std::size_t encode(std::ostream &o, float &v) noexcept;
-    std::size_t encode(std::ostream &o, double &v) noexcept;
-    std::size_t encode(std::ostream &o, const std::string &v) noexcept;
+    std::size_t encode(std::string &o, bool &v) noexcept;
+    std::size_t encode(std::string &o, int8_t &v) noexcept;
+    std::size_t encode(std::string &o, uint8_t &v) noexcept;
+    std::size_t encode(std::string &o, int16_t &v) noexcept;
+    std::size_t encode(std::string &o, uint16_t &v) noexcept;
+    std::size_t encode(std::string &o, int32_t &v) noexcept;
+    std::size_t encode(std::string &o, uint32_t &v) noexcept;
+    std::size_t encode(std::string &o, int64_t &v) noexcept;
+    std::size_t encode(std::string &o, uint64_t &v) noexcept;
+    std::size_t encode(std::string &o, float &v) noexcept;
+    std::size_t encode(std::string &o, double &v) noexcept;
+    std::size_t encode(std::string &o, const std::string &v) noexcept;
 
    private:
     uint8_t toZigZag8(int8_t v) noexcept;
@@ -91,11 +147,11 @@ class LIBCLUON_API ToProtoVisitor {
     /**
      * This method encodes a given value in VarInt.
      *
-     * @param out std::ostream to encode to.
+     * @param out std::string to append to.
      * @param v Value to encode.
      * @return Bytes written.
      */
-    std::size_t toVarInt(std::ostream &out, uint64_t v) noexcept;
+    std::size_t toVarInt(std::string &out, uint64_t v) noexcept;
 
     /**
      * This method creates a key/value pair encoded in Proto format.
@@ -123,7 +179,7 @@ class LIBCLUON_API ToProtoVisitor {
     uint64_t encodeKey(uint32_t fieldIdentifier, uint8_t protoType) noexcept;
 
    private:
-    std::stringstream m_buffer{""};
+    std::string m_buffer{};
 };
 } // namespace cluon
 
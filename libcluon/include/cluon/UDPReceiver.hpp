@@ -9,7 +9,9 @@
 #ifndef CLUON_UDPRECEIVER_HPP
 #define CLUON_UDPRECEIVER_HPP
 
+#include "cluon/BufferPool.hpp"
 #include "cluon/NotifyingPipeline.hpp"
+#include "cluon/Reactor.hpp"
 #include "cluon/cluon.hpp"
 
 // clang-format off
@@ -17,10 +19,16 @@
     #include <Winsock2.h> // for WSAStartUp
     #include <ws2tcpip.h> // for SOCKET
 #else
+    #ifdef __linux__
+        #include <linux/filter.h>
+        #include <sys/socket.h>
+        #include <sys/uio.h>
+    #endif
     #include <netinet/in.h>
 #endif
 // clang-format on
 
+#include <cstddef>
 #include <cstdint>
 #include <atomic>
 #include <condition_variable>
@@ -32,6 +40,7 @@
 #include <set>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace cluon {
 /**
@@ -63,11 +72,62 @@ cluon::UDPReceiver receiver("127.0.0.1", 1234,
     });
 \endcode
 
+To avoid copying the received bytes, a delegate of type
+`std::function<void(cluon::PooledBuffer &&, const struct sockaddr_in &, std::chrono::system_clock::time_point &&)>`
+can be passed instead. The datagrams are then read directly into slabs of a
+pre-allocated cluon::BufferPool and handed over as move-only cluon::PooledBuffer;
+a slab is recycled as soon as the cluon::PooledBuffer is destroyed:
+
+\code{.cpp}
+cluon::UDPReceiver receiver("127.0.0.1", 1234,
+    [](cluon::PooledBuffer &&data, const struct sockaddr_in &sender, std::chrono::system_clock::time_point &&ts) noexcept {
+        std::cout << "Received " << data.size() << " bytes." << std::endl;
+    });
+\endcode
+
+On Linux, an optional last constructor parameter specifies how many datagrams
+shall be drained from the socket per system call. When set to a value larger
+than 1, `recvmmsg` is used and the kernel time stamps are taken from the
+`SO_TIMESTAMPNS` control messages that are delivered alongside each datagram;
+on other platforms, this parameter is ignored:
+
+\code{.cpp}
+// Receive up to 32 datagrams per system call.
+cluon::UDPReceiver receiver("225.0.0.111", 12175, delegate, 0, 32);
+\endcode
+
+Received datagrams are queued for the delegate in a bounded pipeline. When
+the delegate is slower than the network and the pipeline is full, the oldest
+waiting datagram is discarded in favor of the newest one ("latest wins");
+this behavior can be changed with `setOverflowPolicy(...)` and the number of
+queued and dropped datagrams can be queried with `pipelineStatistics()`:
+
+\code{.cpp}
+receiver.setOverflowPolicy(cluon::NotifyingPipelineOverflowPolicy::BLOCK);
+cluon::NotifyingPipelineStatistics stats = receiver.pipelineStatistics();
+\endcode
+
 After creating an instance of class `cluon::UDPReceiver`, it is immediately
 activated and concurrently waiting for data in a separate thread. To check
 whether the instance was created successfully and running, the method
 `isRunning()` should be called.
 
+By default, every UDPReceiver waits for data in its own cluon::Reactor. To
+receive from many sockets with only one thread, a shared cluon::Reactor can
+be passed as first constructor parameter; in this case, the delegates of all
+UDPReceivers sharing the Reactor are called one after another:
+
+\code{.cpp}
+auto reactor = std::make_shared<cluon::Reactor>();
+cluon::UDPReceiver receiverA(reactor, "225.0.0.111", 12175, delegateA);
+cluon::UDPReceiver receiverB(reactor, "225.0.0.112", 12175, delegateB);
+\endcode
+
+When many datagrams of equal size are received from the same sender, the
+kernel can coalesce them into one buffer with `enableReceiveOffload(true)`
+(Linux only); the coalesced buffer is split again before the datagrams are
+queued so that the delegate is not affected.
+
 A complete example is available
 [here](https://github.com/chrberger/libcluon/blob/master/libcluon/examples/cluon-UDPReceiver.cpp).
 */
@@ -86,11 +146,76 @@ class LIBCLUON_API UDPReceiver {
      * @param receiveFromPort Port to receive UDP packets from.
      * @param delegate Functional (noexcept) to handle received bytes; parameters are received data, sender, timestamp.
      * @param localSendFromPort Port that an application is using to send data. This port (> 0) is ignored when data is received.
+     * @param receiveBatchSize Maximum number of datagrams to be read per system call (Linux only; 1 = one recvfrom per datagram).
      */
     UDPReceiver(const std::string &receiveFromAddress,
                 uint16_t receiveFromPort,
                 std::function<void(std::string &&, std::string &&, std::chrono::system_clock::time_point &&)> delegate,
-                uint16_t localSendFromPort = 0) noexcept;
+                uint16_t localSendFromPort = 0,
+                uint16_t receiveBatchSize  = 1) noexcept;
+
+    /**
+     * Constructor for receiving datagrams without copying them.
+     *
+     * @param receiveFromAddress Numerical IPv4 address to receive UDP packets from.
+     * @param receiveFromPort Port to receive UDP packets from.
+     * @param delegate Functional (noexcept) to handle received bytes; parameters are the pooled buffer holding the received data, sender, timestamp.
+     * @param localSendFromPort Port that an application is using to send data. This port (> 0) is ignored when data is received.
+     * @param receiveBatchSize Maximum number of datagrams to be read per system call (Linux only; 1 = one recvfrom per datagram).
+     */
+    UDPReceiver(const std::string &receiveFromAddress,
+                uint16_t receiveFromPort,
+                std::function<void(cluon::PooledBuffer &&, const struct sockaddr_in &, std::chrono::system_clock::time_point &&)> delegate,
+                uint16_t localSendFromPort = 0,
+                uint16_t receiveBatchSize  = 1) noexcept;
+
+    /**
+     * Constructor without delegate; received data is discarded.
+     *
+     * @param receiveFromAddress Numerical IPv4 address to receive UDP packets from.
+     * @param receiveFromPort Port to receive UDP packets from.
+     * @param localSendFromPort Port that an application is using to send data. This port (> 0) is ignored when data is received.
+     * @param receiveBatchSize Maximum number of datagrams to be read per system call (Linux only; 1 = one recvfrom per datagram).
+     */
+    UDPReceiver(const std::string &receiveFromAddress,
+                uint16_t receiveFromPort,
+                std::nullptr_t,
+                uint16_t localSendFromPort = 0,
+                uint16_t receiveBatchSize  = 1) noexcept;
+
+    /**
+     * Constructor to wait for data in a shared Reactor.
+     *
+     * @param reactor Reactor that waits for data on this UDPReceiver's socket.
+     * @param receiveFromAddress Numerical IPv4 address to receive UDP packets from.
+     * @param receiveFromPort Port to receive UDP packets from.
+     * @param delegate Functional (noexcept) to handle received bytes; parameters are received data, sender, timestamp.
+     * @param localSendFromPort Port that an application is using to send data. This port (> 0) is ignored when data is received.
+     * @param receiveBatchSize Maximum number of datagrams to be read per system call (Linux only; 1 = one recvfrom per datagram).
+     */
+    UDPReceiver(std::shared_ptr<cluon::Reactor> reactor,
+                const std::string &receiveFromAddress,
+                uint16_t receiveFromPort,
+                std::function<void(std::string &&, std::string &&, std::chrono::system_clock::time_point &&)> delegate,
+                uint16_t localSendFromPort = 0,
+                uint16_t receiveBatchSize  = 1) noexcept;
+
+    /**
+     * Constructor to wait for data in a shared Reactor without copying the received datagrams.
+     *
+     * @param reactor Reactor that waits for data on this UDPReceiver's socket.
+     * @param receiveFromAddress Numerical IPv4 address to receive UDP packets from.
+     * @param receiveFromPort Port to receive UDP packets from.
+     * @param delegate Functional (noexcept) to handle received bytes; parameters are the pooled buffer holding the received data, sender, timestamp.
+     * @param localSendFromPort Port that an application is using to send data. This port (> 0) is ignored when data is received.
+     * @param receiveBatchSize Maximum number of datagrams to be read per system call (Linux only; 1 = one recvfrom per datagram).
+     */
+    UDPReceiver(std::shared_ptr<cluon::Reactor> reactor,
+                const std::string &receiveFromAddress,
+                uint16_t receiveFromPort,
+                std::function<void(cluon::PooledBuffer &&, const struct sockaddr_in &, std::chrono::system_clock::time_point &&)> delegate,
+                uint16_t localSendFromPort = 0,
+                uint16_t receiveBatchSize  = 1) noexcept;
     ~UDPReceiver() noexcept;
 
     /**
@@ -98,7 +223,65 @@ class LIBCLUON_API UDPReceiver {
      */
     bool isRunning() const noexcept;
 
+    /**
+     * This method changes how the pipeline to the delegate behaves when it is full.
+     *
+     * @param overflowPolicy Policy to apply.
+     */
+    void setOverflowPolicy(cluon::NotifyingPipelineOverflowPolicy overflowPolicy) noexcept;
+
+    /**
+     * @return Counters of the pipeline to the delegate.
+     */
+    cluon::NotifyingPipelineStatistics pipelineStatistics() const noexcept;
+
+    /**
+     * @return Number of datagrams that were received into an individual heap
+     *         allocation as all pre-allocated slabs were in use.
+     */
+    uint64_t numberOfOverflowAllocations() const noexcept;
+
+    /**
+     * This method enables UDP receive offload (Linux 5.0 or newer): the
+     * kernel may coalesce consecutive datagrams from the same sender into
+     * one buffer, which is split into the original datagrams again before
+     * they are queued for the delegate. Thus, the delegate still receives
+     * one call per datagram.
+     *
+     * @param enable true to enable receive offload.
+     * @return true if receive offload is enabled or was disabled.
+     */
+    bool enableReceiveOffload(bool enable) noexcept;
+
+#ifdef __linux__
+    /**
+     * This method attaches a classic BPF program to the socket so that the
+     * kernel discards unwanted datagrams before they reach user space; an
+     * already attached program is replaced. The program is run with the UDP
+     * header at offset 0; thus, the payload starts at offset 8.
+     *
+     * @param program BPF instructions to attach.
+     * @return true if the program was attached.
+     */
+    bool attachSocketFilter(const std::vector<struct sock_filter> &program) noexcept;
+
+    /**
+     * This method removes a BPF program from the socket.
+     *
+     * @return true if a program was removed.
+     */
+    bool detachSocketFilter() noexcept;
+#endif
+
    private:
+    UDPReceiver(std::shared_ptr<cluon::Reactor> reactor,
+                const std::string &receiveFromAddress,
+                uint16_t receiveFromPort,
+                std::function<void(std::string &&, std::string &&, std::chrono::system_clock::time_point &&)> delegate,
+                std::function<void(cluon::PooledBuffer &&, const struct sockaddr_in &, std::chrono::system_clock::time_point &&)> pooledBufferDelegate,
+                uint16_t localSendFromPort,
+                uint16_t receiveBatchSize) noexcept;
+
     /**
      * This method closes the socket.
      *
@@ -106,8 +289,32 @@ class LIBCLUON_API UDPReceiver {
      */
     void closeSocket(int errorCode) noexcept;
 
+    /**
+     * This method is called from the Reactor whenever the socket is readable.
+     * It reads a limited number of datagrams per call; remaining datagrams
+     * are read when the Reactor calls again.
+     */
     void readFromSocket() noexcept;
 
+#ifdef __linux__
+    /**
+     * This method reads up to m_receiveBatchSize datagrams with one call to recvmmsg
+     * and splits buffers that were coalesced by receive offload.
+     *
+     * @return Number of bytes read in total.
+     */
+    ssize_t readBatchFromSocket() noexcept;
+#endif
+
+    /**
+     * This method adds a received datagram to the pipeline unless it was sent from us.
+     *
+     * @param data Buffer holding the received bytes.
+     * @param remote Address of the sender.
+     * @param timestamp Time point when the datagram was received.
+     */
+    void addToPipeline(cluon::PooledBuffer &&data, const struct sockaddr_storage &remote, const std::chrono::system_clock::time_point &timestamp) noexcept;
+
    private:
     int32_t m_socket{-1};
     bool m_isBlockingSocket{true};
@@ -116,18 +323,38 @@ class LIBCLUON_API UDPReceiver {
     struct sockaddr_in m_receiveFromAddress {};
     struct ip_mreq m_mreq {};
     bool m_isMulticast{false};
+    uint16_t m_receiveBatchSize{1};
+
+    std::atomic<bool> m_isReadingFromSocket{false};
+    std::atomic<bool> m_isReceiveOffloadEnabled{false};
+    std::shared_ptr<cluon::Reactor> m_reactor{};
 
-    std::atomic<bool> m_readFromSocketThreadRunning{false};
-    std::thread m_readFromSocketThread{};
+#ifdef __linux__
+    // Data structures for recvmmsg that are reused for every call.
+    std::vector<cluon::PooledBuffer> m_batchSlabs{};
+    std::vector<char> m_batchControls{};
+    std::vector<struct sockaddr_storage> m_batchRemotes{};
+    std::vector<struct iovec> m_batchIovecs{};
+    std::vector<struct mmsghdr> m_batchMessages{};
+    std::vector<cluon::PooledBuffer> m_batchSegments{};
+#endif
 
    private:
     std::function<void(std::string &&, std::string &&, std::chrono::system_clock::time_point)> m_delegate{};
+    std::function<void(cluon::PooledBuffer &&, const struct sockaddr_in &, std::chrono::system_clock::time_point &&)> m_pooledBufferDelegate{};
 
    private:
+    enum {
+        PIPELINE_CAPACITY = 1024, // The buffer pool provides a slab for every waiting datagram.
+        MAX_NUMBER_OF_DATAGRAMS_PER_WAKEUP = 64, // Other sockets in a shared Reactor are not starved.
+    };
+
+    std::shared_ptr<cluon::BufferPool> m_bufferPool{};
+
     class PipelineEntry {
        public:
-        std::string m_data;
-        std::string m_from;
+        cluon::PooledBuffer m_data;
+        struct sockaddr_in m_from {};
         std::chrono::system_clock::time_point m_sampleTime;
     };
 
@@ -16,14 +16,25 @@
     #include <Winsock2.h> // for WSAStartUp
     #include <ws2tcpip.h> // for SOCKET
 #else
+    #ifdef __linux__
+        #include <sys/socket.h>
+        #include <sys/uio.h>
+    #endif
     #include <netinet/in.h>
 #endif
 // clang-format on
 
+#include <cstddef>
 #include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace cluon {
 /**
@@ -50,6 +61,31 @@ std::pair<ssize_t, int32_t> retVal = sender.send(std::move("Hello World!"));
 std::cout << "Send " << retVal.first << " bytes, error code = " << retVal.second << std::endl;
 \endcode
 
+To send many small datagrams, they can be passed together as `std::vector`;
+on Linux, they are then handed over to the kernel with one call to `sendmmsg`
+and the result for every datagram is returned in the same order:
+
+\code{.cpp}
+std::vector<std::string> datagrams{"Hello", "World"};
+std::vector<std::pair<ssize_t, int32_t>> retVals = sender.send(std::move(datagrams));
+\endcode
+
+Alternatively, datagrams can be queued with `enqueue(...)` without blocking
+the caller on the socket. The queue is sent as one batch when it holds the
+configured number of datagrams, when the oldest datagram has waited for the
+configured delay, or when `flush()` is called. As the datagrams are sent
+later, their results are passed to an optional delegate:
+
+\code{.cpp}
+// Send at the latest when 32 datagrams are waiting or after 1ms.
+sender.setFlushPolicy(32, std::chrono::microseconds(1000),
+    [](std::vector<std::pair<ssize_t, int32_t>> &&retVals) noexcept {
+        // Check retVals[i].second for errors.
+    });
+sender.enqueue("Hello");
+sender.enqueue("World");
+\endcode
+
 A complete example is available
 [here](https://github.com/chrberger/libcluon/blob/master/libcluon/examples/cluon-UDPSender.cpp).
 */
@@ -78,6 +114,61 @@ class LIBCLUON_API UDPSender {
      */
     std::pair<ssize_t, int32_t> send(std::string &&data) const noexcept;
 
+    /**
+     * Send the given bytes; the bytes are not retained after this method
+     * returns so that the caller can reuse its buffer.
+     *
+     * @param data Pointer to the bytes to send.
+     * @param length Number of bytes to send.
+     * @return Pair: Number of bytes sent and errno.
+     */
+    std::pair<ssize_t, int32_t> send(const char *data, std::size_t length) const noexcept;
+
+    /**
+     * Send several given strings as separate datagrams with as few system calls as possible.
+     *
+     * @param data Datagrams to send.
+     * @return Pair per datagram in the same order: Number of bytes sent and errno.
+     */
+    std::vector<std::pair<ssize_t, int32_t>> send(std::vector<std::string> &&data) const noexcept;
+
+    /**
+     * This method sets when queued datagrams are sent.
+     *
+     * @param maxNumberOfQueuedDatagrams Send the queue as soon as this many datagrams are waiting (> 0).
+     * @param maxDelay Send the queue as soon as the oldest datagram has waited this long; 0 disables the deadline.
+     * @param flushResultDelegate Functional (noexcept) to receive the pairs of sent bytes and errno per datagram for every sent queue.
+     */
+    void setFlushPolicy(uint32_t maxNumberOfQueuedDatagrams,
+                        std::chrono::microseconds maxDelay,
+                        std::function<void(std::vector<std::pair<ssize_t, int32_t>> &&)> flushResultDelegate = nullptr) noexcept;
+
+    /**
+     * Queue a given string to be sent according to the flush policy.
+     *
+     * @param data Data to send.
+     * @return Pair: Number of bytes queued and errno in case the data cannot be sent at all.
+     */
+    std::pair<ssize_t, int32_t> enqueue(std::string &&data) noexcept;
+
+    /**
+     * Send all queued datagrams now.
+     *
+     * @return Pair per datagram in the same order: Number of bytes sent and errno.
+     */
+    std::vector<std::pair<ssize_t, int32_t>> flush() noexcept;
+
+    /**
+     * This method enables UDP segmentation offload (Linux 4.18 or newer) for
+     * sending several datagrams at once: consecutive datagrams of the same
+     * size are handed over to the kernel as one buffer that is split into
+     * datagrams as late as possible, ideally by the network card.
+     *
+     * @param enable true to enable segmentation offload.
+     * @return true if segmentation offload is enabled or was disabled.
+     */
+    bool enableSegmentationOffload(bool enable) noexcept;
+
    public:
     /**
      * @return Port that this UDP sender will use for sending or 0 if no information available.
@@ -85,10 +176,59 @@ class LIBCLUON_API UDPSender {
     uint16_t getSendFromPort() const noexcept;
 
    private:
+    /**
+     * This method sends the given datagrams; m_socketMutex must be held.
+     *
+     * @param data Datagrams to send.
+     * @return Pair per datagram in the same order: Number of bytes sent and errno.
+     */
+    std::vector<std::pair<ssize_t, int32_t>> sendBatch(std::vector<std::string> &data) const noexcept;
+
+    /**
+     * This method sends all queued datagrams.
+     *
+     * @param lck Lock on m_queueMutex that is released when this method returns.
+     * @return Pair per datagram in the same order: Number of bytes sent and errno.
+     */
+    std::vector<std::pair<ssize_t, int32_t>> flushQueue(std::unique_lock<std::mutex> &lck) noexcept;
+
+    /**
+     * This method sends the queue when the oldest datagram reached the deadline.
+     */
+    void flushOnDeadline() noexcept;
+
+   private:
+    enum {
+        DEFAULT_MAX_NUMBER_OF_QUEUED_DATAGRAMS = 64,
+        MAX_DATAGRAMS_PER_SYSTEM_CALL          = 1024, // UIO_MAXIOV.
+        MAX_SEGMENTS_PER_DATAGRAM              = 64,   // UDP_MAX_SEGMENTS.
+    };
+
     mutable std::mutex m_socketMutex{};
     int32_t m_socket{-1};
     uint16_t m_portToSentFrom{0};
     struct sockaddr_in m_sendToAddress {};
+
+#ifdef __linux__
+    // Data structures for sendmmsg that are reused for every call; protected by m_socketMutex.
+    mutable std::vector<struct mmsghdr> m_messages{};
+    mutable std::vector<struct iovec> m_iovecs{};
+    mutable std::vector<std::size_t> m_datagramIndices{};
+    mutable std::vector<uint16_t> m_numberOfSegments{};
+    mutable std::vector<char> m_segmentControls{};
+#endif
+    std::atomic<bool> m_isSegmentationOffloadEnabled{false};
+
+    std::mutex m_queueMutex{};
+    std::condition_variable m_queueCondition{};
+    std::vector<std::string> m_queue{};
+    std::chrono::steady_clock::time_point m_oldestQueuedDatagram{};
+    uint32_t m_maxNumberOfQueuedDatagrams{DEFAULT_MAX_NUMBER_OF_QUEUED_DATAGRAMS};
+    std::chrono::microseconds m_maxDelay{0};
+    std::function<void(std::vector<std::pair<ssize_t, int32_t>> &&)> m_flushResultDelegate{nullptr};
+
+    std::atomic<bool> m_flushThreadRunning{false};
+    std::thread m_flushThread{};
 };
 } // namespace cluon
 
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2017-2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "cluon/BufferPool.hpp"
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace cluon {
+
+PooledBuffer::PooledBuffer(std::shared_ptr<BufferPool> pool, char *data, uint32_t slab, std::size_t capacity) noexcept
+    : m_pool(std::move(pool))
+    , m_data(data)
+    , m_slab(slab)
+    , m_capacity(capacity)
+    , m_size(0) {}
+
+PooledBuffer::PooledBuffer(PooledBuffer &&other) noexcept
+    : m_pool(std::move(other.m_pool))
+    , m_overflow(std::move(other.m_overflow))
+    , m_data(other.m_data)
+    , m_slab(other.m_slab)
+    , m_capacity(other.m_capacity)
+    , m_size(other.m_size) {
+    other.m_data     = nullptr;
+    other.m_capacity = 0;
+    other.m_size     = 0;
+}
+
+PooledBuffer &PooledBuffer::operator=(PooledBuffer &&other) noexcept {
+    if (this != &other) {
+        release();
+        m_pool     = std::move(other.m_pool);
+        m_overflow = std::move(other.m_overflow);
+        m_data     = other.m_data;
+        m_slab     = other.m_slab;
+        m_capacity = other.m_capacity;
+        m_size     = other.m_size;
+
+        other.m_data     = nullptr;
+        other.m_capacity = 0;
+        other.m_size     = 0;
+    }
+    return *this;
+}
+
+PooledBuffer::~PooledBuffer() noexcept {
+    release();
+}
+
+char *PooledBuffer::data() noexcept {
+    return m_data;
+}
+
+const char *PooledBuffer::data() const noexcept {
+    return m_data;
+}
+
+std::size_t PooledBuffer::size() const noexcept {
+    return m_size;
+}
+
+std::size_t PooledBuffer::capacity() const noexcept {
+    return m_capacity;
+}
+
+void PooledBuffer::resize(std::size_t size) noexcept {
+    m_size = (std::min)(size, m_capacity);
+}
+
+void PooledBuffer::release() noexcept {
+    if (m_pool) {
+        m_pool->release(m_slab);
+        m_pool.reset();
+    }
+    m_overflow.reset();
+    m_data     = nullptr;
+    m_capacity = 0;
+    m_size     = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+BufferPool::BufferPool(uint32_t numberOfSlabs, std::size_t slabSize) noexcept
+    : m_slabSize(slabSize)
+    , m_slabs(new (std::nothrow) char[static_cast<std::size_t>(numberOfSlabs) * slabSize]) {
+    if (m_slabs) {
+        try {
+            // The free list is used as stack so that recently returned slabs are handed out first.
+            m_freeSlabs.reserve(numberOfSlabs);
+            for (uint32_t i{numberOfSlabs}; i > 0; i--) {
+                m_freeSlabs.push_back(i - 1);
+            }
+        } catch (...) { m_freeSlabs.clear(); } // LCOV_EXCL_LINE
+    }
+}
+
+PooledBuffer BufferPool::acquire() noexcept {
+    bool hasFreeSlab{false};
+    uint32_t slab{0};
+    {
+        std::lock_guard<std::mutex> lck(m_freeSlabsMutex);
+        if (!m_freeSlabs.empty()) {
+            slab = m_freeSlabs.back();
+            m_freeSlabs.pop_back();
+            hasFreeSlab = true;
+        }
+    }
+
+    if (hasFreeSlab) {
+        return PooledBuffer(shared_from_this(), &m_slabs[static_cast<std::size_t>(slab) * m_slabSize], slab, m_slabSize);
+    }
+
+    // All slabs are borrowed; fall back to the heap.
+    m_numberOfOverflowAllocations++;
+    PooledBuffer buffer;
+    buffer.m_overflow.reset(new (std::nothrow) char[m_slabSize]);
+    if (buffer.m_overflow) {
+        buffer.m_data     = buffer.m_overflow.get();
+        buffer.m_capacity = m_slabSize;
+    }
+    return buffer;
+}
+
+void BufferPool::release(uint32_t slab) noexcept {
+    std::lock_guard<std::mutex> lck(m_freeSlabsMutex);
+    // The capacity was reserved for all slabs upfront; thus, no allocation happens here.
+    m_freeSlabs.push_back(slab);
+}
+
+std::size_t BufferPool::slabSize() const noexcept {
+    return m_slabSize;
+}
+
+uint32_t BufferPool::numberOfAvailableSlabs() const noexcept {
+    std::lock_guard<std::mutex> lck(m_freeSlabsMutex);
+    return static_cast<uint32_t>(m_freeSlabs.size());
+}
+
+uint64_t BufferPool::numberOfOverflowAllocations() const noexcept {
+    return m_numberOfOverflowAllocations.load();
+}
+
+} // namespace cluon
@@ -83,10 +83,6 @@ std::string EnvelopeConverter::getJSONFromEnvelope(cluon::data::Envelope &envelo
             ToJSONVisitor envelopeToJSON{OUTER_CURLY_BRACES, mask};
             envelope.accept(envelopeToJSON);
 
-            std::stringstream sstr{envelope.serializedData()};
-            cluon::FromProtoVisitor protoDecoder;
-            protoDecoder.decodeFrom(sstr);
-
             // Now, create JSON from payload.
             cluon::MetaMessage payload{m_scopeOfMetaMessages[envelope.dataType()]};
             cluon::GenericMessage gm;
@@ -94,8 +90,9 @@ std::string EnvelopeConverter::getJSONFromEnvelope(cluon::data::Envelope &envelo
             // Create "empty" GenericMessage from this MetaMessage.
             gm.createFrom(payload, m_listOfMetaMessages);
 
-            // Set values in the newly created GenericMessage from ProtoDecoder.
-            gm.accept(protoDecoder);
+            // Set values in the newly created GenericMessage directly while decoding.
+            cluon::FromProtoVisitor protoDecoder;
+            protoDecoder.decodeFrom(envelope.serializedData().data(), envelope.serializedData().size(), gm);
 
             ToJSONVisitor payloadToJSON{OUTER_CURLY_BRACES};
             try {
@@ -151,7 +148,7 @@ std::string EnvelopeConverter::getProtoEncodedEnvelopeFromJSON(const std::string
         gm.accept(protoEncoder);
 
         cluon::data::Envelope env;
-        env.dataType(messageIdentifier).serializedData(protoEncoder.encodedData()).senderStamp(senderStamp).sampleTimeStamp(sampleTimeStamp);
+        env.dataType(messageIdentifier).serializedData(protoEncoder.releaseEncodedData()).senderStamp(senderStamp).sampleTimeStamp(sampleTimeStamp);
 
         retVal = cluon::serializeEnvelope(std::move(env));
     }
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2017-2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "cluon/FragmentAssembler.hpp"
+#include "cluon/PortableEndian.hpp"
+#include "cluon/ProtoConstants.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+namespace cluon {
+
+FragmentAssembler::FragmentAssembler(uint32_t maxNumberOfBufferedBytes, std::chrono::milliseconds timeout) noexcept
+    : m_maxNumberOfBufferedBytes(maxNumberOfBufferedBytes)
+    , m_timeout(timeout) {}
+
+bool FragmentAssembler::isFragment(const char *data, std::size_t length) noexcept {
+    constexpr uint8_t FRAGMENT_HEADER_BYTE0{0x0D};
+    constexpr uint8_t FRAGMENT_HEADER_BYTE1{0xA5};
+    constexpr std::size_t OD4_HEADER_SIZE{5};
+    return ((nullptr != data) && (OD4_HEADER_SIZE < length) && (FRAGMENT_HEADER_BYTE0 == static_cast<uint8_t>(data[0]))
+            && (FRAGMENT_HEADER_BYTE1 == static_cast<uint8_t>(data[1])));
+}
+
+std::vector<std::string> FragmentAssembler::fragment(const std::string &serializedEnvelope,
+                                                     int32_t dataType,
+                                                     uint32_t sequenceNumber,
+                                                     std::size_t maxDatagramSize) noexcept {
+    constexpr uint8_t FRAGMENT_HEADER_BYTE0{0x0D};
+    constexpr uint8_t FRAGMENT_HEADER_BYTE1{0xA5};
+    constexpr std::size_t OD4_HEADER_SIZE{5};
+    constexpr uint8_t DATATYPE_KEY{(1 << 3) | static_cast<uint8_t>(ProtoConstants::VARINT)};
+    constexpr std::size_t FIELDS_SIZE{sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint32_t)};
+    constexpr std::size_t MAX_LENGTH{0xFFFFFF}; // LEN0 LEN1 LEN2
+    std::vector<std::string> retVal;
+
+    // The dataType is repeated as ZigZag-encoded VarInt right after the first five bytes.
+    std::string dataTypeField(1, static_cast<char>(DATATYPE_KEY));
+    uint32_t zigZag{(static_cast<uint32_t>(dataType) << 1) ^ static_cast<uint32_t>(dataType >> 31)};
+    while (0x80 <= zigZag) {
+        dataTypeField.push_back(static_cast<char>((zigZag & 0x7F) | 0x80));
+        zigZag >>= 7;
+    }
+    dataTypeField.push_back(static_cast<char>(zigZag));
+
+    const std::size_t HEADER_SIZE{OD4_HEADER_SIZE + dataTypeField.size() + FIELDS_SIZE};
+    const std::size_t TOTAL_LENGTH{serializedEnvelope.size()};
+    // The receiver cannot decode Envelopes whose length does not fit into the OD4 header.
+    if ((0 == TOTAL_LENGTH) || (maxDatagramSize <= HEADER_SIZE) || (OD4_HEADER_SIZE + MAX_LENGTH < TOTAL_LENGTH)) {
+        return retVal;
+    }
+
+    const std::size_t MAX_PAYLOAD{(std::min)(maxDatagramSize - HEADER_SIZE, MAX_LENGTH - HEADER_SIZE)};
+    const std::size_t NUMBER_OF_FRAGMENTS{(TOTAL_LENGTH + MAX_PAYLOAD - 1) / MAX_PAYLOAD};
+    if (0xFFFF < NUMBER_OF_FRAGMENTS) {
+        return retVal;
+    }
+    // Spread the bytes evenly so that the receiver can compute every fragment's offset.
+    const std::size_t STRIDE{(TOTAL_LENGTH + NUMBER_OF_FRAGMENTS - 1) / NUMBER_OF_FRAGMENTS};
+
+    try {
+        retVal.reserve(NUMBER_OF_FRAGMENTS);
+        for (std::size_t i{0}; i < NUMBER_OF_FRAGMENTS; i++) {
+            const std::size_t OFFSET{i * STRIDE};
+            const std::size_t PAYLOAD_LENGTH{(std::min)(STRIDE, TOTAL_LENGTH - OFFSET)};
+
+            std::string f;
+            f.reserve(HEADER_SIZE + PAYLOAD_LENGTH);
+            f.push_back(static_cast<char>(FRAGMENT_HEADER_BYTE0));
+            f.push_back(static_cast<char>(FRAGMENT_HEADER_BYTE1));
+            const uint32_t LENGTH{htole32(static_cast<uint32_t>(HEADER_SIZE - OD4_HEADER_SIZE + PAYLOAD_LENGTH))};
+            f.append(reinterpret_cast<const char *>(&LENGTH), 3); // NOLINT
+            f.append(dataTypeField);
+
+            const uint32_t SEQUENCE_NUMBER{htole32(sequenceNumber)};
+            const uint16_t INDEX{htole16(static_cast<uint16_t>(i))};
+            const uint16_t COUNT{htole16(static_cast<uint16_t>(NUMBER_OF_FRAGMENTS))};
+            const uint32_t TOTAL{htole32(static_cast<uint32_t>(TOTAL_LENGTH))};
+            f.append(reinterpret_cast<const char *>(&SEQUENCE_NUMBER), sizeof(uint32_t)); // NOLINT
+            f.append(reinterpret_cast<const char *>(&INDEX), sizeof(uint16_t));           // NOLINT
+            f.append(reinterpret_cast<const char *>(&COUNT), sizeof(uint16_t));           // NOLINT
+            f.append(reinterpret_cast<const char *>(&TOTAL), sizeof(uint32_t));           // NOLINT
+
+            f.append(serializedEnvelope, OFFSET, PAYLOAD_LENGTH);
+            retVal.emplace_back(std::move(f));
+        }
+    } catch (...) { retVal.clear(); } // LCOV_EXCL_LINE
+
+    return retVal;
+}
+
+std::pair<bool, std::string> FragmentAssembler::add(const char *data,
+                                                    std::size_t length,
+                                                    uint64_t sender,
+                                                    std::chrono::steady_clock::time_point now) noexcept {
+    constexpr std::size_t OD4_HEADER_SIZE{5};
+    constexpr uint8_t DATATYPE_KEY{(1 << 3) | static_cast<uint8_t>(ProtoConstants::VARINT)};
+    constexpr std::size_t MAX_VARINT_SIZE{5};
+    constexpr std::size_t FIELDS_SIZE{sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint32_t)};
+    constexpr std::size_t MAX_LENGTH{0xFFFFFF}; // LEN0 LEN1 LEN2
+    std::pair<bool, std::string> retVal{false, ""};
+    if (!isFragment(data, length)) {
+        return retVal;
+    }
+
+    // Parse and validate the header.
+    const uint8_t *bytes{reinterpret_cast<const uint8_t *>(data)}; // NOLINT
+    const std::size_t LENGTH{static_cast<std::size_t>(bytes[2]) | (static_cast<std::size_t>(bytes[3]) << 8) | (static_cast<std::size_t>(bytes[4]) << 16)};
+    if ((OD4_HEADER_SIZE + LENGTH != length) || (DATATYPE_KEY != bytes[OD4_HEADER_SIZE])) {
+        return retVal;
+    }
+    std::size_t position{OD4_HEADER_SIZE + 1};
+    while ((position < length) && (0 != (bytes[position] & 0x80))) {
+        position++;
+    }
+    position++;
+    if ((OD4_HEADER_SIZE + 1 + MAX_VARINT_SIZE < position) || (length < position + FIELDS_SIZE)) {
+        return retVal;
+    }
+
+    uint32_t sequenceNumber{0};
+    uint16_t index{0};
+    uint16_t count{0};
+    uint32_t totalLength{0};
+    std::memcpy(&sequenceNumber, bytes + position, sizeof(uint32_t)); /* Flawfinder: ignore */ // NOLINT
+    std::memcpy(&index, bytes + position + 4, sizeof(uint16_t));       /* Flawfinder: ignore */ // NOLINT
+    std::memcpy(&count, bytes + position + 6, sizeof(uint16_t));       /* Flawfinder: ignore */ // NOLINT
+    std::memcpy(&totalLength, bytes + position + 8, sizeof(uint32_t)); /* Flawfinder: ignore */ // NOLINT
+    sequenceNumber = le32toh(sequenceNumber);
+    index          = le16toh(index);
+    count          = le16toh(count);
+    totalLength    = le32toh(totalLength);
+    position += FIELDS_SIZE;
+
+    if ((0 == count) || (count <= index) || (0 == totalLength) || (OD4_HEADER_SIZE + MAX_LENGTH < totalLength)) {
+        return retVal;
+    }
+    const std::size_t STRIDE{(static_cast<std::size_t>(totalLength) + count - 1) / count};
+    const std::size_t OFFSET{STRIDE * index};
+    if ((totalLength <= OFFSET) || ((std::min)(STRIDE, totalLength - OFFSET) != (length - position))) {
+        return retVal;
+    }
+
+    try {
+        std::lock_guard<std::mutex> lck(m_partialMessagesMutex);
+        evict(now, 0);
+
+        const auto KEY{std::make_pair(sender, sequenceNumber)};
+        auto it = m_partialMessages.find(KEY);
+        if (m_partialMessages.end() == it) {
+            if (m_maxNumberOfBufferedBytes < totalLength) {
+                // This message can never be completed.
+                m_statistics.numberOfEvictedMessages++;
+                return retVal;
+            }
+            evict(now, totalLength);
+
+            PartialMessage pm;
+            pm.m_data.resize(totalLength);
+            pm.m_receivedFragments.assign(count, false);
+            pm.m_numberOfMissingFragments = count;
+            pm.m_firstFragmentReceived    = now;
+            it                            = m_partialMessages.emplace(KEY, std::move(pm)).first;
+            m_statistics.numberOfBufferedBytes += totalLength;
+        } else if ((it->second.m_data.size() != totalLength) || (it->second.m_receivedFragments.size() != count)) {
+            // Inconsistent with the fragments received so far.
+            return retVal;
+        }
+
+        PartialMessage &pm{it->second};
+        if (!pm.m_receivedFragments[index]) {
+            std::memcpy(&pm.m_data[OFFSET], bytes + position, length - position); /* Flawfinder: ignore */ // NOLINT
+            pm.m_receivedFragments[index] = true;
+            pm.m_numberOfMissingFragments--;
+        }
+
+        if (0 == pm.m_numberOfMissingFragments) {
+            retVal.first  = true;
+            retVal.second = std::move(pm.m_data);
+            m_statistics.numberOfBufferedBytes -= totalLength;
+            m_statistics.numberOfReassembledMessages++;
+            m_partialMessages.erase(it);
+        }
+    } catch (...) { retVal = std::make_pair(false, std::string()); } // LCOV_EXCL_LINE
+
+    return retVal;
+}
+
+void FragmentAssembler::evict(std::chrono::steady_clock::time_point now, uint64_t numberOfBytesNeeded) noexcept {
+    for (auto it = m_partialMessages.begin(); it != m_partialMessages.end();) {
+        if (m_timeout < (now - it->second.m_firstFragmentReceived)) {
+            m_statistics.numberOfBufferedBytes -= it->second.m_data.size();
+            m_statistics.numberOfEvictedMessages++;
+            it = m_partialMessages.erase(it);
+        } else {
+            it++;
+        }
+    }
+
+    while (!m_partialMessages.empty() && (m_maxNumberOfBufferedBytes < m_statistics.numberOfBufferedBytes + numberOfBytesNeeded)) {
+        auto oldest = std::min_element(m_partialMessages.begin(), m_partialMessages.end(), [](const decltype(m_partialMessages)::value_type &a, const decltype(m_partialMessages)::value_type &b) {
+            return a.second.m_firstFragmentReceived < b.second.m_firstFragmentReceived;
+        });
+        m_statistics.numberOfBufferedBytes -= oldest->second.m_data.size();
+        m_statistics.numberOfEvictedMessages++;
+        m_partialMessages.erase(oldest);
+    }
+}
+
+FragmentAssemblerStatistics FragmentAssembler::statistics() const noexcept {
+    std::lock_guard<std::mutex> lck(m_partialMessagesMutex);
+    FragmentAssemblerStatistics retVal{m_statistics};
+    retVal.numberOfIncompleteMessages = m_partialMessages.size();
+    return retVal;
+}
+} // namespace cluon
@@ -23,14 +23,14 @@ namespace cluon {
 FromJSONVisitor::FromJSONVisitor() noexcept
     : m_keyValues{m_data} {}
 
-FromJSONVisitor::FromJSONVisitor(std::map<std::string, FromJSONVisitor::JSONKeyValue> &preset) noexcept
+FromJSONVisitor::FromJSONVisitor(std::map<std::string, FromJSONVisitor::JSONKeyValue, std::less<>> &preset) noexcept
     : m_keyValues{preset} {}
 
-std::map<std::string, FromJSONVisitor::JSONKeyValue> FromJSONVisitor::readKeyValues(std::string &input) noexcept {
+std::map<std::string, FromJSONVisitor::JSONKeyValue, std::less<>> FromJSONVisitor::readKeyValues(std::string &input) noexcept {
     const std::string MATCH_JSON
         = R"((?:\"|\')(?:[^"]*)(?:\"|\')(?=:)(?:\:\s*)(?:\"|\')?(?:true|false|[\-]{0,1}[0-9]+[\.][0-9]+|[\-]{0,1}[0-9]+|[0-9a-zA-Z\+\-\,\.\$\ \=]*)(?:\"|\')?)";
 
-    std::map<std::string, FromJSONVisitor::JSONKeyValue> result;
+    std::map<std::string, FromJSONVisitor::JSONKeyValue, std::less<>> result;
     std::string oldInput;
     try {
         std::smatch m;
@@ -137,7 +137,7 @@ std::string FromJSONVisitor::decodeBase64(const std::string &input) noexcept {
     return decoded;
 }
 
-void FromJSONVisitor::preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+void FromJSONVisitor::preVisit(int32_t id, const char *shortName, const char *longName) noexcept {
     (void)id;
     (void)shortName;
     (void)longName;
@@ -145,172 +145,172 @@ void FromJSONVisitor::preVisit(int32_t id, const std::string &shortName, const s
 
 void FromJSONVisitor::postVisit() noexcept {}
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            if (JSONConstants::IS_FALSE == m_keyValues[name].m_type) {
+            if (JSONConstants::IS_FALSE == m_keyValues.find(name)->second.m_type) {
                 v = false;
-            } else if (JSONConstants::IS_TRUE == m_keyValues[name].m_type) {
+            } else if (JSONConstants::IS_TRUE == m_keyValues.find(name)->second.m_type) {
                 v = true;
-            } else if (JSONConstants::NUMBER == m_keyValues[name].m_type) {
-                v = (1 == static_cast<uint32_t>(linb::any_cast<double>(m_keyValues[name].m_value)));
+            } else if (JSONConstants::NUMBER == m_keyValues.find(name)->second.m_type) {
+                v = (1 == static_cast<uint32_t>(linb::any_cast<double>(m_keyValues.find(name)->second.m_value)));
             }
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            if (JSONConstants::STRING == m_keyValues[name].m_type) {
-                v = linb::any_cast<std::string>(m_keyValues[name].m_value).at(0);
+            if (JSONConstants::STRING == m_keyValues.find(name)->second.m_type) {
+                v = linb::any_cast<std::string>(m_keyValues.find(name)->second.m_value).at(0);
             }
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            if (JSONConstants::NUMBER == m_keyValues[name].m_type) {
-                v = static_cast<int8_t>(linb::any_cast<double>(m_keyValues[name].m_value));
+            if (JSONConstants::NUMBER == m_keyValues.find(name)->second.m_type) {
+                v = static_cast<int8_t>(linb::any_cast<double>(m_keyValues.find(name)->second.m_value));
             }
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            if (JSONConstants::NUMBER == m_keyValues[name].m_type) {
-                v = static_cast<uint8_t>(linb::any_cast<double>(m_keyValues[name].m_value));
+            if (JSONConstants::NUMBER == m_keyValues.find(name)->second.m_type) {
+                v = static_cast<uint8_t>(linb::any_cast<double>(m_keyValues.find(name)->second.m_value));
             }
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            if (JSONConstants::NUMBER == m_keyValues[name].m_type) {
-                v = static_cast<int16_t>(linb::any_cast<double>(m_keyValues[name].m_value));
+            if (JSONConstants::NUMBER == m_keyValues.find(name)->second.m_type) {
+                v = static_cast<int16_t>(linb::any_cast<double>(m_keyValues.find(name)->second.m_value));
             }
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            if (JSONConstants::NUMBER == m_keyValues[name].m_type) {
-                v = static_cast<uint16_t>(linb::any_cast<double>(m_keyValues[name].m_value));
+            if (JSONConstants::NUMBER == m_keyValues.find(name)->second.m_type) {
+                v = static_cast<uint16_t>(linb::any_cast<double>(m_keyValues.find(name)->second.m_value));
             }
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            if (JSONConstants::NUMBER == m_keyValues[name].m_type) {
-                v = static_cast<int32_t>(linb::any_cast<double>(m_keyValues[name].m_value));
+            if (JSONConstants::NUMBER == m_keyValues.find(name)->second.m_type) {
+                v = static_cast<int32_t>(linb::any_cast<double>(m_keyValues.find(name)->second.m_value));
             }
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            if (JSONConstants::NUMBER == m_keyValues[name].m_type) {
-                v = static_cast<uint32_t>(linb::any_cast<double>(m_keyValues[name].m_value));
+            if (JSONConstants::NUMBER == m_keyValues.find(name)->second.m_type) {
+                v = static_cast<uint32_t>(linb::any_cast<double>(m_keyValues.find(name)->second.m_value));
             }
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            if (JSONConstants::NUMBER == m_keyValues[name].m_type) {
-                v = static_cast<int64_t>(linb::any_cast<double>(m_keyValues[name].m_value));
+            if (JSONConstants::NUMBER == m_keyValues.find(name)->second.m_type) {
+                v = static_cast<int64_t>(linb::any_cast<double>(m_keyValues.find(name)->second.m_value));
             }
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            if (JSONConstants::NUMBER == m_keyValues[name].m_type) {
-                v = static_cast<uint64_t>(linb::any_cast<double>(m_keyValues[name].m_value));
+            if (JSONConstants::NUMBER == m_keyValues.find(name)->second.m_type) {
+                v = static_cast<uint64_t>(linb::any_cast<double>(m_keyValues.find(name)->second.m_value));
             }
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            if (JSONConstants::NUMBER == m_keyValues[name].m_type) {
-                v = static_cast<float>(linb::any_cast<double>(m_keyValues[name].m_value));
+            if (JSONConstants::NUMBER == m_keyValues.find(name)->second.m_type) {
+                v = static_cast<float>(linb::any_cast<double>(m_keyValues.find(name)->second.m_value));
             }
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            if (JSONConstants::NUMBER == m_keyValues[name].m_type) {
-                v = linb::any_cast<double>(m_keyValues[name].m_value);
+            if (JSONConstants::NUMBER == m_keyValues.find(name)->second.m_type) {
+                v = linb::any_cast<double>(m_keyValues.find(name)->second.m_value);
             }
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void FromJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            std::string tmp{linb::any_cast<std::string>(m_keyValues[name].m_value)};
+            std::string tmp{linb::any_cast<std::string>(m_keyValues.find(name)->second.m_value)};
             v = FromJSONVisitor::decodeBase64(tmp);
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
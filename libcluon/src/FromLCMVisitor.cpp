@@ -41,7 +41,7 @@ void FromLCMVisitor::decodeFrom(std::istream &in) noexcept {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void FromLCMVisitor::preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+void FromLCMVisitor::preVisit(int32_t id, const char *shortName, const char *longName) noexcept {
     (void)id;
     (void)shortName;
     (void)longName;
@@ -62,140 +62,140 @@ void FromLCMVisitor::postVisit() noexcept {
     }
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("boolean");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     m_buffer.read(reinterpret_cast<char *>(&v), sizeof(bool));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int8_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     m_buffer.read(reinterpret_cast<char *>(&v), sizeof(char));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int8_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     m_buffer.read(reinterpret_cast<char *>(&v), sizeof(int8_t));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int8_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     m_buffer.read(reinterpret_cast<char *>(&v), sizeof(int8_t));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int16_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int16_t _v{0};
     m_buffer.read(reinterpret_cast<char *>(&_v), sizeof(int16_t));
     v = static_cast<int16_t>(be16toh(_v));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int16_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int16_t _v{0};
     m_buffer.read(reinterpret_cast<char *>(&_v), sizeof(int16_t));
     v = be16toh(_v);
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int32_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int32_t _v{0};
     m_buffer.read(reinterpret_cast<char *>(&_v), sizeof(int32_t));
     v = static_cast<int32_t>(be32toh(_v));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int32_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int32_t _v{0};
     m_buffer.read(reinterpret_cast<char *>(&_v), sizeof(int32_t));
     v = be32toh(_v);
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int64_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int64_t _v{0};
     m_buffer.read(reinterpret_cast<char *>(&_v), sizeof(int64_t));
     v = static_cast<int64_t>(be64toh(_v));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int64_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int64_t _v{0};
     m_buffer.read(reinterpret_cast<char *>(&_v), sizeof(int64_t));
     v = be64toh(_v);
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("float");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int32_t _v{0};
     m_buffer.read(reinterpret_cast<char *>(&_v), sizeof(int32_t));
     _v = static_cast<int32_t>(be32toh(_v));
     std::memmove(&v, &_v, sizeof(int32_t));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("double");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int64_t _v{0};
     m_buffer.read(reinterpret_cast<char *>(&_v), sizeof(int64_t));
     _v = static_cast<int64_t>(be64toh(_v));
     std::memmove(&v, &_v, sizeof(int64_t));
 }
 
-void FromLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void FromLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)id;
     (void)typeName;
     (void)name;
     (void)v;
     calculateHash(name);
     calculateHash("string");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
 
     int32_t length{0};
     m_buffer.read(reinterpret_cast<char *>(&length), sizeof(int32_t));
@@ -235,11 +235,11 @@ void FromLCMVisitor::calculateHash(char c) noexcept {
     m_calculatedHash = ((m_calculatedHash << 8) ^ (m_calculatedHash >> 55)) + c;
 }
 
-void FromLCMVisitor::calculateHash(const std::string &s) noexcept {
-    const std::string tmp{(s.length() > 255 ? s.substr(0, 255) : s)};
-    const uint8_t length{static_cast<uint8_t>(tmp.length())};
+void FromLCMVisitor::calculateHash(const char *s) noexcept {
+    const std::size_t LENGTH{std::strlen(s)};
+    const uint8_t length{static_cast<uint8_t>((LENGTH > 255) ? 255 : LENGTH)};
     calculateHash(static_cast<char>(length));
-    for (auto c : tmp) { calculateHash(c); }
+    for (std::size_t i{0}; i < length; i++) { calculateHash(s[i]); }
 }
 
 } // namespace cluon
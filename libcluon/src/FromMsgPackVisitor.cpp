@@ -22,7 +22,7 @@ namespace cluon {
 FromMsgPackVisitor::FromMsgPackVisitor() noexcept
     : m_keyValues{m_data} {}
 
-FromMsgPackVisitor::FromMsgPackVisitor(std::map<std::string, FromMsgPackVisitor::MsgPackKeyValue> &preset) noexcept
+FromMsgPackVisitor::FromMsgPackVisitor(std::map<std::string, FromMsgPackVisitor::MsgPackKeyValue, std::less<>> &preset) noexcept
     : m_keyValues{preset} {}
 
 MsgPackConstants FromMsgPackVisitor::getFormatFamily(uint8_t T) noexcept {
@@ -176,8 +176,8 @@ std::string FromMsgPackVisitor::readString(std::istream &in) noexcept {
     return retVal;
 }
 
-std::map<std::string, FromMsgPackVisitor::MsgPackKeyValue> FromMsgPackVisitor::readKeyValues(std::istream &in) noexcept {
-    std::map<std::string, FromMsgPackVisitor::MsgPackKeyValue> keyValues;
+std::map<std::string, FromMsgPackVisitor::MsgPackKeyValue, std::less<>> FromMsgPackVisitor::readKeyValues(std::istream &in) noexcept {
+    std::map<std::string, FromMsgPackVisitor::MsgPackKeyValue, std::less<>> keyValues;
     while (in.good()) {
         uint8_t c = static_cast<uint8_t>(in.get());
         if (MsgPackConstants::MAP_FORMAT == getFormatFamily(c)) {
@@ -261,7 +261,7 @@ void FromMsgPackVisitor::decodeFrom(std::istream &in) noexcept {
     m_keyValues = readKeyValues(in);
 }
 
-void FromMsgPackVisitor::preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+void FromMsgPackVisitor::preVisit(int32_t id, const char *shortName, const char *longName) noexcept {
     (void)id;
     (void)shortName;
     (void)longName;
@@ -269,164 +269,164 @@ void FromMsgPackVisitor::preVisit(int32_t id, const std::string &shortName, cons
 
 void FromMsgPackVisitor::postVisit() noexcept {}
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = linb::any_cast<bool>(m_keyValues[name].m_value);
+            v = linb::any_cast<bool>(m_keyValues.find(name)->second.m_value);
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = linb::any_cast<std::string>(m_keyValues[name].m_value).at(0);
+            v = linb::any_cast<std::string>(m_keyValues.find(name)->second.m_value).at(0);
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = static_cast<int8_t>(linb::any_cast<int64_t>(m_keyValues[name].m_value));
+            v = static_cast<int8_t>(linb::any_cast<int64_t>(m_keyValues.find(name)->second.m_value));
         } catch (const linb::bad_any_cast &) {
             // A positive value was stored.
             try {
-                v = static_cast<int8_t>(linb::any_cast<uint64_t>(m_keyValues[name].m_value));
+                v = static_cast<int8_t>(linb::any_cast<uint64_t>(m_keyValues.find(name)->second.m_value));
             } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
             }
         }
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = static_cast<uint8_t>(linb::any_cast<uint64_t>(m_keyValues[name].m_value));
+            v = static_cast<uint8_t>(linb::any_cast<uint64_t>(m_keyValues.find(name)->second.m_value));
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = static_cast<int16_t>(linb::any_cast<int64_t>(m_keyValues[name].m_value));
+            v = static_cast<int16_t>(linb::any_cast<int64_t>(m_keyValues.find(name)->second.m_value));
         } catch (const linb::bad_any_cast &) {
             // A positive value was stored.
             try {
-                v = static_cast<int16_t>(linb::any_cast<uint64_t>(m_keyValues[name].m_value));
+                v = static_cast<int16_t>(linb::any_cast<uint64_t>(m_keyValues.find(name)->second.m_value));
             } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
             }
         }
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = static_cast<uint16_t>(linb::any_cast<uint64_t>(m_keyValues[name].m_value));
+            v = static_cast<uint16_t>(linb::any_cast<uint64_t>(m_keyValues.find(name)->second.m_value));
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = static_cast<int32_t>(linb::any_cast<int64_t>(m_keyValues[name].m_value));
+            v = static_cast<int32_t>(linb::any_cast<int64_t>(m_keyValues.find(name)->second.m_value));
         } catch (const linb::bad_any_cast &) {
             // A positive value was stored.
             try {
-                v = static_cast<int32_t>(linb::any_cast<uint64_t>(m_keyValues[name].m_value));
+                v = static_cast<int32_t>(linb::any_cast<uint64_t>(m_keyValues.find(name)->second.m_value));
             } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
             }
         }
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = static_cast<uint32_t>(linb::any_cast<uint64_t>(m_keyValues[name].m_value));
+            v = static_cast<uint32_t>(linb::any_cast<uint64_t>(m_keyValues.find(name)->second.m_value));
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = linb::any_cast<int64_t>(m_keyValues[name].m_value);
+            v = linb::any_cast<int64_t>(m_keyValues.find(name)->second.m_value);
         } catch (const linb::bad_any_cast &) {
             // A positive value was stored.
             try {
-                v = static_cast<int64_t>(linb::any_cast<uint64_t>(m_keyValues[name].m_value));
+                v = static_cast<int64_t>(linb::any_cast<uint64_t>(m_keyValues.find(name)->second.m_value));
             } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
             }
         }
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = linb::any_cast<uint64_t>(m_keyValues[name].m_value);
+            v = linb::any_cast<uint64_t>(m_keyValues.find(name)->second.m_value);
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = linb::any_cast<float>(m_keyValues[name].m_value);
+            v = linb::any_cast<float>(m_keyValues.find(name)->second.m_value);
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = linb::any_cast<double>(m_keyValues[name].m_value);
+            v = linb::any_cast<double>(m_keyValues.find(name)->second.m_value);
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
 }
 
-void FromMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void FromMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)id;
     (void)typeName;
     if (0 < m_keyValues.count(name)) {
         try {
-            v = linb::any_cast<std::string>(m_keyValues[name].m_value);
+            v = linb::any_cast<std::string>(m_keyValues.find(name)->second.m_value);
         } catch (const linb::bad_any_cast &) { // LCOV_EXCL_LINE
         }
     }
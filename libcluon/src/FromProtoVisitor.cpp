@@ -10,73 +10,94 @@
 
 #include <cstddef>
 #include <cstring>
+#include <algorithm>
 #include <utility>
 
 namespace cluon {
 
-void FromProtoVisitor::readBytesFromStream(std::istream &in, std::size_t bytesToReadFromStream, char *buffer) noexcept {
-    if (nullptr != buffer) {
-        const constexpr std::size_t CHUNK_SIZE{1024};
-        std::streamsize bufferPosition{0};
-        std::streamsize extractedBytes{0};
-
-        while ((0 < bytesToReadFromStream) && in.good()) {
-            // clang-format off
-            in.read(&buffer[static_cast<std::size_t>(bufferPosition)], /* Flawfinder: ignore */ /* Cf. buffer.reserve(...) above.  */
-                    (bytesToReadFromStream > CHUNK_SIZE) ? CHUNK_SIZE : static_cast<std::streamsize>(bytesToReadFromStream));
-            // clang-format on
-            extractedBytes = in.gcount();
-            bufferPosition += extractedBytes;
-            bytesToReadFromStream -= static_cast<std::size_t>(extractedBytes);
+void FromProtoVisitor::readFromStream(std::istream &in) noexcept {
+    constexpr std::size_t CHUNK_SIZE{1024};
+    std::size_t size{0};
+    try {
+        while (in.good()) {
+            m_streamBuffer.resize(size + CHUNK_SIZE);
+            in.read(&m_streamBuffer[size], static_cast<std::streamsize>(CHUNK_SIZE)); /* Flawfinder: ignore */ // NOLINT
+            size += static_cast<std::size_t>(in.gcount());
         }
-    }
+    } catch (...) {} // LCOV_EXCL_LINE
+    m_streamBuffer.resize((std::min)(size, m_streamBuffer.size()));
 }
 
 void FromProtoVisitor::decodeFrom(std::istream &in) noexcept {
+    readFromStream(in);
+    decodeFrom(m_streamBuffer.data(), m_streamBuffer.size());
+}
+
+void FromProtoVisitor::decodeFrom(const char *data, std::size_t length) noexcept {
     // Reset internal states as this deserializer could be reused.
     m_mapOfKeyValues.clear();
-    while (in.good()) {
-        // First stage: Read keyFieldType (encoded as VarInt).
-        if (0 < fromVarInt(in, m_keyFieldType)) {
-            // Succeeded to read keyFieldType entry; extract information.
-            m_protoType = static_cast<ProtoConstants>(m_keyFieldType & 0x7);
-            m_fieldId = static_cast<uint32_t>(m_keyFieldType >> 3);
+    const char *position{data};
+    const char *end{(nullptr == data) ? data : data + length};
+    try {
+        while (decodeNextField(position, end)) {
             switch (m_protoType) {
                 case ProtoConstants::VARINT:
-                {
-                    // Directly decode VarInt value.
-                    fromVarInt(in, m_value);
                     m_mapOfKeyValues.emplace(m_fieldId, linb::any(m_value));
-                }
-                break;
+                    break;
                 case ProtoConstants::EIGHT_BYTES:
-                {
-                    readBytesFromStream(in, sizeof(double), m_doubleValue.buffer.data());
-                    m_doubleValue.uint64Value = le64toh(m_doubleValue.uint64Value);
                     m_mapOfKeyValues.emplace(m_fieldId, linb::any(m_doubleValue.doubleValue));
-                }
-                break;
+                    break;
                 case ProtoConstants::FOUR_BYTES:
-                {
-                    readBytesFromStream(in, sizeof(float), m_floatValue.buffer.data());
-                    m_floatValue.uint32Value = le32toh(m_floatValue.uint32Value);
                     m_mapOfKeyValues.emplace(m_fieldId, linb::any(m_floatValue.floatValue));
-                }
-                break;
+                    break;
                 case ProtoConstants::LENGTH_DELIMITED:
-                {
-                    fromVarInt(in, m_value);
-                    const std::size_t BYTES_TO_READ_FROM_STREAM{static_cast<std::size_t>(m_value)};
-                    if (m_stringValue.capacity() < BYTES_TO_READ_FROM_STREAM) {
-                        m_stringValue.reserve(BYTES_TO_READ_FROM_STREAM);
-                    }
-                    readBytesFromStream(in, BYTES_TO_READ_FROM_STREAM, m_stringValue.data());
-                    m_mapOfKeyValues.emplace(m_fieldId, linb::any(std::string(m_stringValue.data(), static_cast<std::size_t>(m_value))));
-                }
-                break;
+                    m_mapOfKeyValues.emplace(m_fieldId, linb::any(std::string(m_lengthDelimitedData, static_cast<std::size_t>(m_value))));
+                    break;
             }
         }
+    } catch (...) {} // LCOV_EXCL_LINE
+}
+
+bool FromProtoVisitor::decodeNextField(const char *&position, const char *end) noexcept {
+    // First stage: Read keyFieldType (encoded as VarInt).
+    if (0 == fromVarInt(position, end, m_keyFieldType)) {
+        return false;
+    }
+    // Succeeded to read keyFieldType entry; extract information.
+    m_protoType = static_cast<ProtoConstants>(m_keyFieldType & 0x7);
+    m_fieldId   = static_cast<uint32_t>(m_keyFieldType >> 3);
+    const std::size_t AVAILABLE{static_cast<std::size_t>(end - position)};
+    switch (m_protoType) {
+        case ProtoConstants::VARINT:
+            // Directly decode VarInt value.
+            return (0 < fromVarInt(position, end, m_value));
+        case ProtoConstants::EIGHT_BYTES:
+            if (sizeof(double) <= AVAILABLE) {
+                std::memcpy(m_doubleValue.buffer.data(), position, sizeof(double)); /* Flawfinder: ignore */ // NOLINT
+                m_doubleValue.uint64Value = le64toh(m_doubleValue.uint64Value);
+                position += sizeof(double);
+                return true;
+            }
+            return false;
+        case ProtoConstants::FOUR_BYTES:
+            if (sizeof(float) <= AVAILABLE) {
+                std::memcpy(m_floatValue.buffer.data(), position, sizeof(float)); /* Flawfinder: ignore */ // NOLINT
+                m_floatValue.uint32Value = le32toh(m_floatValue.uint32Value);
+                position += sizeof(float);
+                return true;
+            }
+            return false;
+        case ProtoConstants::LENGTH_DELIMITED:
+            // Strings and nested messages are not copied here but referenced.
+            if ((0 < fromVarInt(position, end, m_value)) && (m_value <= static_cast<uint64_t>(end - position))) {
+                m_lengthDelimitedData = position;
+                position += static_cast<std::size_t>(m_value);
+                return true;
+            }
+            return false;
     }
+    // Unsupported wire types (groups) cannot be skipped reliably.
+    return false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -88,7 +109,7 @@ FromProtoVisitor &FromProtoVisitor::operator=(const FromProtoVisitor &other) noe
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void FromProtoVisitor::preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+void FromProtoVisitor::preVisit(int32_t id, const char *shortName, const char *longName) noexcept {
     (void)id;
     (void)shortName;
     (void)longName;
@@ -96,11 +117,13 @@ void FromProtoVisitor::preVisit(int32_t id, const std::string &shortName, const
 
 void FromProtoVisitor::postVisit() noexcept {}
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = (0 != m_value);
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = (0 != m_value);
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -110,11 +133,13 @@ void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<char>(m_value);
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<char>(m_value);
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -125,11 +150,13 @@ void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<int8_t>(fromZigZag8(static_cast<uint8_t>(m_value)));
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<int8_t>(fromZigZag8(static_cast<uint8_t>(m_value)));
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -140,11 +167,13 @@ void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<uint8_t>(m_value);
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<uint8_t>(m_value);
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -155,11 +184,13 @@ void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<int16_t>(fromZigZag16(static_cast<uint16_t>(m_value)));
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<int16_t>(fromZigZag16(static_cast<uint16_t>(m_value)));
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -170,11 +201,13 @@ void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<uint16_t>(m_value);
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<uint16_t>(m_value);
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -185,11 +218,13 @@ void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<int32_t>(fromZigZag32(static_cast<uint32_t>(m_value)));
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<int32_t>(fromZigZag32(static_cast<uint32_t>(m_value)));
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -200,11 +235,13 @@ void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<uint32_t>(m_value);
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<uint32_t>(m_value);
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -215,11 +252,13 @@ void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = static_cast<int64_t>(fromZigZag64(static_cast<uint64_t>(m_value)));
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = static_cast<int64_t>(fromZigZag64(static_cast<uint64_t>(m_value)));
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -230,11 +269,13 @@ void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = m_value;
+        if (ProtoConstants::VARINT == m_protoType) {
+            v = m_value;
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -244,11 +285,13 @@ void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = m_floatValue.floatValue;
+        if (ProtoConstants::FOUR_BYTES == m_protoType) {
+            v = m_floatValue.floatValue;
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -258,11 +301,13 @@ void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = m_doubleValue.doubleValue;
+        if (ProtoConstants::EIGHT_BYTES == m_protoType) {
+            v = m_doubleValue.doubleValue;
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -272,11 +317,15 @@ void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     }
 }
 
-void FromProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void FromProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)typeName;
     (void)name;
     if (m_callToDecodeFromWithDirectVisit) {
-        v = std::string(m_stringValue.data(), static_cast<std::size_t>(m_value));
+        if (ProtoConstants::LENGTH_DELIMITED == m_protoType) {
+            try {
+                v.assign(m_lengthDelimitedData, static_cast<std::size_t>(m_value));
+            } catch (...) {} // LCOV_EXCL_LINE
+        }
     }
     else if (m_mapOfKeyValues.count(id) > 0) {
         try {
@@ -304,24 +353,28 @@ int64_t FromProtoVisitor::fromZigZag64(uint64_t v) noexcept {
     return static_cast<int64_t>((v >> 1) ^ -(v & 1));
 }
 
-std::size_t FromProtoVisitor::fromVarInt(std::istream &in, uint64_t &value) noexcept {
-    value = 0;
-
+std::size_t FromProtoVisitor::fromVarInt(const char *&position, const char *end, uint64_t &value) noexcept {
     constexpr uint64_t MASK  = 0x7f;
     constexpr uint64_t SHIFT = 0x7;
     constexpr uint64_t MSB   = 0x80;
+    constexpr std::size_t MAX_VARINT_SIZE{10};
 
-    std::size_t size = 0;
-    uint64_t C{0};
-    while (in.good()) {
-        auto x = in.get();
-        C = static_cast<uint64_t>(x);
-        value |= (C & MASK) << (SHIFT * size++);
-        if (!(C & MSB)) { // NOLINT
-            break;
+    const char *start{position};
+    value = 0;
+    if (position < end) {
+        // Most keys and small values fit into one byte.
+        uint64_t C{static_cast<uint8_t>(*position++)};
+        value = C & MASK;
+        for (uint64_t shift{SHIFT}; (C & MSB) && (position < end) && (shift < SHIFT * MAX_VARINT_SIZE); shift += SHIFT) { // NOLINT
+            C = static_cast<uint8_t>(*position++);
+            value |= (C & MASK) << shift;
+        }
+        if (C & MSB) { // NOLINT
+            // Incomplete VarInt.
+            position = end;
+            return 0;
         }
     }
-
-    return size;
+    return static_cast<std::size_t>(position - start);
 }
 } // namespace cluon
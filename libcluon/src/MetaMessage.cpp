@@ -19,7 +19,7 @@ MetaMessage::MetaField &MetaMessage::MetaField::fieldDataType(const MetaMessage:
     return *this;
 }
 
-std::string MetaMessage::MetaField::fieldDataTypeName() const noexcept {
+const std::string &MetaMessage::MetaField::fieldDataTypeName() const noexcept {
     return m_fieldDataTypeName;
 }
 
@@ -28,7 +28,7 @@ MetaMessage::MetaField &MetaMessage::MetaField::fieldDataTypeName(const std::str
     return *this;
 }
 
-std::string MetaMessage::MetaField::fieldName() const noexcept {
+const std::string &MetaMessage::MetaField::fieldName() const noexcept {
     return m_fieldName;
 }
 
@@ -8,6 +8,7 @@
 
 #include "cluon/MetaMessageToCPPTransformator.hpp"
 #include "cluon/MetaMessage.hpp"
+#include "cluon/ProtoConstants.hpp"
 
 #include <algorithm>
 #include <cctype>
@@ -20,6 +21,9 @@
 
 namespace cluon {
 
+MetaMessageToCPPTransformator::MetaMessageToCPPTransformator(bool generateProtoCodec) noexcept
+    : m_generateProtoCodec(generateProtoCodec) {}
+
 const char *headerFileTemplate = R"(
 /*
  * THIS IS AN AUTO-GENERATED FILE. DO NOT MODIFY AS CHANGES MIGHT BE OVERWRITTEN!
@@ -97,8 +101,156 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
 
-#ifndef {{%HEADER_GUARD%}}_HPP
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
+
+{{#%PROTO_CODEC%}}#ifndef PROTO_CODEC_HELPERS
+#define PROTO_CODEC_HELPERS
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+struct protoCodec {
+    static inline uint64_t toZigZag(int64_t v) {
+        return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+    }
+
+    static inline int64_t fromZigZag(uint64_t v) {
+        return static_cast<int64_t>((v >> 1) ^ (0 - (v & 1)));
+    }
+
+    static inline void writeVarInt(std::string &buffer, uint64_t v) {
+        char bytes[10]; // NOLINT
+        std::size_t size{0};
+        while (0x7f < v) {
+            bytes[size++] = static_cast<char>((v & 0x7f) | 0x80);
+            v >>= 7;
+        }
+        bytes[size++] = static_cast<char>(v);
+        buffer.append(bytes, size);
+    }
+
+    static inline void writeFixed32(std::string &buffer, uint32_t v) {
+        const char bytes[4] = {static_cast<char>(v), static_cast<char>(v >> 8), static_cast<char>(v >> 16), static_cast<char>(v >> 24)}; // NOLINT
+        buffer.append(bytes, sizeof(bytes));
+    }
+
+    static inline void writeFixed64(std::string &buffer, uint64_t v) {
+        writeFixed32(buffer, static_cast<uint32_t>(v));
+        writeFixed32(buffer, static_cast<uint32_t>(v >> 32));
+    }
+
+    static inline std::size_t sizeOfVarInt(uint64_t v) {
+        std::size_t size{1};
+        while (0x7f < v) {
+            v >>= 7;
+            size++;
+        }
+        return size;
+    }
+
+    static inline bool readVarInt(const char *&position, const char *end, uint64_t &value) {
+        value = 0;
+        for (uint32_t shift{0}; (position < end) && (shift < 70); shift += 7) {
+            const uint64_t C{static_cast<uint8_t>(*position++)};
+            value |= (C & 0x7f) << shift;
+            if (0 == (C & 0x80)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static inline bool readFixed32(const char *&position, const char *end, uint32_t &value) {
+        if (end - position < 4) {
+            return false;
+        }
+        const uint8_t *bytes{reinterpret_cast<const uint8_t *>(position)}; // NOLINT
+        value = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) | (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+        position += 4;
+        return true;
+    }
+
+    static inline bool readFixed64(const char *&position, const char *end, uint64_t &value) {
+        uint32_t low{0};
+        uint32_t high{0};
+        if (!(readFixed32(position, end, low) && readFixed32(position, end, high))) {
+            return false;
+        }
+        value = (static_cast<uint64_t>(high) << 32) | low;
+        return true;
+    }
+
+    static inline bool readLength(const char *&position, const char *end, std::size_t &length) {
+        uint64_t value{0};
+        if (!readVarInt(position, end, value) || (static_cast<uint64_t>(end - position) < value)) {
+            return false;
+        }
+        length = static_cast<std::size_t>(value);
+        return true;
+    }
+
+    // Skips a field that is unknown to the receiving message.
+    static inline bool skipField(uint64_t key, const char *&position, const char *end) {
+        uint64_t v64{0};
+        uint32_t v32{0};
+        std::size_t length{0};
+        switch (key & 0x7) {
+            case 0: return readVarInt(position, end, v64);
+            case 1: return readFixed64(position, end, v64);
+            case 2:
+                if (readLength(position, end, length)) {
+                    position += length;
+                    return true;
+                }
+                return false;
+            case 5: return readFixed32(position, end, v32);
+            default: return false;
+        }
+    }
+};
+#endif
+
+
+{{/%PROTO_CODEC%}}#ifndef {{%HEADER_GUARD%}}_HPP
 #define {{%HEADER_GUARD%}}_HPP
 
 #ifdef WIN32
@@ -118,7 +270,8 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
     #define LIB_API
 #endif
 
-#include <string>
+{{#%PROTO_CODEC%}}#include <cstring>
+{{/%PROTO_CODEC%}}#include <string>
 #include <utility>
 {{%NAMESPACE_OPENING%}}
 using namespace std::string_literals; // NOLINT
@@ -152,7 +305,11 @@ class LIB_API {{%MESSAGE%}} {
             m_{{%NAME%}} = v;
             return *this;
         }
-        inline {{%TYPE%}} {{%NAME%}}() const noexcept {
+{{#%MOVABLE%}}        inline {{%MESSAGE%}}& {{%NAME%}}({{%TYPE%}} &&v) noexcept {
+            m_{{%NAME%}} = std::move(v);
+            return *this;
+        }
+{{/%MOVABLE%}}        inline {{%TYPE%}} {{%NAME%}}() const noexcept {
             return m_{{%NAME%}};
         }
         {{/%FIELDS%}}
@@ -165,7 +322,7 @@ class LIB_API {{%MESSAGE%}} {
 //            visitor.preVisit(ID(), ShortName(), LongName());
             {{#%FIELDS%}}
             if ({{%FIELDIDENTIFIER%}} == fieldId) {
-                doVisit({{%FIELDIDENTIFIER%}}, std::move("{{%TYPE%}}"s), std::move("{{%NAME%}}"s), m_{{%NAME%}}, visitor);
+                doVisit({{%FIELDIDENTIFIER%}}, "{{%TYPE%}}", "{{%NAME%}}", m_{{%NAME%}}, visitor);
                 return;
             }
             {{/%FIELDS%}}
@@ -174,9 +331,9 @@ class LIB_API {{%MESSAGE%}} {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
+            visitor.preVisit(ID(), "{{%MESSAGE%}}", "{{%COMPLETEPACKAGENAME%}}{{%MESSAGE%}}");
             {{#%FIELDS%}}
-            doVisit({{%FIELDIDENTIFIER%}}, std::move("{{%TYPE%}}"s), std::move("{{%NAME%}}"s), m_{{%NAME%}}, visitor);
+            doVisit({{%FIELDIDENTIFIER%}}, "{{%TYPE%}}", "{{%NAME%}}", m_{{%NAME%}}, visitor);
             {{/%FIELDS%}}
             visitor.postVisit();
         }
@@ -184,14 +341,114 @@ class LIB_API {{%MESSAGE%}} {
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
+            std::forward<PreVisitor>(preVisit)(ID(), "{{%MESSAGE%}}", "{{%COMPLETEPACKAGENAME%}}{{%MESSAGE%}}");
             {{#%FIELDS%}}
-            doTripletForwardVisit({{%FIELDIDENTIFIER%}}, std::move("{{%TYPE%}}"s), std::move("{{%NAME%}}"s), m_{{%NAME%}}, preVisit, visit, postVisit);
+            doTripletForwardVisit({{%FIELDIDENTIFIER%}}, "{{%TYPE%}}", "{{%NAME%}}", m_{{%NAME%}}, preVisit, visit, postVisit);
             {{/%FIELDS%}}
             std::forward<PostVisitor>(postVisit)();
         }
 
-    private:
+{{#%PROTO_CODEC%}}    public:
+        /**
+         * @return Number of bytes that encodeProto appends for this message.
+         */
+        inline std::size_t encodedProtoSize() const {
+            std::size_t size{0};
+{{#%FIELDS%}}{{#%PROTO_VARINT%}}            size += {{%PROTO_KEY_SIZE%}} + protoCodec::sizeOfVarInt({{%PROTO_TO_WIRE%}});
+{{/%PROTO_VARINT%}}{{#%PROTO_FLOAT%}}            size += {{%PROTO_KEY_SIZE%}} + 4;
+{{/%PROTO_FLOAT%}}{{#%PROTO_DOUBLE%}}            size += {{%PROTO_KEY_SIZE%}} + 8;
+{{/%PROTO_DOUBLE%}}{{#%PROTO_STRING%}}            size += {{%PROTO_KEY_SIZE%}} + protoCodec::sizeOfVarInt(m_{{%NAME%}}.size()) + m_{{%NAME%}}.size();
+{{/%PROTO_STRING%}}{{#%PROTO_MESSAGE%}}            {
+                const std::size_t SIZE{m_{{%NAME%}}.encodedProtoSize()};
+                size += {{%PROTO_KEY_SIZE%}} + protoCodec::sizeOfVarInt(SIZE) + SIZE;
+            }
+{{/%PROTO_MESSAGE%}}{{/%FIELDS%}}            return size;
+        }
+
+        /**
+         * Appends this message in Proto format to the given buffer.
+         */
+        inline void encodeProto(std::string &buffer) const {
+            (void)buffer; // Prevent warnings from empty messages.
+{{#%FIELDS%}}{{#%PROTO_VARINT%}}            protoCodec::writeVarInt(buffer, {{%PROTO_KEY%}}u);
+            protoCodec::writeVarInt(buffer, {{%PROTO_TO_WIRE%}});
+{{/%PROTO_VARINT%}}{{#%PROTO_FLOAT%}}            {
+                uint32_t value{0};
+                std::memcpy(&value, &m_{{%NAME%}}, sizeof(value));
+                protoCodec::writeVarInt(buffer, {{%PROTO_KEY%}}u);
+                protoCodec::writeFixed32(buffer, value);
+            }
+{{/%PROTO_FLOAT%}}{{#%PROTO_DOUBLE%}}            {
+                uint64_t value{0};
+                std::memcpy(&value, &m_{{%NAME%}}, sizeof(value));
+                protoCodec::writeVarInt(buffer, {{%PROTO_KEY%}}u);
+                protoCodec::writeFixed64(buffer, value);
+            }
+{{/%PROTO_DOUBLE%}}{{#%PROTO_STRING%}}            protoCodec::writeVarInt(buffer, {{%PROTO_KEY%}}u);
+            protoCodec::writeVarInt(buffer, m_{{%NAME%}}.size());
+            buffer.append(m_{{%NAME%}});
+{{/%PROTO_STRING%}}{{#%PROTO_MESSAGE%}}            {
+                // The length of the nested message is written first to encode it in place.
+                protoCodec::writeVarInt(buffer, {{%PROTO_KEY%}}u);
+                protoCodec::writeVarInt(buffer, m_{{%NAME%}}.encodedProtoSize());
+                m_{{%NAME%}}.encodeProto(buffer);
+            }
+{{/%PROTO_MESSAGE%}}{{/%FIELDS%}}        }
+
+        /**
+         * Decodes the given bytes in Proto format into the fields of this message;
+         * fields that are not contained in the bytes keep their values.
+         *
+         * @return true if all bytes were decoded.
+         */
+        inline bool decodeProto(const char *data, std::size_t length) {
+            const char *position{data};
+            const char *end{(nullptr == data) ? data : data + length};
+            while (position < end) {
+                uint64_t key{0};
+                if (!protoCodec::readVarInt(position, end, key)) {
+                    return false;
+                }
+                switch (key) {
+{{#%FIELDS%}}                    case {{%PROTO_KEY%}}u: {
+{{#%PROTO_VARINT%}}                        uint64_t value{0};
+                        if (!protoCodec::readVarInt(position, end, value)) {
+                            return false;
+                        }
+                        m_{{%NAME%}} = {{%PROTO_FROM_WIRE%}};
+{{/%PROTO_VARINT%}}{{#%PROTO_FLOAT%}}                        uint32_t value{0};
+                        if (!protoCodec::readFixed32(position, end, value)) {
+                            return false;
+                        }
+                        std::memcpy(&m_{{%NAME%}}, &value, sizeof(value));
+{{/%PROTO_FLOAT%}}{{#%PROTO_DOUBLE%}}                        uint64_t value{0};
+                        if (!protoCodec::readFixed64(position, end, value)) {
+                            return false;
+                        }
+                        std::memcpy(&m_{{%NAME%}}, &value, sizeof(value));
+{{/%PROTO_DOUBLE%}}{{#%PROTO_STRING%}}                        std::size_t size{0};
+                        if (!protoCodec::readLength(position, end, size)) {
+                            return false;
+                        }
+                        m_{{%NAME%}}.assign(position, size);
+                        position += size;
+{{/%PROTO_STRING%}}{{#%PROTO_MESSAGE%}}                        std::size_t size{0};
+                        if (!(protoCodec::readLength(position, end, size) && m_{{%NAME%}}.decodeProto(position, size))) {
+                            return false;
+                        }
+                        position += size;
+{{/%PROTO_MESSAGE%}}                        break;
+                    }
+{{/%FIELDS%}}                    default:
+                        if (!protoCodec::skipField(key, position, end)) {
+                            return false;
+                        }
+                }
+            }
+            return true;
+        }
+
+{{/%PROTO_CODEC%}}    private:
         {{#%FIELDS%}}
         {{%TYPE%}} m_{{%NAME%}}{ {{%FIELD_DEFAULT_INITIALIZATION_VALUE%}}{{%INITIALIZER_SUFFIX%}} }; // field identifier = {{%FIELDIDENTIFIER%}}.
         {{/%FIELDS%}}
@@ -285,6 +542,7 @@ void MetaMessageToCPPTransformator::visit(const MetaMessage &mm) noexcept {
         dataToBeRendered.set("%MESSAGE%", messageName);
         dataToBeRendered.set("%NAMESPACE_CLOSING%", namespaceFooter);
         dataToBeRendered.set("%IDENTIFIER%", std::to_string(mm.messageIdentifier()));
+        dataToBeRendered.set("%PROTO_CODEC%", m_generateProtoCodec);
 
         for (const auto &e : mm.listOfMetaFields()) {
             std::string fieldName{std::regex_replace(e.fieldName(), std::regex("\\."), "_")}; // NOLINT
@@ -302,6 +560,7 @@ void MetaMessageToCPPTransformator::visit(const MetaMessage &mm) noexcept {
                     initializerSuffix = "f"; // suffix for float types.
                 } else if (e.fieldDataType() == MetaMessage::MetaField::STRING_T || e.fieldDataType() == MetaMessage::MetaField::BYTES_T) {
                     initializerSuffix = "s"; // suffix to enforce std::string initialization.
+                    fieldEntry.set("%MOVABLE%", true); // allow to move large payloads into the message.
                 }
                 fieldEntry.set("%INITIALIZER_SUFFIX%", initializerSuffix);
             } else {
@@ -312,6 +571,70 @@ void MetaMessageToCPPTransformator::visit(const MetaMessage &mm) noexcept {
             }
             fieldEntry.set("%FIELDIDENTIFIER%", std::to_string(e.fieldIdentifier()));
 
+            if (m_generateProtoCodec) {
+                const std::string member{"m_" + fieldName};
+                ProtoConstants protoType{ProtoConstants::VARINT};
+                std::string toWire{member};
+                std::string fromWire{"static_cast<" + typeToTypeStringMap[e.fieldDataType()] + ">(value)"};
+                switch (e.fieldDataType()) {
+                    case MetaMessage::MetaField::BOOL_T:
+                        toWire   = "(" + member + " ? 1u : 0u)";
+                        fromWire = "(0 != value)";
+                        break;
+                    case MetaMessage::MetaField::CHAR_T:
+                        toWire = "static_cast<uint8_t>(" + member + ")";
+                        break;
+                    case MetaMessage::MetaField::INT8_T:
+                    case MetaMessage::MetaField::INT16_T:
+                    case MetaMessage::MetaField::INT32_T:
+                    case MetaMessage::MetaField::INT64_T: {
+                        // Signed values are ZigZag-encoded from their unsigned counterpart.
+                        const std::string type{typeToTypeStringMap[e.fieldDataType()]};
+                        toWire   = "protoCodec::toZigZag(" + member + ")";
+                        fromWire = "static_cast<" + type + ">(protoCodec::fromZigZag(static_cast<u" + type + ">(value)))";
+                        break;
+                    }
+                    case MetaMessage::MetaField::UINT8_T:
+                    case MetaMessage::MetaField::UINT16_T:
+                    case MetaMessage::MetaField::UINT32_T:
+                        break;
+                    case MetaMessage::MetaField::UINT64_T:
+                        fromWire = "value";
+                        break;
+                    case MetaMessage::MetaField::FLOAT_T:
+                        protoType = ProtoConstants::FOUR_BYTES;
+                        fieldEntry.set("%PROTO_FLOAT%", true);
+                        break;
+                    case MetaMessage::MetaField::DOUBLE_T:
+                        protoType = ProtoConstants::EIGHT_BYTES;
+                        fieldEntry.set("%PROTO_DOUBLE%", true);
+                        break;
+                    case MetaMessage::MetaField::STRING_T:
+                    case MetaMessage::MetaField::BYTES_T:
+                        protoType = ProtoConstants::LENGTH_DELIMITED;
+                        fieldEntry.set("%PROTO_STRING%", true);
+                        break;
+                    case MetaMessage::MetaField::MESSAGE_T:
+                        protoType = ProtoConstants::LENGTH_DELIMITED;
+                        fieldEntry.set("%PROTO_MESSAGE%", true);
+                        break;
+                    case MetaMessage::MetaField::UNDEFINED_T: // LCOV_EXCL_LINE
+                        break;                               // LCOV_EXCL_LINE
+                }
+                if (ProtoConstants::VARINT == protoType) {
+                    fieldEntry.set("%PROTO_VARINT%", true);
+                    fieldEntry.set("%PROTO_TO_WIRE%", toWire);
+                    fieldEntry.set("%PROTO_FROM_WIRE%", fromWire);
+                }
+                const uint64_t key{(static_cast<uint64_t>(e.fieldIdentifier()) << 3) | static_cast<uint64_t>(protoType)};
+                fieldEntry.set("%PROTO_KEY%", std::to_string(key));
+                std::size_t keySize{1};
+                for (uint64_t v{key}; 0x7f < v; v >>= 7) {
+                    keySize++;
+                }
+                fieldEntry.set("%PROTO_KEY_SIZE%", std::to_string(keySize));
+            }
+
             fields.push_back(fieldEntry);
         }
     } catch (std::regex_error &) { // LCOV_EXCL_LINE
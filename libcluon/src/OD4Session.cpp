@@ -9,28 +9,66 @@
 #include "cluon/OD4Session.hpp"
 #include "cluon/Envelope.hpp"
 #include "cluon/FromProtoVisitor.hpp"
+#include "cluon/ProtoConstants.hpp"
 #include "cluon/TerminateHandler.hpp"
 #include "cluon/Time.hpp"
+#include "cluon/UDPPacketSizeConstraints.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <thread>
 
 namespace cluon {
 
-OD4Session::OD4Session(uint16_t CID, std::function<void(cluon::data::Envelope &&envelope)> delegate) noexcept
+OD4Session::OD4Session(uint16_t CID, std::function<void(cluon::data::Envelope &&envelope)> delegate, uint16_t numberOfWorkers) noexcept
     : m_receiver{nullptr}
     , m_sender{"225.0.0." + std::to_string(CID), 12175}
     , m_delegate(std::move(delegate))
     , m_mapOfDataTriggeredDelegatesMutex{}
     , m_mapOfDataTriggeredDelegates{} {
+    // The workers need to be available before the first Envelope is received.
+    try {
+        for (uint16_t i{0}; i < numberOfWorkers; i++) {
+            auto worker = std::make_unique<Worker>();
+            Worker *w{worker.get()};
+            // Envelopes are only added from the receiving thread.
+            worker->m_pipeline = std::make_unique<cluon::NotifyingPipeline<WorkerEntry>>(
+                [this, w](WorkerEntry &&entry) {
+                    const int64_t LATENCY{
+                        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - entry.m_enqueued).count()};
+                    w->m_sumOfLatencies += LATENCY;
+                    if (LATENCY > w->m_maximumLatency.load()) {
+                        w->m_maximumLatency.store(LATENCY);
+                    }
+                    this->dispatch(std::move(entry.m_envelope));
+                    w->m_numberOfProcessedEnvelopes++;
+                },
+                cluon::NotifyingPipelineBackend::SPSC_RING,
+                OD4Session::WORKER_QUEUE_CAPACITY,
+                cluon::NotifyingPipelineOverflowPolicy::DROP_OLDEST);
+            m_workers.emplace_back(std::move(worker));
+        }
+    } catch (...) {                                                                        // LCOV_EXCL_LINE
+        std::cerr << "[cluon::OD4Session]: Could not create worker threads." << std::endl; // LCOV_EXCL_LINE
+        m_workers.clear();                                                                 // LCOV_EXCL_LINE
+    }
+
     m_receiver = std::make_unique<cluon::UDPReceiver>(
         "225.0.0." + std::to_string(CID),
         12175,
-        [this](std::string &&data, std::string &&from, std::chrono::system_clock::time_point &&timepoint) {
-            this->callback(std::move(data), std::move(from), std::move(timepoint));
+        [this](cluon::PooledBuffer &&data, const struct sockaddr_in &from, std::chrono::system_clock::time_point &&timepoint) {
+            this->callback(std::move(data), from, std::move(timepoint));
         },
-        m_sender.getSendFromPort() /* passing our local send from port to the UDPReceiver to filter out our own bytes */);
+        m_sender.getSendFromPort() /* passing our local send from port to the UDPReceiver to filter out our own bytes */,
+        OD4Session::RECEIVE_BATCH_SIZE);
+}
+
+OD4Session::~OD4Session() noexcept {
+    // Stop receiving before the workers and the delegates are gone.
+    m_receiver.reset();
+    m_workers.clear();
+    delete m_dispatchTable.exchange(nullptr);
 }
 
 void OD4Session::timeTrigger(float freq, std::function<bool()> delegate) noexcept {
@@ -67,7 +105,7 @@ bool OD4Session::dataTrigger(int32_t messageIdentifier, std::function<void(cluon
     if (nullptr == m_delegate) {
         try {
             std::lock_guard<std::mutex> lck{m_mapOfDataTriggeredDelegatesMutex};
-            if ((nullptr == delegate) && (m_mapOfDataTriggeredDelegates.count(messageIdentifier) > 0)) {
+            if (nullptr == delegate) {
                 auto element = m_mapOfDataTriggeredDelegates.find(messageIdentifier);
                 if (element != m_mapOfDataTriggeredDelegates.end()) {
                     m_mapOfDataTriggeredDelegates.erase(element);
@@ -75,55 +113,279 @@ bool OD4Session::dataTrigger(int32_t messageIdentifier, std::function<void(cluon
             } else {
                 m_mapOfDataTriggeredDelegates[messageIdentifier] = delegate;
             }
+
+            // Publish a new dispatch table.
+            std::unique_ptr<DispatchTable> table{new DispatchTable()};
+            table->reserve(m_mapOfDataTriggeredDelegates.size());
+            for (const auto &e : m_mapOfDataTriggeredDelegates) {
+                table->emplace_back(e.first, std::make_shared<const std::function<void(cluon::data::Envelope && envelope)>>(e.second));
+            }
+            std::sort(table->begin(), table->end(), [](const DispatchTable::value_type &a, const DispatchTable::value_type &b) {
+                return a.first < b.first;
+            });
+            m_retiredDispatchTables.reserve(m_retiredDispatchTables.size() + 1);
+            std::unique_ptr<DispatchTable> previousTable{m_dispatchTable.exchange(table.release())};
+            if (previousTable) {
+                m_retiredDispatchTables.push_back(std::move(previousTable));
+            }
+
+            // Readers announce themselves before loading the table; thus, no reader can
+            // access a retired table anymore once there is no reader at all.
+            if (0 == m_numberOfDispatchTableReaders.load()) {
+                m_retiredDispatchTables.clear();
+            }
+
+            if (m_useSocketFilter) {
+                updateSocketFilter();
+            }
             retVal = true;
         } catch (...) {} // LCOV_EXCL_LINE
     }
     return retVal;
 }
 
-void OD4Session::callback(std::string &&data, std::string && /*from*/, std::chrono::system_clock::time_point &&timepoint) noexcept {
-    size_t numberOfDataTriggeredDelegates{0};
+std::shared_ptr<const std::function<void(cluon::data::Envelope &&envelope)>> OD4Session::findDataTriggeredDelegate(int32_t messageIdentifier) noexcept {
+    std::shared_ptr<const std::function<void(cluon::data::Envelope && envelope)>> delegate{nullptr};
+    m_numberOfDispatchTableReaders++;
     {
+        const DispatchTable *table{m_dispatchTable.load()};
+        if (nullptr != table) {
+            auto element = std::lower_bound(table->begin(), table->end(), messageIdentifier, [](const DispatchTable::value_type &e, int32_t id) {
+                return e.first < id;
+            });
+            if ((element != table->end()) && (element->first == messageIdentifier)) {
+                // Copying the shared_ptr keeps the delegate alive after leaving the table.
+                delegate = element->second;
+            }
+        }
+    }
+    m_numberOfDispatchTableReaders--;
+    return delegate;
+}
+
+bool OD4Session::useSocketFilter(bool enable) noexcept {
+    bool retVal{false};
+#ifdef __linux__
+    if (nullptr == m_delegate) {
         try {
             std::lock_guard<std::mutex> lck{m_mapOfDataTriggeredDelegatesMutex};
-            numberOfDataTriggeredDelegates = m_mapOfDataTriggeredDelegates.size();
+            m_useSocketFilter = enable;
+            retVal            = (enable ? updateSocketFilter() : m_receiver->detachSocketFilter());
         } catch (...) {} // LCOV_EXCL_LINE
     }
+#else
+    (void)enable;
+#endif
+    return retVal;
+}
+
+bool OD4Session::updateSocketFilter() noexcept {
+    bool retVal{false};
+#ifdef __linux__
+    try {
+        // The filter sees the UDP header (8 bytes) followed by 0x0D 0xA4 LEN0 LEN1 LEN2 0x08 dataType.
+        constexpr uint32_t OD4_HEADER_BYTE0{8};
+        constexpr uint32_t OD4_HEADER_BYTE1{9};
+        constexpr uint32_t DATATYPE_KEY{13};
+        constexpr uint32_t DATATYPE_VALUE{14};
+        constexpr uint32_t DROP{0};
+        constexpr uint32_t ACCEPT{0xFFFFFFFF};
+
+        std::vector<struct sock_filter> program;
+        auto loadByte = [&program](uint32_t offset) {
+            struct sock_filter f {};
+            f.code = static_cast<uint16_t>(BPF_LD | BPF_B | BPF_ABS);
+            f.k    = offset;
+            program.push_back(f);
+        };
+        auto jumpIfEqual = [&program](uint32_t value, uint8_t jt, uint8_t jf) {
+            struct sock_filter f {};
+            f.code = static_cast<uint16_t>(BPF_JMP | BPF_JEQ | BPF_K);
+            f.jt   = jt;
+            f.jf   = jf;
+            f.k    = value;
+            program.push_back(f);
+        };
+        auto returnValue = [&program](uint32_t value) {
+            struct sock_filter f {};
+            f.code = static_cast<uint16_t>(BPF_RET | BPF_K);
+            f.k    = value;
+            program.push_back(f);
+        };
+
+        // Drop anything that is not an OD4 Envelope or a fragment of it.
+        loadByte(OD4_HEADER_BYTE0);
+        jumpIfEqual(0x0D, 0, 3);
+        loadByte(OD4_HEADER_BYTE1);
+        jumpIfEqual(0xA4, 2, 0);
+        jumpIfEqual(0xA5, 1, 0);
+        returnValue(DROP);
+
+        // Let user space decide when the Envelope does not start with the field dataType.
+        loadByte(DATATYPE_KEY);
+        jumpIfEqual((1 << 3) | static_cast<uint8_t>(ProtoConstants::VARINT), 1, 0);
+        returnValue(ACCEPT);
+
+        // Compare the VarInt-encoded dataType byte by byte for every delegate.
+        for (const auto &e : m_mapOfDataTriggeredDelegates) {
+            std::vector<uint8_t> varInt;
+            uint32_t zigZag{(static_cast<uint32_t>(e.first) << 1) ^ static_cast<uint32_t>(e.first >> 31)};
+            while (0x80 <= zigZag) {
+                varInt.push_back(static_cast<uint8_t>((zigZag & 0x7F) | 0x80));
+                zigZag >>= 7;
+            }
+            varInt.push_back(static_cast<uint8_t>(zigZag));
+
+            const std::size_t LENGTH{varInt.size()};
+            for (std::size_t i{0}; i < LENGTH; i++) {
+                loadByte(DATATYPE_VALUE + static_cast<uint32_t>(i));
+                // On mismatch, skip the remaining comparisons and the return of this block.
+                jumpIfEqual(varInt[i], 0, static_cast<uint8_t>(2 * (LENGTH - 1 - i) + 1));
+            }
+            returnValue(ACCEPT);
+        }
+        returnValue(DROP);
+
+        retVal = m_receiver->attachSocketFilter(program);
+        if (!retVal) {
+            // Too many delegates for one filter; do not keep an outdated one.
+            m_receiver->detachSocketFilter();
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+#endif
+    return retVal;
+}
+
+void OD4Session::callback(cluon::PooledBuffer &&data, const struct sockaddr_in &from, std::chrono::system_clock::time_point &&timepoint) noexcept {
+    bool isOfInterest{nullptr != m_delegate};
+    if (!isOfInterest) {
+        // Only look at the dataType to discard Envelopes without data-triggered delegate before decoding.
+        const auto DATATYPE{peekEnvelopeDataType(data.data(), data.size())};
+        if (DATATYPE.first) {
+            isOfInterest = (nullptr != findDataTriggeredDelegate(DATATYPE.second));
+        } else {
+            m_numberOfDispatchTableReaders++;
+            const DispatchTable *table{m_dispatchTable.load()};
+            isOfInterest = ((nullptr != table) && !table->empty());
+            m_numberOfDispatchTableReaders--;
+        }
+    }
     // Only unpack the envelope when it needs to be post-processed.
-    if ((nullptr != m_delegate) || (0 < numberOfDataTriggeredDelegates)) {
-        std::stringstream sstr(data);
-        auto retVal = extractEnvelope(sstr);
+    if (isOfInterest) {
+        std::pair<bool, cluon::data::Envelope> retVal;
+        if (FragmentAssembler::isFragment(data.data(), data.size())) {
+            // Fragments are distinguished by their sender's address and port.
+            const uint64_t SENDER{(static_cast<uint64_t>(from.sin_addr.s_addr) << 16) | from.sin_port};
+            auto complete = m_fragmentAssembler.add(data.data(), data.size(), SENDER, std::chrono::steady_clock::now());
+            data.release();
+            if (!complete.first) {
+                return;
+            }
+            retVal = extractEnvelope(complete.second.data(), complete.second.size());
+        } else {
+            // Decode directly from the received slab.
+            retVal = extractEnvelope(data.data(), data.size());
+            data.release();
+        }
 
         if (retVal.first) {
-            cluon::data::Envelope env{retVal.second};
+            cluon::data::Envelope env{std::move(retVal.second)};
             env.received(cluon::time::convert(timepoint));
 
-            // "Catch all"-delegate.
-            if (nullptr != m_delegate) {
-                m_delegate(std::move(env));
+            if (m_workers.empty()) {
+                dispatch(std::move(env));
             } else {
-                try {
-                    // Data triggered-delegates.
-                    std::lock_guard<std::mutex> lck{m_mapOfDataTriggeredDelegatesMutex};
-                    if (m_mapOfDataTriggeredDelegates.count(env.dataType()) > 0) {
-                        m_mapOfDataTriggeredDelegates[env.dataType()](std::move(env));
-                    }
-                } catch (...) {} // LCOV_EXCL_LINE
+                // All Envelopes of the same dataType are handled by the same worker to keep their order.
+                const std::size_t WORKER{static_cast<uint32_t>(env.dataType()) % m_workers.size()};
+                WorkerEntry entry;
+                entry.m_envelope = std::move(env);
+                entry.m_enqueued = std::chrono::steady_clock::now();
+                m_workers[WORKER]->m_pipeline->add(std::move(entry));
+                m_workers[WORKER]->m_pipeline->notifyAll();
             }
         }
     }
 }
 
+void OD4Session::dispatch(cluon::data::Envelope &&envelope) noexcept {
+    // "Catch all"-delegate.
+    // Exceptions thrown by user-supplied delegates must not escape this noexcept method.
+    if (nullptr != m_delegate) {
+        try {
+            m_delegate(std::move(envelope));
+        } catch (...) {} // LCOV_EXCL_LINE
+    } else {
+        // Data-triggered delegates are looked up without locking; thus, a delegate may call dataTrigger itself.
+        auto delegate = findDataTriggeredDelegate(envelope.dataType());
+        if (nullptr != delegate) {
+            try {
+                (*delegate)(std::move(envelope));
+            } catch (...) {} // LCOV_EXCL_LINE
+        }
+    }
+}
+
 void OD4Session::send(cluon::data::Envelope &&envelope) noexcept {
     sendInternal(cluon::serializeEnvelope(std::move(envelope)));
 }
 
-void OD4Session::sendInternal(std::string &&dataToSend) noexcept {
-    m_sender.send(std::move(dataToSend));
+void OD4Session::sendInternal(const std::string &dataToSend) noexcept {
+    constexpr std::size_t MAX_LENGTH = static_cast<uint16_t>(UDPPacketSizeConstraints::MAX_SIZE_UDP_PACKET)
+                                       - static_cast<uint16_t>(UDPPacketSizeConstraints::SIZE_IPv4_HEADER)
+                                       - static_cast<uint16_t>(UDPPacketSizeConstraints::SIZE_UDP_HEADER);
+    if (dataToSend.empty()) {
+        std::cerr << "[cluon::OD4Session]: Envelope exceeds the maximum size of " << 0xFFFFFF << " bytes and cannot be sent." << std::endl;
+    } else if (MAX_LENGTH < dataToSend.size()) {
+        // Send all fragments with as few system calls as possible.
+        const auto DATATYPE{peekEnvelopeDataType(dataToSend.data(), dataToSend.size())};
+        std::vector<std::string> fragments{FragmentAssembler::fragment(dataToSend, DATATYPE.second, m_fragmentSequenceNumber++, MAX_LENGTH)};
+        if (fragments.empty()) {
+            std::cerr << "[cluon::OD4Session]: Envelope with " << dataToSend.size() << " bytes is too large to be sent." << std::endl;
+        } else {
+            m_sender.send(std::move(fragments));
+        }
+    } else {
+        m_sender.send(dataToSend.data(), dataToSend.size());
+    }
 }
 
 bool OD4Session::isRunning() noexcept {
     return m_receiver->isRunning();
 }
 
+void OD4Session::setOverflowPolicy(cluon::NotifyingPipelineOverflowPolicy overflowPolicy) noexcept {
+    m_receiver->setOverflowPolicy(overflowPolicy);
+}
+
+cluon::NotifyingPipelineStatistics OD4Session::pipelineStatistics() const noexcept {
+    return m_receiver->pipelineStatistics();
+}
+
+cluon::FragmentAssemblerStatistics OD4Session::fragmentStatistics() const noexcept {
+    return m_fragmentAssembler.statistics();
+}
+
+std::vector<OD4Session::WorkerStatistics> OD4Session::workerStatistics() const noexcept {
+    std::vector<WorkerStatistics> retVal;
+    try {
+        for (const auto &worker : m_workers) {
+            const cluon::NotifyingPipelineStatistics PIPELINE_STATS{worker->m_pipeline->statistics()};
+            WorkerStatistics stats;
+            stats.numberOfProcessedEnvelopes = worker->m_numberOfProcessedEnvelopes.load();
+            stats.numberOfDroppedEnvelopes   = PIPELINE_STATS.numberOfDroppedEntries;
+            stats.highWaterMark              = PIPELINE_STATS.highWaterMark;
+
+            // The counters are read independently; thus, avoid underflows.
+            const uint64_t HANDLED{stats.numberOfProcessedEnvelopes + stats.numberOfDroppedEnvelopes};
+            stats.queueDepth = (PIPELINE_STATS.numberOfQueuedEntries > HANDLED) ? (PIPELINE_STATS.numberOfQueuedEntries - HANDLED) : 0;
+
+            stats.averageLatencyInMicroseconds
+                = (0 < stats.numberOfProcessedEnvelopes) ? worker->m_sumOfLatencies.load() / static_cast<int64_t>(stats.numberOfProcessedEnvelopes) : 0;
+            stats.maximumLatencyInMicroseconds = worker->m_maximumLatency.load();
+            retVal.push_back(stats);
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return retVal;
+}
+
 } // namespace cluon
@@ -8,8 +8,19 @@
 
 #include "cluon/Player.hpp"
 #include "cluon/Envelope.hpp"
+#include "cluon/RecFileIndex.hpp"
 #include "cluon/Time.hpp"
 
+// clang-format off
+#ifndef WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/types.h>
+    #include <unistd.h>
+#endif
+// clang-format on
+
 #include <algorithm>
 #include <chrono>
 #include <cmath>
@@ -22,25 +33,24 @@
 
 namespace cluon {
 
-IndexEntry::IndexEntry(const int64_t &sampleTimeStamp, const uint64_t &filePosition) noexcept
-    : m_sampleTimeStamp(sampleTimeStamp)
-    , m_filePosition(filePosition)
-    , m_available(false) {}
-
-////////////////////////////////////////////////////////////////////////
-
 Player::Player(const std::string &file, const bool &autoRewind, const bool &threading) noexcept
     : m_threading(threading)
     , m_file(file)
     , m_recFile()
     , m_recFileValid(false)
+    , m_mappedRecFile(nullptr)
+    , m_mappedRecFileSize(0)
+    , m_mappedRecFileDescriptor(-1)
+    , m_mappedRecFileTruncated(false)
+    , m_readAheadBegin(0)
+    , m_readAheadEnd(0)
     , m_autoRewind(autoRewind)
     , m_indexMutex()
-    , m_index()
-    , m_previousPreviousEnvelopeAlreadyReplayed(m_index.end())
-    , m_previousEnvelopeAlreadyReplayed(m_index.begin())
-    , m_currentEnvelopeToReplay(m_index.begin())
-    , m_nextEntryToReadFromRecFile(m_index.begin())
+    , m_indexSampleTimeStamps()
+    , m_indexFilePositions()
+    , m_previousEnvelopeAlreadyReplayed(0)
+    , m_currentEnvelopeToReplay(0)
+    , m_nextEntryToReadFromRecFile(0)
     , m_desiredInitialLevel(0)
     , m_firstTimePointReturningAEnvelope()
     , m_numberOfReturnedEnvelopesInTotal(0)
@@ -68,6 +78,7 @@ Player::~Player() {
         m_envelopeCacheFillingThread.join();
     }
 
+    unmapRecFile();
     m_recFile.close();
 }
 
@@ -85,47 +96,115 @@ void Player::initializeIndex() noexcept {
     m_recFileValid = m_recFile.good();
 
     if (m_recFileValid) {
-        // Determine file size to display progress.
-        m_recFile.seekg(0, m_recFile.end);
-        int64_t fileLength = m_recFile.tellg();
-        m_recFile.seekg(0, m_recFile.beg);
-
-        // Read complete file and store file positions to envelopes to create
-        // index of available data. The actual reading of Envelopes is deferred.
-        uint64_t totalBytesRead = 0;
         const cluon::data::TimeStamp BEFORE{cluon::time::now()};
-        {
-            int32_t oldPercentage = -1;
-            while (m_recFile.good()) {
-                const uint64_t POS_BEFORE = static_cast<uint64_t>(m_recFile.tellg());
-                auto retVal               = extractEnvelope(m_recFile);
-                const uint64_t POS_AFTER  = static_cast<uint64_t>(m_recFile.tellg());
-
-                if (!m_recFile.eof() && retVal.first) {
-                    totalBytesRead += (POS_AFTER - POS_BEFORE);
-
-                    // Store mapping .rec file position --> index entry.
-                    const int64_t microseconds = cluon::time::toMicroseconds(retVal.second.sampleTimeStamp());
-                    m_index.emplace(std::make_pair(microseconds, IndexEntry(microseconds, POS_BEFORE)));
-
-                    const int32_t percentage = static_cast<int32_t>((static_cast<float>(m_recFile.tellg()) * 100.0f) / static_cast<float>(fileLength));
-                    if ((percentage % 5 == 0) && (percentage != oldPercentage)) {
-                        std::clog << "[cluon::Player]: Indexed " << percentage << "% from " << m_file << "." << std::endl;
-                        oldPercentage = percentage;
-                    }
-                }
-            }
+
+        // Use the index file from a previous run if it matches the .rec file;
+        // otherwise, scan the complete file in parallel chunks and store file positions
+        // to envelopes to create the index. The actual reading of Envelopes is deferred.
+        auto index = RecFileIndex::read(m_file);
+        const bool INDEX_FILE_LOADED{index.first};
+        if (!INDEX_FILE_LOADED) {
+            index.second = RecFileIndex::build(m_file);
+            RecFileIndex::write(m_file, index.second);
+        }
+
+        // Sort chronologically; Envelopes with the same sample time stamp remain in the order of the .rec file.
+        auto isEarlier = [](const RecFileIndexEntry &a, const RecFileIndexEntry &b) { return a.m_sampleTimeStamp < b.m_sampleTimeStamp; };
+        if (!std::is_sorted(index.second.begin(), index.second.end(), isEarlier)) {
+            std::stable_sort(index.second.begin(), index.second.end(), isEarlier);
+        }
+
+        uint64_t totalBytes = 0;
+        m_indexSampleTimeStamps.reserve(index.second.size());
+        m_indexFilePositions.reserve(index.second.size());
+        for (const auto &e : index.second) {
+            m_indexSampleTimeStamps.push_back(e.m_sampleTimeStamp);
+            m_indexFilePositions.push_back(e.m_filePosition);
+            totalBytes += e.m_length;
         }
         const cluon::data::TimeStamp AFTER{cluon::time::now()};
 
-        std::clog << "[cluon::Player]: " << m_file << " contains " << m_index.size() << " entries; "
-                  << "read " << totalBytesRead << " bytes "
+        std::clog << "[cluon::Player]: " << m_file << " contains " << m_indexFilePositions.size() << " entries; "
+                  << (INDEX_FILE_LOADED ? "loaded index for " : "read ") << totalBytes << " bytes "
                   << "in " << cluon::time::deltaInMicroseconds(AFTER, BEFORE) / static_cast<int64_t>(1000 * 1000) << "s." << std::endl;
+
+        mapRecFile();
     } else {
         std::clog << "[cluon::Player]: " << m_file << " could not be opened." << std::endl;
     }
 }
 
+void Player::mapRecFile() noexcept {
+#ifndef WIN32
+    const int fd{::open(m_file.c_str(), O_RDONLY)}; /* Flawfinder: ignore */
+    if (-1 < fd) {
+        struct stat fileStatus;
+        if ((0 == ::fstat(fd, &fileStatus)) && (0 < fileStatus.st_size)
+            && (static_cast<uint64_t>(fileStatus.st_size) <= static_cast<uint64_t>((std::numeric_limits<std::size_t>::max)()))) {
+            void *mapping = ::mmap(nullptr, static_cast<std::size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED != mapping) {
+                m_mappedRecFile     = static_cast<const char *>(mapping);
+                m_mappedRecFileSize = static_cast<std::size_t>(fileStatus.st_size);
+                // Envelopes are mostly replayed in the order they were recorded.
+                ::madvise(mapping, m_mappedRecFileSize, MADV_SEQUENTIAL);
+                std::clog << "[cluon::Player]: Replaying " << m_file << " from memory-mapped file." << std::endl;
+            }
+        }
+        if (nullptr != m_mappedRecFile) {
+            // Keep the file descriptor to check the size of the file before accessing the mapping.
+            m_mappedRecFileDescriptor = fd;
+        } else {
+            ::close(fd);
+        }
+    }
+#endif
+}
+
+void Player::unmapRecFile() noexcept {
+#ifndef WIN32
+    if (nullptr != m_mappedRecFile) {
+        ::munmap(const_cast<char *>(m_mappedRecFile), m_mappedRecFileSize);
+        m_mappedRecFile     = nullptr;
+        m_mappedRecFileSize = 0;
+    }
+    if (-1 < m_mappedRecFileDescriptor) {
+        ::close(m_mappedRecFileDescriptor);
+        m_mappedRecFileDescriptor = -1;
+    }
+#endif
+}
+
+bool Player::isMappedRecFileIntact() noexcept {
+#ifndef WIN32
+    if (!m_mappedRecFileTruncated) {
+        struct stat fileStatus;
+        if ((0 != ::fstat(m_mappedRecFileDescriptor, &fileStatus)) || (static_cast<uint64_t>(fileStatus.st_size) < static_cast<uint64_t>(m_mappedRecFileSize))) {
+            m_mappedRecFileTruncated = true;
+            std::clog << "[cluon::Player]: " << m_file << " was truncated; reading remaining Envelopes without memory mapping." << std::endl;
+        }
+    }
+    return !m_mappedRecFileTruncated;
+#else
+    return false;
+#endif
+}
+
+void Player::adviseReadAhead(const uint64_t &filePosition) noexcept {
+#ifndef WIN32
+    // Advise the next range when the playback position left the current range or passed its middle.
+    if ((nullptr != m_mappedRecFile)
+        && ((filePosition < m_readAheadBegin) || (filePosition >= m_readAheadEnd)
+            || ((m_readAheadEnd < m_mappedRecFileSize) && (filePosition + static_cast<uint64_t>(READ_AHEAD_IN_BYTES / 2) > m_readAheadEnd)))) {
+        const uint64_t pageSize{static_cast<uint64_t>(::sysconf(_SC_PAGESIZE))};
+        m_readAheadBegin = filePosition - (filePosition % pageSize);
+        m_readAheadEnd   = (std::min)(static_cast<uint64_t>(m_mappedRecFileSize), m_readAheadBegin + static_cast<uint64_t>(READ_AHEAD_IN_BYTES));
+        ::madvise(const_cast<char *>(m_mappedRecFile) + m_readAheadBegin, static_cast<std::size_t>(m_readAheadEnd - m_readAheadBegin), MADV_WILLNEED);
+    }
+#else
+    (void)filePosition;
+#endif
+}
+
 void Player::resetCaches() noexcept {
     try {
         std::lock_guard<std::mutex> lck(m_indexMutex);
@@ -139,27 +218,23 @@ void Player::resetIterators() noexcept {
     try {
         std::lock_guard<std::mutex> lck(m_indexMutex);
         // Point to first entry in index.
-        m_nextEntryToReadFromRecFile = m_previousEnvelopeAlreadyReplayed = m_currentEnvelopeToReplay = m_index.begin();
-        // Invalidate iterator for erasing entries point.
-        m_previousPreviousEnvelopeAlreadyReplayed = m_index.end();
+        m_nextEntryToReadFromRecFile = m_previousEnvelopeAlreadyReplayed = m_currentEnvelopeToReplay = 0;
     } catch (...) {} // LCOV_EXCL_LINE
 }
 
 void Player::computeInitialCacheLevelAndFillCache() noexcept {
-    if (m_recFileValid && (m_index.size() > 0)) {
-        int64_t smallestSampleTimePoint = (std::numeric_limits<int64_t>::max)();
-        int64_t largestSampleTimePoint  = (std::numeric_limits<int64_t>::min)();
-        for (auto it = m_index.begin(); it != m_index.end(); it++) {
-            smallestSampleTimePoint = (std::min)(smallestSampleTimePoint, it->first);
-            largestSampleTimePoint  = (std::max)(largestSampleTimePoint, it->first);
-        }
+    if (m_recFileValid && !m_indexSampleTimeStamps.empty()) {
+        const int64_t smallestSampleTimePoint = m_indexSampleTimeStamps.front();
+        const int64_t largestSampleTimePoint  = m_indexSampleTimeStamps.back();
 
         const uint32_t ENTRIES_TO_READ_PER_SECOND_FOR_REALTIME_REPLAY
-            = static_cast<uint32_t>(std::ceil(static_cast<float>(m_index.size()) * (static_cast<float>(Player::ONE_SECOND_IN_MICROSECONDS))
+            = static_cast<uint32_t>(std::ceil(static_cast<float>(m_indexSampleTimeStamps.size()) * (static_cast<float>(Player::ONE_SECOND_IN_MICROSECONDS))
                                               / static_cast<float>(largestSampleTimePoint - smallestSampleTimePoint)));
         m_desiredInitialLevel = (std::max<uint32_t>)(ENTRIES_TO_READ_PER_SECOND_FOR_REALTIME_REPLAY * Player::LOOK_AHEAD_IN_S, MIN_ENTRIES_FOR_LOOK_AHEAD);
 
-        std::clog << "[cluon::Player]: Initializing cache with " << m_desiredInitialLevel << " entries." << std::endl;
+        if (nullptr == m_mappedRecFile) {
+            std::clog << "[cluon::Player]: Initializing cache with " << m_desiredInitialLevel << " entries." << std::endl;
+        }
 
         resetCaches();
         resetIterators();
@@ -169,13 +244,15 @@ void Player::computeInitialCacheLevelAndFillCache() noexcept {
 
 uint32_t Player::fillEnvelopeCache(const uint32_t &maxNumberOfEntriesToReadFromFile) noexcept {
     uint32_t entriesReadFromFile = 0;
-    if (m_recFileValid && (maxNumberOfEntriesToReadFromFile > 0)) {
+    // Envelopes from a mapped .rec file are decoded when they are replayed.
+    if (m_recFileValid && (nullptr == m_mappedRecFile) && (maxNumberOfEntriesToReadFromFile > 0)) {
         // Reset any fstream's error states.
         m_recFile.clear();
 
-        while ((m_nextEntryToReadFromRecFile != m_index.end()) && (entriesReadFromFile < maxNumberOfEntriesToReadFromFile)) {
+        while ((m_nextEntryToReadFromRecFile < m_indexFilePositions.size()) && (entriesReadFromFile < maxNumberOfEntriesToReadFromFile)) {
             // Move to corresponding position in the .rec file.
-            m_recFile.seekg(static_cast<std::streamoff>(m_nextEntryToReadFromRecFile->second.m_filePosition));
+            const uint64_t FILE_POSITION{m_indexFilePositions[m_nextEntryToReadFromRecFile]};
+            m_recFile.seekg(static_cast<std::streamoff>(FILE_POSITION));
 
             // Read the corresponding cluon::data::Envelope.
             auto retVal = extractEnvelope(m_recFile);
@@ -183,8 +260,7 @@ uint32_t Player::fillEnvelopeCache(const uint32_t &maxNumberOfEntriesToReadFromF
                 // Store the envelope in the envelope cache.
                 try {
                     std::lock_guard<std::mutex> lck(m_indexMutex);
-                    m_nextEntryToReadFromRecFile->second.m_available
-                        = m_envelopeCache.emplace(std::make_pair(m_nextEntryToReadFromRecFile->second.m_filePosition, retVal.second)).second;
+                    m_envelopeCache.emplace(std::make_pair(FILE_POSITION, std::move(retVal.second)));
                 } catch (...) {} // LCOV_EXCL_LINE
 
                 m_nextEntryToReadFromRecFile++;
@@ -201,7 +277,7 @@ std::pair<bool, cluon::data::Envelope> Player::getNextEnvelopeToBeReplayed() noe
     cluon::data::Envelope envelopeToReturn;
 
     // If at "EOF", either throw exception or autorewind.
-    if (m_currentEnvelopeToReplay == m_index.end()) {
+    if (m_currentEnvelopeToReplay >= m_indexFilePositions.size()) {
         if (!m_autoRewind) {
             return std::make_pair(hasEnvelopeToReturn, envelopeToReturn);
         } else {
@@ -209,28 +285,44 @@ std::pair<bool, cluon::data::Envelope> Player::getNextEnvelopeToBeReplayed() noe
         }
     }
 
-    if (m_currentEnvelopeToReplay != m_index.end()) {
-        checkAvailabilityOfNextEnvelopeToBeReplayed();
+    if (m_currentEnvelopeToReplay < m_indexFilePositions.size()) {
+        if (nullptr == m_mappedRecFile) {
+            checkAvailabilityOfNextEnvelopeToBeReplayed();
+        }
 
         try {
             {
                 std::lock_guard<std::mutex> lck(m_indexMutex);
 
-                cluon::data::Envelope &nextEnvelope = m_envelopeCache[m_currentEnvelopeToReplay->second.m_filePosition];
-                envelopeToReturn                    = nextEnvelope;
-
-                m_delay = static_cast<uint32_t>(m_currentEnvelopeToReplay->first - m_previousEnvelopeAlreadyReplayed->first);
-
-                // TODO: Delegate deleting into own thread.
-                if (m_previousPreviousEnvelopeAlreadyReplayed != m_index.end()) {
-                    auto it = m_envelopeCache.find(m_previousEnvelopeAlreadyReplayed->second.m_filePosition);
+                const uint64_t FILE_POSITION{m_indexFilePositions[m_currentEnvelopeToReplay]};
+                if (nullptr != m_mappedRecFile) {
+                    if (isMappedRecFileIntact()) {
+                        // Decode the Envelope directly from the mapped .rec file.
+                        if (FILE_POSITION < m_mappedRecFileSize) {
+                            adviseReadAhead(FILE_POSITION);
+                            envelopeToReturn = extractEnvelope(m_mappedRecFile + FILE_POSITION, m_mappedRecFileSize - static_cast<std::size_t>(FILE_POSITION)).second;
+                        }
+                    } else {
+                        // Read the Envelope from the truncated .rec file, which fails for removed Envelopes.
+                        m_recFile.clear();
+                        m_recFile.seekg(static_cast<std::streamoff>(FILE_POSITION));
+                        auto retVal = extractEnvelope(m_recFile);
+                        if (retVal.first) {
+                            envelopeToReturn = std::move(retVal.second);
+                        }
+                    }
+                } else {
+                    // Hand out the cached Envelope and remove it from the cache.
+                    auto it = m_envelopeCache.find(FILE_POSITION);
                     if (it != m_envelopeCache.end()) {
+                        envelopeToReturn = std::move(it->second);
                         m_envelopeCache.erase(it);
                     }
                 }
 
-                m_previousPreviousEnvelopeAlreadyReplayed = m_previousEnvelopeAlreadyReplayed;
-                m_previousEnvelopeAlreadyReplayed         = m_currentEnvelopeToReplay++;
+                m_delay = static_cast<uint32_t>(m_indexSampleTimeStamps[m_currentEnvelopeToReplay] - m_indexSampleTimeStamps[m_previousEnvelopeAlreadyReplayed]);
+
+                m_previousEnvelopeAlreadyReplayed = m_currentEnvelopeToReplay++;
 
                 m_numberOfReturnedEnvelopesInTotal++;
             }
@@ -269,7 +361,7 @@ void Player::checkAvailabilityOfNextEnvelopeToBeReplayed() noexcept {
 
 uint32_t Player::totalNumberOfEnvelopesInRecFile() const noexcept {
     std::lock_guard<std::mutex> lck(m_indexMutex);
-    return static_cast<uint32_t>(m_index.size());
+    return static_cast<uint32_t>(m_indexFilePositions.size());
 }
 
 uint32_t Player::delay() const noexcept {
@@ -296,56 +388,60 @@ void Player::rewind() noexcept {
 
 void Player::seekTo(float ratio) noexcept {
     if (!(ratio < 0) && !(ratio > 1)) {
-        bool enableThreading = m_threading;
-        if (m_threading) {
-            // Stop concurrent thread.
-            setEnvelopeCacheFillingRunning(false);
-            m_envelopeCacheFillingThread.join();
-        }
-
-        // Read data sequentially.
-        m_threading = false;
-
-        resetCaches();
-        resetIterators();
-
-        uint32_t numberOfEntriesInIndex = 0;
+        std::size_t numberOfEntriesInIndex{0};
         try {
             std::lock_guard<std::mutex> lck(m_indexMutex);
-            numberOfEntriesInIndex = static_cast<uint32_t>(m_index.size());
+            numberOfEntriesInIndex = m_indexFilePositions.size();
         } catch (...) {} // LCOV_EXCL_LINE
 
-        // Fast forward.
-        m_numberOfReturnedEnvelopesInTotal = 0;
-        std::clog << "[cluon::Player]: Seeking to " << static_cast<float>(numberOfEntriesInIndex) * ratio << "/" << numberOfEntriesInIndex << std::endl;
-        if (0 < ratio) {
-            for (m_numberOfReturnedEnvelopesInTotal = 0;
-                 m_numberOfReturnedEnvelopesInTotal < static_cast<uint32_t>(static_cast<float>(numberOfEntriesInIndex) * ratio) - 1;
-                 m_numberOfReturnedEnvelopesInTotal++) {
-                m_currentEnvelopeToReplay++;
-            }
+        if (0 < numberOfEntriesInIndex) {
+            std::clog << "[cluon::Player]: Seeking to " << static_cast<float>(numberOfEntriesInIndex) * ratio << "/" << numberOfEntriesInIndex << std::endl;
+            seekToEntry((std::min)(static_cast<std::size_t>(static_cast<float>(numberOfEntriesInIndex) * ratio), numberOfEntriesInIndex - 1));
+            std::clog << "[cluon::Player]: Seeking done." << std::endl;
         }
-        try {
-            std::lock_guard<std::mutex> lck(m_indexMutex);
-            m_nextEntryToReadFromRecFile = m_previousEnvelopeAlreadyReplayed = m_currentEnvelopeToReplay;
-        } catch (...) {} // LCOV_EXCL_LINE
+    }
+}
 
-        // Refill cache.
-        m_envelopeCache.clear();
-        fillEnvelopeCache(static_cast<uint32_t>(static_cast<float>(m_desiredInitialLevel) * .3f));
+void Player::seekToSampleTimeStamp(const cluon::data::TimeStamp &sampleTimeStamp) noexcept {
+    std::size_t entry{0};
+    std::size_t numberOfEntriesInIndex{0};
+    try {
+        std::lock_guard<std::mutex> lck(m_indexMutex);
+        numberOfEntriesInIndex = m_indexSampleTimeStamps.size();
+        entry = static_cast<std::size_t>(
+            std::lower_bound(m_indexSampleTimeStamps.begin(), m_indexSampleTimeStamps.end(), cluon::time::toMicroseconds(sampleTimeStamp))
+            - m_indexSampleTimeStamps.begin());
+    } catch (...) {} // LCOV_EXCL_LINE
 
-        // Correct iterators if not at the beginning.
-        if ((0 < ratio) && (ratio < 1)) {
-            getNextEnvelopeToBeReplayed();
-        }
-        std::clog << "[cluon::Player]: Seeking done." << std::endl;
+    std::clog << "[cluon::Player]: Seeking to " << entry << "/" << numberOfEntriesInIndex << std::endl;
+    seekToEntry(entry);
+    std::clog << "[cluon::Player]: Seeking done." << std::endl;
+}
 
-        if (enableThreading) {
-            m_threading = enableThreading;
-            // Re-start concurrent thread.
-            setEnvelopeCacheFillingRunning(true);
-            m_envelopeCacheFillingThread = std::thread(&Player::manageCache, this);
-        }
+void Player::seekToEntry(std::size_t entry) noexcept {
+    const bool enableThreading = m_threading;
+    if (m_threading) {
+        // Stop concurrent thread.
+        setEnvelopeCacheFillingRunning(false);
+        m_envelopeCacheFillingThread.join();
+    }
+
+    resetCaches();
+    try {
+        std::lock_guard<std::mutex> lck(m_indexMutex);
+        m_nextEntryToReadFromRecFile = m_currentEnvelopeToReplay = entry;
+        // The delay for the next Envelope is computed relative to its predecessor.
+        m_previousEnvelopeAlreadyReplayed  = (0 < entry) ? (std::min)(entry, m_indexSampleTimeStamps.size()) - 1 : 0;
+        m_numberOfReturnedEnvelopesInTotal = entry;
+    } catch (...) {} // LCOV_EXCL_LINE
+
+    // Refill cache.
+    fillEnvelopeCache(static_cast<uint32_t>(static_cast<float>(m_desiredInitialLevel) * .3f));
+
+    if (enableThreading) {
+        // Re-start concurrent thread.
+        setEnvelopeCacheFillingRunning(true);
+        m_envelopeCacheFillingThread = std::thread(&Player::manageCache, this);
     }
 }
 
@@ -358,7 +454,7 @@ bool Player::hasMoreDataFromRecFile() const noexcept {
     // File must be successfully opened AND
     //  the Player must be configured as m_autoRewind OR
     //  some entries are left to replay.
-    return (m_recFileValid && (m_autoRewind || (m_currentEnvelopeToReplay != m_index.end())));
+    return (m_recFileValid && (m_autoRewind || (m_currentEnvelopeToReplay < m_indexFilePositions.size())));
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -379,14 +475,17 @@ void Player::manageCache() noexcept {
     uint32_t numberOfEntries  = 0;
 
     while (isEnvelopeCacheFillingRunning()) {
-        try {
-            std::lock_guard<std::mutex> lck(m_indexMutex);
-            numberOfEntries = static_cast<uint32_t>(m_envelopeCache.size());
-        } catch (...) {} // LCOV_EXCL_LINE
+        // Envelopes from a mapped .rec file are not cached.
+        if (nullptr == m_mappedRecFile) {
+            try {
+                std::lock_guard<std::mutex> lck(m_indexMutex);
+                numberOfEntries = static_cast<uint32_t>(m_envelopeCache.size());
+            } catch (...) {} // LCOV_EXCL_LINE
 
-        // Check if refilling of the cache is needed.
-        refillMultiplicator = checkRefillingCache(numberOfEntries, refillMultiplicator);
-        (void)refillMultiplicator;
+            // Check if refilling of the cache is needed.
+            refillMultiplicator = checkRefillingCache(numberOfEntries, refillMultiplicator);
+            (void)refillMultiplicator;
+        }
 
         // Manage cache at 10 Hz.
         using namespace std::chrono_literals;
@@ -400,7 +499,7 @@ void Player::manageCache() noexcept {
                 // m_numberOfReturnedEnvelopesInTotal is modified in a different thread.
                 std::lock_guard<std::mutex> lck(m_indexMutex);
                 numberOfReturnedEnvelopesInTotal = m_numberOfReturnedEnvelopesInTotal;
-                totalNumberOfEnvelopes           = static_cast<uint32_t>(m_index.size());
+                totalNumberOfEnvelopes           = static_cast<uint32_t>(m_indexFilePositions.size());
             } catch (...) {} // LCOV_EXCL_LINE
 
             try {
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "cluon/ProtoSizeVisitor.hpp"
+
+namespace cluon {
+
+std::size_t ProtoSizeVisitor::encodedSize() const noexcept {
+    return m_size;
+}
+
+void ProtoSizeVisitor::reset() noexcept {
+    m_size = 0;
+}
+
+std::size_t ProtoSizeVisitor::sizeOfVarInt(uint64_t v) noexcept {
+    std::size_t size{1};
+    while (0x7f < v) {
+        v >>= 7;
+        size++;
+    }
+    return size;
+}
+
+void ProtoSizeVisitor::preVisit(int32_t id, const char *shortName, const char *longName) noexcept {
+    (void)id;
+    (void)shortName;
+    (void)longName;
+}
+
+void ProtoSizeVisitor::postVisit() noexcept {}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
+    (void)typeName;
+    (void)name;
+    (void)v;
+    sizeOfKeyValue(id, ProtoConstants::VARINT, 1);
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
+    (void)typeName;
+    (void)name;
+    sizeOfKeyValue(id, ProtoConstants::VARINT, sizeOfVarInt(static_cast<uint8_t>(v)));
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    sizeOfKeyValue(id, ProtoConstants::VARINT, sizeOfVarInt(static_cast<uint8_t>((v << 1) ^ (v >> ((sizeof(v) * 8) - 1)))));
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    sizeOfKeyValue(id, ProtoConstants::VARINT, sizeOfVarInt(v));
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    sizeOfKeyValue(id, ProtoConstants::VARINT, sizeOfVarInt(static_cast<uint16_t>((v << 1) ^ (v >> ((sizeof(v) * 8) - 1)))));
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    sizeOfKeyValue(id, ProtoConstants::VARINT, sizeOfVarInt(v));
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    sizeOfKeyValue(id, ProtoConstants::VARINT, sizeOfVarInt(static_cast<uint32_t>((v << 1) ^ (v >> ((sizeof(v) * 8) - 1)))));
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    sizeOfKeyValue(id, ProtoConstants::VARINT, sizeOfVarInt(v));
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    sizeOfKeyValue(id, ProtoConstants::VARINT, sizeOfVarInt(static_cast<uint64_t>((v << 1) ^ (v >> ((sizeof(v) * 8) - 1)))));
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
+    (void)typeName;
+    (void)name;
+    sizeOfKeyValue(id, ProtoConstants::VARINT, sizeOfVarInt(v));
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
+    (void)typeName;
+    (void)name;
+    (void)v;
+    sizeOfKeyValue(id, ProtoConstants::FOUR_BYTES, sizeof(uint32_t));
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
+    (void)typeName;
+    (void)name;
+    (void)v;
+    sizeOfKeyValue(id, ProtoConstants::EIGHT_BYTES, sizeof(uint64_t));
+}
+
+void ProtoSizeVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
+    (void)typeName;
+    (void)name;
+    sizeOfLengthDelimited(id, v.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ProtoSizeVisitor::sizeOfKeyValue(uint32_t id, ProtoConstants protoType, std::size_t sizeOfValue) noexcept {
+    // Same key as in ToProtoVisitor::encodeKey.
+    const uint64_t KEY{(id << 0x3) | static_cast<uint8_t>(protoType)};
+    m_size += sizeOfVarInt(KEY) + sizeOfValue;
+}
+
+void ProtoSizeVisitor::sizeOfLengthDelimited(uint32_t id, std::size_t length) noexcept {
+    sizeOfKeyValue(id, ProtoConstants::LENGTH_DELIMITED, sizeOfVarInt(length) + length);
+}
+} // namespace cluon
@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2017-2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "cluon/Reactor.hpp"
+
+// clang-format off
+#ifdef WIN32
+    #include <winsock2.h>
+#else
+    #ifdef __linux__
+        #include <sys/epoll.h>
+        #include <sys/eventfd.h>
+    #endif
+
+    #include <sys/select.h>
+    #include <sys/time.h>
+    #include <sys/types.h>
+    #include <unistd.h>
+#endif
+// clang-format on
+
+#include <cerrno>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace cluon {
+
+Reactor::Reactor() noexcept {
+#ifdef __linux__
+    m_epollFileDescriptor  = ::epoll_create1(EPOLL_CLOEXEC);
+    m_wakeUpFileDescriptor = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if ((m_epollFileDescriptor < 0) || (m_wakeUpFileDescriptor < 0)) {
+        std::cerr << "[cluon::Reactor] Failed to create epoll/eventfd: " << ::strerror(errno) << std::endl; // LCOV_EXCL_LINE
+        return;                                                                                             // LCOV_EXCL_LINE
+    }
+
+    struct epoll_event event {};
+    event.events  = EPOLLIN;
+    event.data.fd = m_wakeUpFileDescriptor;
+    if (0 > ::epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_ADD, m_wakeUpFileDescriptor, &event)) {
+        std::cerr << "[cluon::Reactor] Failed to register eventfd: " << ::strerror(errno) << std::endl; // LCOV_EXCL_LINE
+        return;                                                                                         // LCOV_EXCL_LINE
+    }
+#endif
+
+    // Constructing the thread could fail.
+    try {
+        m_reactorThread = std::thread(&Reactor::run, this);
+
+        // Let the operating system spawn the thread.
+        using namespace std::literals::chrono_literals; // NOLINT
+        do { std::this_thread::sleep_for(1ms); } while (!m_reactorThreadRunning.load());
+    } catch (...) { // LCOV_EXCL_LINE
+        std::cerr << "[cluon::Reactor] Failed to start thread." << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+Reactor::~Reactor() noexcept {
+    m_reactorThreadRunning.store(false);
+
+#ifdef __linux__
+    if (!(m_wakeUpFileDescriptor < 0)) {
+        // Wake up the thread blocked in epoll_wait.
+        const uint64_t ONE{1};
+        if (0 > ::write(m_wakeUpFileDescriptor, &ONE, sizeof(ONE))) {
+            std::cerr << "[cluon::Reactor] Failed to wake up thread: " << ::strerror(errno) << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+#endif
+
+    // Joining the thread could fail.
+    try {
+        if (m_reactorThread.joinable()) {
+            m_reactorThread.join();
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+
+#ifdef __linux__
+    if (!(m_wakeUpFileDescriptor < 0)) {
+        ::close(m_wakeUpFileDescriptor);
+    }
+    if (!(m_epollFileDescriptor < 0)) {
+        ::close(m_epollFileDescriptor);
+    }
+#endif
+}
+
+bool Reactor::isRunning() const noexcept {
+    return m_reactorThreadRunning.load();
+}
+
+bool Reactor::add(int32_t fileDescriptor, std::function<void()> delegate) noexcept {
+    if ((fileDescriptor < 0) || (nullptr == delegate) || !m_reactorThreadRunning.load()) {
+        return false;
+    }
+
+    try {
+        std::lock_guard<std::mutex> lck(m_delegatesMutex);
+        if (m_delegates.count(fileDescriptor) > 0) {
+            return false;
+        }
+
+#ifdef __linux__
+        struct epoll_event event {};
+        event.events  = EPOLLIN;
+        event.data.fd = fileDescriptor;
+        if (0 > ::epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_ADD, fileDescriptor, &event)) {
+            return false;
+        }
+#endif
+        m_delegates[fileDescriptor] = std::make_shared<std::function<void()>>(std::move(delegate));
+    } catch (...) { return false; } // LCOV_EXCL_LINE
+
+    return true;
+}
+
+void Reactor::remove(int32_t fileDescriptor) noexcept {
+    std::unique_lock<std::mutex> lck(m_delegatesMutex);
+    auto it = m_delegates.find(fileDescriptor);
+    if (m_delegates.end() != it) {
+        // Keep the delegate alive until it is not running anymore.
+        std::shared_ptr<std::function<void()>> delegate{it->second};
+        m_delegates.erase(it);
+#ifdef __linux__
+        ::epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_DEL, fileDescriptor, nullptr);
+#endif
+
+        // A delegate that unregisters itself must not wait for itself.
+        if (std::this_thread::get_id() != m_reactorThread.get_id()) {
+            m_delegateReturned.wait(lck, [this, &delegate]() { return m_runningDelegate != delegate.get(); });
+        }
+    }
+}
+
+std::size_t Reactor::numberOfFileDescriptors() const noexcept {
+    std::lock_guard<std::mutex> lck(m_delegatesMutex);
+    return m_delegates.size();
+}
+
+void Reactor::dispatch(int32_t fileDescriptor) noexcept {
+    std::shared_ptr<std::function<void()>> delegate;
+    {
+        std::lock_guard<std::mutex> lck(m_delegatesMutex);
+        auto it = m_delegates.find(fileDescriptor);
+        if (m_delegates.end() == it) {
+            // The socket was removed while its event was pending.
+            return;
+        }
+        delegate          = it->second;
+        m_runningDelegate = delegate.get();
+    }
+
+    (*delegate)();
+
+    {
+        std::lock_guard<std::mutex> lck(m_delegatesMutex);
+        m_runningDelegate = nullptr;
+    }
+    m_delegateReturned.notify_all();
+}
+
+void Reactor::run() noexcept {
+    // Indicate to main thread that we are ready.
+    m_reactorThreadRunning.store(true);
+
+#ifdef __linux__
+    std::array<struct epoll_event, MAX_EVENTS> events{};
+    while (m_reactorThreadRunning.load()) {
+        // Block until data is available or the eventfd is signalled.
+        const int32_t numberOfEvents = ::epoll_wait(m_epollFileDescriptor, events.data(), MAX_EVENTS, -1);
+        for (int32_t i{0}; i < numberOfEvents; i++) {
+            const int32_t fileDescriptor{events[static_cast<std::size_t>(i)].data.fd};
+            if (m_wakeUpFileDescriptor == fileDescriptor) {
+                uint64_t value{0};
+                if (0 > ::read(m_wakeUpFileDescriptor, &value, sizeof(value))) {
+                    continue; // LCOV_EXCL_LINE
+                }
+            } else {
+                dispatch(fileDescriptor);
+            }
+        }
+    }
+#else
+    struct timeval timeout {};
+    fd_set setOfFiledescriptorsToReadFrom{};
+    std::vector<int32_t> fileDescriptors;
+
+    while (m_reactorThreadRunning.load()) {
+        // Define timeout for select system call. The timeval struct must be
+        // reinitialized for every select call as it might be modified containing
+        // the actual time slept.
+        timeout.tv_sec  = 0;
+        timeout.tv_usec = 20 * 1000; // Check for new data with 50Hz.
+
+        int32_t maxFileDescriptor{-1};
+        fileDescriptors.clear();
+        FD_ZERO(&setOfFiledescriptorsToReadFrom); // NOLINT
+        {
+            std::lock_guard<std::mutex> lck(m_delegatesMutex);
+            for (const auto &e : m_delegates) {
+                FD_SET(e.first, &setOfFiledescriptorsToReadFrom); // NOLINT
+                maxFileDescriptor = (std::max)(maxFileDescriptor, e.first);
+                fileDescriptors.push_back(e.first);
+            }
+        }
+
+        if (maxFileDescriptor < 0) {
+            using namespace std::literals::chrono_literals; // NOLINT
+            std::this_thread::sleep_for(20ms);
+            continue;
+        }
+
+        if (0 < ::select(maxFileDescriptor + 1, &setOfFiledescriptorsToReadFrom, nullptr, nullptr, &timeout)) {
+            for (const auto fileDescriptor : fileDescriptors) {
+                if (FD_ISSET(fileDescriptor, &setOfFiledescriptorsToReadFrom)) { // NOLINT
+                    dispatch(fileDescriptor);
+                }
+            }
+        }
+    }
+#endif
+}
+} // namespace cluon
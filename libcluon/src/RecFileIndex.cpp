@@ -0,0 +1,384 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "cluon/RecFileIndex.hpp"
+#include "cluon/Envelope.hpp"
+#include "cluon/Time.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace cluon {
+
+std::string RecFileIndex::indexFileFor(const std::string &recFile) noexcept {
+    return recFile + ".idx";
+}
+
+std::vector<RecFileIndexEntry> RecFileIndex::build(std::istream &recFile) noexcept {
+    std::vector<RecFileIndexEntry> entries;
+    constexpr bool RESYNCHRONIZE{false};
+    constexpr bool LOG_PROGRESS{true};
+    std::string buffer;
+    scan(recFile, 0, (std::numeric_limits<uint64_t>::max)(), RESYNCHRONIZE, LOG_PROGRESS, buffer, entries);
+    return entries;
+}
+
+std::vector<RecFileIndexEntry> RecFileIndex::build(const std::string &recFile, uint32_t numberOfThreads, uint64_t bytesPerChunk) noexcept {
+    std::vector<RecFileIndexEntry> entries;
+    try {
+        std::fstream in(recFile, std::ios::in | std::ios::binary); /* Flawfinder: ignore */
+        if (!in.good()) {
+            return entries;
+        }
+        in.seekg(0, in.end);
+        const uint64_t FILE_LENGTH{static_cast<uint64_t>(in.tellg())};
+        in.seekg(0, in.beg);
+
+        if (0 == numberOfThreads) {
+            numberOfThreads = (std::max)(1u, std::thread::hardware_concurrency());
+        }
+        bytesPerChunk = (std::max)(bytesPerChunk, static_cast<uint64_t>(1));
+        const std::size_t NUMBER_OF_CHUNKS{static_cast<std::size_t>((FILE_LENGTH + bytesPerChunk - 1) / bytesPerChunk)};
+        if ((1 == numberOfThreads) || (2 > NUMBER_OF_CHUNKS)) {
+            return build(in);
+        }
+
+        // Scan the chunks concurrently; every thread including this one takes the next chunk until all are done.
+        std::vector<std::vector<RecFileIndexEntry>> entriesPerChunk(NUMBER_OF_CHUNKS);
+        std::vector<std::pair<uint64_t, uint64_t>> positionsPerChunk(NUMBER_OF_CHUNKS);
+        std::atomic<std::size_t> nextChunk{0};
+        std::atomic<std::size_t> scannedChunks{0};
+        std::mutex logMutex;
+        auto scanChunks = [&]() {
+            std::fstream chunkIn(recFile, std::ios::in | std::ios::binary); /* Flawfinder: ignore */
+            std::string buffer;
+            for (std::size_t chunk{nextChunk++}; chunkIn.good() && (chunk < NUMBER_OF_CHUNKS); chunk = nextChunk++) {
+                constexpr bool LOG_PROGRESS{false};
+                const uint64_t BEGIN{chunk * bytesPerChunk};
+                const uint64_t END{(std::min)(BEGIN + bytesPerChunk, FILE_LENGTH)};
+                positionsPerChunk[chunk] = scan(chunkIn, BEGIN, END, (0 < chunk), LOG_PROGRESS, buffer, entriesPerChunk[chunk]);
+
+                const std::size_t SCANNED{++scannedChunks};
+                const int32_t percentage{static_cast<int32_t>((SCANNED * 100) / NUMBER_OF_CHUNKS)};
+                const int32_t previousPercentage{static_cast<int32_t>(((SCANNED - 1) * 100) / NUMBER_OF_CHUNKS)};
+                if ((percentage / 5) != (previousPercentage / 5)) {
+                    std::lock_guard<std::mutex> lck(logMutex);
+                    std::clog << "[cluon::RecFileIndex]: Indexed " << (percentage / 5) * 5 << "%." << std::endl;
+                }
+            }
+        };
+        std::vector<std::thread> threads;
+        for (uint32_t i{1}; (i < numberOfThreads) && (i < NUMBER_OF_CHUNKS); i++) {
+            try {
+                threads.emplace_back(scanChunks);
+            } catch (...) { // LCOV_EXCL_LINE
+                break;      // LCOV_EXCL_LINE
+            }
+        }
+        scanChunks();
+        for (auto &t : threads) {
+            t.join();
+        }
+
+        // Merge the chunks in order; a chunk that was not resynchronized at the end
+        // of the Envelopes from its predecessor is scanned again from that position.
+        uint64_t position{0};
+        std::string buffer;
+        for (std::size_t chunk{0}; chunk < NUMBER_OF_CHUNKS; chunk++) {
+            const uint64_t END{(std::min)((chunk + 1) * bytesPerChunk, FILE_LENGTH)};
+            if (position >= END) {
+                continue;
+            }
+            if (positionsPerChunk[chunk].first != position) {
+                constexpr bool RESYNCHRONIZE{false};
+                constexpr bool LOG_PROGRESS{false};
+                entriesPerChunk[chunk].clear();
+                positionsPerChunk[chunk] = scan(in, position, END, RESYNCHRONIZE, LOG_PROGRESS, buffer, entriesPerChunk[chunk]);
+            }
+            entries.insert(entries.end(), entriesPerChunk[chunk].begin(), entriesPerChunk[chunk].end());
+            std::vector<RecFileIndexEntry>().swap(entriesPerChunk[chunk]);
+            position = positionsPerChunk[chunk].second;
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return entries;
+}
+
+std::pair<uint64_t, uint64_t> RecFileIndex::scan(std::istream &recFile, uint64_t begin, uint64_t end, bool resynchronize, bool logProgress,
+                                                 std::string &buffer, std::vector<RecFileIndexEntry> &entries) noexcept {
+    constexpr std::size_t OD4_HEADER_SIZE{5};
+    uint64_t firstPosition{resynchronize ? end : begin};
+    uint64_t nextPosition{(std::numeric_limits<uint64_t>::max)()};
+    try {
+        recFile.clear();
+        recFile.seekg(0, recFile.end);
+        const int64_t FILE_LENGTH{recFile.tellg()};
+        recFile.seekg(static_cast<std::streamoff>(begin), recFile.beg);
+
+        // The .rec file is read in large blocks and only the headers of the
+        // Envelopes are scanned; the payloads are neither decoded nor copied.
+        std::size_t blockSize{static_cast<std::size_t>(
+            (std::max)((std::min)(end - begin, static_cast<uint64_t>(BUILD_BLOCK_SIZE)), static_cast<uint64_t>(MIN_BUILD_BLOCK_SIZE)))};
+        if (buffer.size() < blockSize) {
+            buffer.resize(blockSize);
+        }
+        uint64_t bufferPosition{begin};
+        std::size_t offset{0};
+        std::size_t available{0};
+        bool synchronized{!resynchronize};
+        bool endOfFile{false};
+        bool endOfRange{false};
+
+        int32_t oldPercentage = -1;
+        while (!endOfFile && !endOfRange) {
+            // Move the not yet scanned bytes to the front and fill up the buffer.
+            if (0 < offset) {
+                std::memmove(&buffer[0], &buffer[offset], available - offset);
+                bufferPosition += offset;
+                available -= offset;
+                offset = 0;
+            }
+            recFile.read(&buffer[available], static_cast<std::streamsize>(blockSize - available));
+            available += static_cast<std::size_t>(recFile.gcount());
+            endOfFile = !recFile.good();
+
+            while (OD4_HEADER_SIZE <= (available - offset)) {
+                const uint64_t POSITION{bufferPosition + offset};
+                if (POSITION >= end) {
+                    nextPosition = POSITION;
+                    endOfRange   = true;
+                    break;
+                }
+
+                // While resynchronizing, advance byte-wise until a complete and well-formed Envelope is found.
+                const char *data{buffer.data() + offset};
+                if ((0x0D != static_cast<uint8_t>(data[0])) || (0xA4 != static_cast<uint8_t>(data[1]))) {
+                    offset += (synchronized ? OD4_HEADER_SIZE : 1);
+                    continue;
+                }
+                const std::size_t LENGTH{OD4_HEADER_SIZE + (static_cast<std::size_t>(static_cast<uint8_t>(data[2]))
+                                                             | (static_cast<std::size_t>(static_cast<uint8_t>(data[3])) << 8)
+                                                             | (static_cast<std::size_t>(static_cast<uint8_t>(data[4])) << 16))};
+                if (!synchronized && (POSITION + LENGTH > static_cast<uint64_t>(FILE_LENGTH))) {
+                    offset++;
+                    continue;
+                }
+                if (LENGTH > (available - offset)) {
+                    if (LENGTH > blockSize) {
+                        blockSize = LENGTH;
+                        if (LENGTH > buffer.size()) {
+                            buffer.resize(LENGTH);
+                        }
+                    }
+                    break;
+                }
+
+                auto retVal = scanEnvelope(data, LENGTH);
+                if (!synchronized) {
+                    if (!retVal.first) {
+                        offset++;
+                        continue;
+                    }
+                    synchronized  = true;
+                    firstPosition = POSITION;
+                }
+                if (retVal.first) {
+                    RecFileIndexEntry entry;
+                    entry.m_sampleTimeStamp = cluon::time::toMicroseconds(retVal.second.m_sampleTimeStamp);
+                    entry.m_filePosition    = POSITION;
+                    entry.m_dataType        = retVal.second.m_dataType;
+                    entry.m_senderStamp     = retVal.second.m_senderStamp;
+                    entry.m_length          = static_cast<uint32_t>(LENGTH);
+                    entries.push_back(entry);
+                }
+                offset += LENGTH;
+
+                if (logProgress) {
+                    const int32_t percentage
+                        = static_cast<int32_t>((static_cast<float>(bufferPosition + offset) * 100.0f) / static_cast<float>(FILE_LENGTH));
+                    if ((percentage % 5 == 0) && (percentage != oldPercentage)) {
+                        std::clog << "[cluon::RecFileIndex]: Indexed " << percentage << "%." << std::endl;
+                        oldPercentage = percentage;
+                    }
+                }
+            }
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return std::make_pair(firstPosition, nextPosition);
+}
+
+std::pair<bool, std::vector<RecFileIndexEntry>> RecFileIndex::read(const std::string &recFile) noexcept {
+    constexpr char INDEX_FILE_MAGIC[]{"CLUONIDX"};
+    std::vector<RecFileIndexEntry> entries;
+    try {
+        const auto FINGERPRINT{fingerprint(recFile)};
+        std::fstream indexFile(indexFileFor(recFile), std::ios::in | std::ios::binary); /* Flawfinder: ignore */
+        if ((0 <= FINGERPRINT.first) && indexFile.good()) {
+            indexFile.seekg(0, indexFile.end);
+            const int64_t INDEX_FILE_LENGTH{indexFile.tellg()};
+            indexFile.seekg(0, indexFile.beg);
+
+            char header[INDEX_FILE_HEADER_SIZE];
+            indexFile.read(header, INDEX_FILE_HEADER_SIZE);
+            if ((static_cast<std::streamsize>(INDEX_FILE_HEADER_SIZE) == indexFile.gcount())
+                && (0 == std::memcmp(header, INDEX_FILE_MAGIC, 8)) && (INDEX_FILE_VERSION == readUInt32(header + 8))
+                && (INDEX_FILE_ENTRY_SIZE == readUInt32(header + 12)) && (static_cast<uint64_t>(FINGERPRINT.first) == readUInt64(header + 16))
+                && (FINGERPRINT.second == readUInt64(header + 24))) {
+                const uint64_t NUMBER_OF_ENTRIES{readUInt64(header + 32)};
+                const uint64_t CHECKSUM{readUInt64(header + 40)};
+
+                // Reject truncated or extended index files before allocating memory.
+                if ((static_cast<uint64_t>(INDEX_FILE_LENGTH) - INDEX_FILE_HEADER_SIZE) / INDEX_FILE_ENTRY_SIZE == NUMBER_OF_ENTRIES
+                    && (static_cast<uint64_t>(INDEX_FILE_LENGTH) - INDEX_FILE_HEADER_SIZE) % INDEX_FILE_ENTRY_SIZE == 0) {
+                    entries.reserve(static_cast<std::size_t>(NUMBER_OF_ENTRIES));
+
+                    // Read the entries block-wise to not hold the index twice in memory.
+                    std::string buffer(static_cast<std::size_t>(INDEX_FILE_ENTRY_SIZE) * INDEX_FILE_ENTRIES_PER_BLOCK, '\0');
+                    uint64_t checksum{fnv1a(nullptr, 0)};
+                    uint64_t entriesToRead{NUMBER_OF_ENTRIES};
+                    bool complete{true};
+                    while (complete && (0 < entriesToRead)) {
+                        const std::size_t LENGTH{static_cast<std::size_t>((std::min)(entriesToRead, static_cast<uint64_t>(INDEX_FILE_ENTRIES_PER_BLOCK)))
+                                                 * INDEX_FILE_ENTRY_SIZE};
+                        indexFile.read(&buffer[0], static_cast<std::streamsize>(LENGTH));
+                        complete = (static_cast<std::streamsize>(LENGTH) == indexFile.gcount());
+                        checksum = fnv1a(buffer.data(), LENGTH, checksum);
+                        for (std::size_t i{0}; complete && (i < LENGTH); i += INDEX_FILE_ENTRY_SIZE) {
+                            const char *e{buffer.data() + i};
+                            RecFileIndexEntry entry;
+                            entry.m_sampleTimeStamp = static_cast<int64_t>(readUInt64(e));
+                            entry.m_filePosition    = readUInt64(e + 8);
+                            entry.m_dataType        = static_cast<int32_t>(readUInt32(e + 16));
+                            entry.m_senderStamp     = readUInt32(e + 20);
+                            entry.m_length          = readUInt32(e + 24);
+                            entries.push_back(entry);
+                        }
+                        entriesToRead -= LENGTH / INDEX_FILE_ENTRY_SIZE;
+                    }
+                    if (complete && (CHECKSUM == checksum)) {
+                        return std::make_pair(true, entries);
+                    }
+                }
+            }
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    entries.clear();
+    return std::make_pair(false, entries);
+}
+
+bool RecFileIndex::write(const std::string &recFile, const std::vector<RecFileIndexEntry> &entries) noexcept {
+    constexpr char INDEX_FILE_MAGIC[]{"CLUONIDX"};
+    bool retVal{false};
+    try {
+        const auto FINGERPRINT{fingerprint(recFile)};
+        if (0 <= FINGERPRINT.first) {
+            std::string data;
+            data.reserve(INDEX_FILE_HEADER_SIZE + entries.size() * INDEX_FILE_ENTRY_SIZE);
+            data.append(INDEX_FILE_MAGIC, 8);
+            appendUInt32(data, INDEX_FILE_VERSION);
+            appendUInt32(data, INDEX_FILE_ENTRY_SIZE);
+            appendUInt64(data, static_cast<uint64_t>(FINGERPRINT.first));
+            appendUInt64(data, FINGERPRINT.second);
+            appendUInt64(data, entries.size());
+            appendUInt64(data, 0); // Placeholder for the checksum.
+            for (const auto &entry : entries) {
+                appendUInt64(data, static_cast<uint64_t>(entry.m_sampleTimeStamp));
+                appendUInt64(data, entry.m_filePosition);
+                appendUInt32(data, static_cast<uint32_t>(entry.m_dataType));
+                appendUInt32(data, entry.m_senderStamp);
+                appendUInt32(data, entry.m_length);
+                appendUInt32(data, 0);
+            }
+            const uint64_t CHECKSUM{htole64(fnv1a(data.data() + INDEX_FILE_HEADER_SIZE, data.size() - INDEX_FILE_HEADER_SIZE))};
+            std::memcpy(&data[40], &CHECKSUM, sizeof(uint64_t));
+
+            // Write to a temporary file first so that readers never see a partially written index.
+            const std::string INDEX_FILE{indexFileFor(recFile)};
+            const std::string TMP_FILE{INDEX_FILE + ".tmp"};
+            {
+                std::fstream indexFile(TMP_FILE, std::ios::out | std::ios::binary | std::ios::trunc); /* Flawfinder: ignore */
+                if (indexFile.good()) {
+                    indexFile.write(data.data(), static_cast<std::streamsize>(data.size()));
+                    indexFile.flush();
+                    retVal = indexFile.good();
+                }
+            }
+            if (retVal) {
+                std::remove(INDEX_FILE.c_str());
+                retVal = (0 == std::rename(TMP_FILE.c_str(), INDEX_FILE.c_str()));
+            }
+            if (!retVal) {
+                std::remove(TMP_FILE.c_str());
+                std::clog << "[cluon::RecFileIndex]: Could not write " << INDEX_FILE << "." << std::endl;
+            }
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return retVal;
+}
+
+std::pair<int64_t, uint64_t> RecFileIndex::fingerprint(const std::string &recFile) noexcept {
+    int64_t size{-1};
+    uint64_t checksum{fnv1a(nullptr, 0)};
+    try {
+        std::fstream in(recFile, std::ios::in | std::ios::binary); /* Flawfinder: ignore */
+        if (in.good()) {
+            in.seekg(0, in.end);
+            size = in.tellg();
+            in.seekg(0, in.beg);
+
+            std::string buffer(FINGERPRINT_BLOCK_SIZE, '\0');
+            in.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+            checksum = fnv1a(buffer.data(), static_cast<std::size_t>(in.gcount()), checksum);
+
+            if (static_cast<int64_t>(FINGERPRINT_BLOCK_SIZE) < size) {
+                in.clear();
+                in.seekg(-static_cast<std::streamoff>(FINGERPRINT_BLOCK_SIZE), in.end);
+                in.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+                checksum = fnv1a(buffer.data(), static_cast<std::size_t>(in.gcount()), checksum);
+            }
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+    return std::make_pair(size, checksum);
+}
+
+uint64_t RecFileIndex::fnv1a(const char *data, std::size_t length, uint64_t hash) noexcept {
+    constexpr uint64_t FNV1A_PRIME{1099511628211ull};
+    for (std::size_t i{0}; (nullptr != data) && (i < length); i++) {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= FNV1A_PRIME;
+    }
+    return hash;
+}
+void RecFileIndex::appendUInt32(std::string &out, uint32_t v) noexcept {
+    v = htole32(v);
+    out.append(reinterpret_cast<const char *>(&v), sizeof(uint32_t)); // NOLINT
+}
+
+void RecFileIndex::appendUInt64(std::string &out, uint64_t v) noexcept {
+    v = htole64(v);
+    out.append(reinterpret_cast<const char *>(&v), sizeof(uint64_t)); // NOLINT
+}
+
+uint32_t RecFileIndex::readUInt32(const char *data) noexcept {
+    uint32_t v{0};
+    std::memcpy(&v, data, sizeof(uint32_t));
+    return le32toh(v);
+}
+
+uint64_t RecFileIndex::readUInt64(const char *data) noexcept {
+    uint64_t v{0};
+    std::memcpy(&v, data, sizeof(uint64_t));
+    return le64toh(v);
+}
+} // namespace cluon
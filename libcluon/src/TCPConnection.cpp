@@ -29,7 +29,6 @@
 
 #include <cstring>
 #include <algorithm>
-#include <array>
 #include <iostream>
 #include <iterator>
 #include <sstream>
@@ -105,15 +104,17 @@ TCPConnection::TCPConnection(const std::string &address,
 }
 
 TCPConnection::~TCPConnection() noexcept {
-    {
-        m_readFromSocketThreadRunning.store(false);
+    m_isReadingFromSocket.store(false);
 
-        // Joining the thread could fail.
-        try {
-            if (m_readFromSocketThread.joinable()) {
-                m_readFromSocketThread.join();
-            }
-        } catch (...) {} // LCOV_EXCL_LINE
+    // Wake readFromSocket if it is blocked on a full pipeline so that the Reactor can remove the socket.
+    if (m_pipeline) {
+        m_pipeline->stop();
+    }
+
+    if (m_reactor) {
+        // Afterwards, readFromSocket is not called anymore.
+        m_reactor->remove(m_socket);
+        m_reactor.reset();
     }
 
     m_pipeline.reset();
@@ -145,31 +146,46 @@ void TCPConnection::closeSocket(int errorCode) noexcept {
 }
 
 void TCPConnection::startReadingFromSocket() noexcept {
-    // Constructing a thread could fail.
-    try {
-        m_readFromSocketThread = std::thread(&TCPConnection::readFromSocket, this);
-
-        // Let the operating system spawn the thread.
-        using namespace std::literals::chrono_literals;
-        do { std::this_thread::sleep_for(1ms); } while (!m_readFromSocketThreadRunning.load());
-    } catch (...) {          // LCOV_EXCL_LINE
-        closeSocket(ECHILD); // LCOV_EXCL_LINE
-    }
-
+    // The pipeline must exist before the first bytes can arrive.
     try {
         m_pipeline = std::make_shared<cluon::NotifyingPipeline<PipelineEntry>>(
-            [this](PipelineEntry &&entry) { this->m_newDataDelegate(std::move(entry.m_data), std::move(entry.m_sampleTime)); });
+            [this](PipelineEntry &&entry) { this->m_newDataDelegate(std::move(entry.m_data), std::move(entry.m_sampleTime)); },
+            // The socket is only read from the Reactor's thread.
+            cluon::NotifyingPipelineBackend::SPSC_RING,
+            PIPELINE_CAPACITY,
+            // Dropping chunks would corrupt the byte stream.
+            cluon::NotifyingPipelineOverflowPolicy::BLOCK);
         if (m_pipeline) {
             // Let the operating system spawn the thread.
             using namespace std::literals::chrono_literals; // NOLINT
             do { std::this_thread::sleep_for(1ms); } while (!m_pipeline->isRunning());
         }
     } catch (...) { closeSocket(ECHILD); } // LCOV_EXCL_LINE
+
+    // Creating the Reactor could fail.
+    try {
+        constexpr uint16_t MAX_LENGTH{65535};
+        m_buffer.resize(MAX_LENGTH);
+        m_reactor = std::make_shared<cluon::Reactor>();
+        m_isReadingFromSocket.store(m_reactor->isRunning());
+    } catch (...) { closeSocket(ECHILD); } // LCOV_EXCL_LINE
+
+    std::lock_guard<std::mutex> lck(m_newDataDelegateMutex);
+    registerWithReactor();
+}
+
+void TCPConnection::registerWithReactor() noexcept {
+    // Only read data when the newDataDelegate is set; otherwise, the Reactor
+    // would be woken up over and over again by the unread bytes.
+    if (!m_isRegisteredWithReactor && m_isReadingFromSocket.load() && (nullptr != m_newDataDelegate) && m_reactor) {
+        m_isRegisteredWithReactor = m_reactor->add(m_socket, [this]() { this->readFromSocket(); });
+    }
 }
 
 void TCPConnection::setOnNewData(std::function<void(std::string &&, std::chrono::system_clock::time_point &&)> newDataDelegate) noexcept {
     std::lock_guard<std::mutex> lck(m_newDataDelegateMutex);
     m_newDataDelegate = newDataDelegate;
+    registerWithReactor();
 }
 
 void TCPConnection::setOnConnectionLost(std::function<void()> connectionLostDelegate) noexcept {
@@ -178,7 +194,7 @@ void TCPConnection::setOnConnectionLost(std::function<void()> connectionLostDele
 }
 
 bool TCPConnection::isRunning() const noexcept {
-    return (m_readFromSocketThreadRunning.load() && !TerminateHandler::instance().isTerminated.load());
+    return (m_isReadingFromSocket.load() && !TerminateHandler::instance().isTerminated.load());
 }
 
 std::pair<ssize_t, int32_t> TCPConnection::send(std::string &&data) const noexcept {
@@ -190,7 +206,7 @@ std::pair<ssize_t, int32_t> TCPConnection::send(std::string &&data) const noexce
         return {0, 0};
     }
 
-    if (!m_readFromSocketThreadRunning.load()) {
+    if (!m_isReadingFromSocket.load()) {
         std::lock_guard<std::mutex> lck(m_connectionLostDelegateMutex); // LCOV_EXCL_LINE
         if (nullptr != m_connectionLostDelegate) {                      // LCOV_EXCL_LINE
             m_connectionLostDelegate();                                 // LCOV_EXCL_LINE
@@ -209,74 +225,46 @@ std::pair<ssize_t, int32_t> TCPConnection::send(std::string &&data) const noexce
 }
 
 void TCPConnection::readFromSocket() noexcept {
-    // Create buffer to store data from socket.
-    constexpr uint16_t MAX_LENGTH{65535};
-    std::array<char, MAX_LENGTH> buffer{};
-
-    struct timeval timeout {};
-
-    // Define file descriptor set to watch for read operations.
-    fd_set setOfFiledescriptorsToReadFrom{};
-
-    // Indicate to main thread that we are ready.
-    m_readFromSocketThreadRunning.store(true);
+    ssize_t bytesRead = ::recv(m_socket, m_buffer.data(), m_buffer.size(), 0);
+    if (0 >= bytesRead) {
+        // 0 == bytesRead: peer shut down the connection; 0 > bytesRead: other error.
+        m_isReadingFromSocket.store(false);
+        m_reactor->remove(m_socket);
+
+        {
+            std::lock_guard<std::mutex> lck(m_connectionLostDelegateMutex);
+            if (nullptr != m_connectionLostDelegate) {
+                m_connectionLostDelegate();
+            }
+        }
+        return;
+    }
 
-    // This flag is used to not read data from the socket until this TCPConnection has a proper onNewDataHandler set.
     bool hasNewDataDelegate{false};
+    {
+        std::lock_guard<std::mutex> lck(m_newDataDelegateMutex);
+        hasNewDataDelegate = (nullptr != m_newDataDelegate);
+    }
 
-    while (m_readFromSocketThreadRunning.load()) {
-        // Define timeout for select system call. The timeval struct must be
-        // reinitialized for every select call as it might be modified containing
-        // the actual time slept.
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = 20 * 1000; // Check for new data with 50Hz.
-
-        FD_ZERO(&setOfFiledescriptorsToReadFrom);
-        FD_SET(m_socket, &setOfFiledescriptorsToReadFrom);
-        ::select(m_socket + 1, &setOfFiledescriptorsToReadFrom, nullptr, nullptr, &timeout);
-
-        // Only read data when the newDataDelegate is set.
-        if (!hasNewDataDelegate) {
-            std::lock_guard<std::mutex> lck(m_newDataDelegateMutex);
-            hasNewDataDelegate = (nullptr != m_newDataDelegate);
-        }
-        if (FD_ISSET(m_socket, &setOfFiledescriptorsToReadFrom) && hasNewDataDelegate) {
-            ssize_t bytesRead = ::recv(m_socket, buffer.data(), buffer.max_size(), 0);
-            if (0 >= bytesRead) {
-                // 0 == bytesRead: peer shut down the connection; 0 > bytesRead: other error.
-                m_readFromSocketThreadRunning.store(false);
-
-                {
-                    std::lock_guard<std::mutex> lck(m_connectionLostDelegateMutex);
-                    if (nullptr != m_connectionLostDelegate) {
-                        m_connectionLostDelegate();
-                    }
-                }
-                break;
+    // The lock must not be held while add() waits for a free slot as the
+    // consumer's delegate might call setOnNewData.
+    if (hasNewDataDelegate) {
+        // SIOCGSTAMP is not available for a stream-based socket,
+        // thus, falling back to regular chrono timestamping.
+        std::chrono::system_clock::time_point timestamp = std::chrono::system_clock::now();
+        {
+            PipelineEntry pe;
+            pe.m_data       = std::string(m_buffer.data(), static_cast<size_t>(bytesRead));
+            pe.m_sampleTime = timestamp;
+
+            // Store entry in queue.
+            if (m_pipeline) {
+                m_pipeline->add(std::move(pe));
             }
+        }
 
-            {
-                std::lock_guard<std::mutex> lck(m_newDataDelegateMutex);
-                if ((0 < bytesRead) && (nullptr != m_newDataDelegate)) {
-                    // SIOCGSTAMP is not available for a stream-based socket,
-                    // thus, falling back to regular chrono timestamping.
-                    std::chrono::system_clock::time_point timestamp = std::chrono::system_clock::now();
-                    {
-                        PipelineEntry pe;
-                        pe.m_data       = std::string(buffer.data(), static_cast<size_t>(bytesRead));
-                        pe.m_sampleTime = timestamp;
-
-                        // Store entry in queue.
-                        if (m_pipeline) {
-                            m_pipeline->add(std::move(pe));
-                        }
-                    }
-
-                    if (m_pipeline) {
-                        m_pipeline->notifyAll();
-                    }
-                }
-            }
+        if (m_pipeline) {
+            m_pipeline->notifyAll();
         }
     }
 }
@@ -26,7 +26,7 @@ std::string ToJSONVisitor::json() const noexcept {
     return retVal;
 }
 
-void ToJSONVisitor::preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+void ToJSONVisitor::preVisit(int32_t id, const char *shortName, const char *longName) noexcept {
     (void)id;
     (void)longName;
     (void)shortName;
@@ -34,91 +34,91 @@ void ToJSONVisitor::preVisit(int32_t id, const std::string &shortName, const std
 
 void ToJSONVisitor::postVisit() noexcept {}
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << v << ',' << '\n';
     }
 }
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << '\"' << v << '\"' << ',' << '\n';
     }
 }
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << +v << ',' << '\n';
     }
 }
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << +v << ',' << '\n';
     }
 }
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << +v << ',' << '\n';
     }
 }
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << +v << ',' << '\n';
     }
 }
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << v << ',' << '\n';
     }
 }
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << v << ',' << '\n';
     }
 }
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << v << ',' << '\n';
     }
 }
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << v << ',' << '\n';
     }
 }
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << std::setprecision(7) << v << std::setprecision(6) << ',' << '\n';
     }
 }
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << std::setprecision(11) << v << std::setprecision(6) << ',' << '\n';
     }
 }
 
-void ToJSONVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void ToJSONVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)typeName;
     if ((0 == m_mask.count(id)) || m_mask[id]) {
         m_buffer << '\"' << name << '\"' << ':' << '\"' << ToJSONVisitor::encodeBase64(v) << '\"' << ',' << '\n';
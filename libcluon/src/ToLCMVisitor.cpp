@@ -31,7 +31,7 @@ std::string ToLCMVisitor::encodedData(bool withHash) const noexcept {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-void ToLCMVisitor::preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+void ToLCMVisitor::preVisit(int32_t id, const char *shortName, const char *longName) noexcept {
     (void)id;
     (void)shortName;
     (void)longName;
@@ -39,132 +39,132 @@ void ToLCMVisitor::preVisit(int32_t id, const std::string &shortName, const std:
 
 void ToLCMVisitor::postVisit() noexcept {}
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("boolean");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     m_buffer.write(reinterpret_cast<char *>(&v), sizeof(bool));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int8_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     m_buffer.write(reinterpret_cast<char *>(&v), sizeof(char));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int8_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     m_buffer.write(reinterpret_cast<char *>(&v), sizeof(int8_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int8_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     m_buffer.write(reinterpret_cast<char *>(&v), sizeof(uint8_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int16_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int16_t _v = static_cast<int16_t>(htobe16(v));
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int16_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int16_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int16_t _v = static_cast<int16_t>(htobe16(v));
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int16_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int32_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int32_t _v = static_cast<int32_t>(htobe32(v));
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int32_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int32_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int32_t _v = static_cast<int32_t>(htobe32(v));
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int32_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int64_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int64_t _v = static_cast<int64_t>(htobe64(v));
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int64_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("int64_t");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int64_t _v = static_cast<int64_t>(htobe64(v));
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int64_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("float");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int32_t _v{0};
     std::memmove(&_v, &v, sizeof(int32_t));
     _v = static_cast<int32_t>(htobe32(_v));
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int32_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("double");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
     int64_t _v{0};
     std::memmove(&_v, &v, sizeof(int64_t));
     _v = static_cast<int64_t>(htobe64(_v));
     m_buffer.write(reinterpret_cast<char *>(&_v), sizeof(int64_t));
 }
 
-void ToLCMVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void ToLCMVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)id;
     (void)typeName;
     calculateHash(name);
     calculateHash("string");
-    calculateHash(0);
+    calculateHash(static_cast<char>(0));
 
     const std::size_t LENGTH = v.length();
     int32_t _v               = static_cast<int32_t>(htobe32(static_cast<uint32_t>(LENGTH + 1)));
@@ -189,11 +189,11 @@ void ToLCMVisitor::calculateHash(char c) noexcept {
     m_hash = ((m_hash << 8) ^ (m_hash >> 55)) + c;
 }
 
-void ToLCMVisitor::calculateHash(const std::string &s) noexcept {
-    const std::string tmp{(s.length() > 255 ? s.substr(0, 255) : s)};
-    const uint8_t length{static_cast<uint8_t>(tmp.length())};
+void ToLCMVisitor::calculateHash(const char *s) noexcept {
+    const std::size_t LENGTH{std::strlen(s)};
+    const uint8_t length{static_cast<uint8_t>((LENGTH > 255) ? 255 : LENGTH)};
     calculateHash(static_cast<char>(length));
-    for (auto c : s) { calculateHash(c); }
+    for (std::size_t i{0}; i < LENGTH; i++) { calculateHash(s[i]); }
 }
 
 } // namespace cluon
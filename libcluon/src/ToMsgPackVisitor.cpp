@@ -40,7 +40,15 @@ std::string ToMsgPackVisitor::encodedData() const noexcept {
 }
 
 void ToMsgPackVisitor::encode(std::ostream &o, const std::string &s) {
-    const uint32_t LENGTH{static_cast<uint32_t>(s.size())};
+    encode(o, s.c_str(), s.size());
+}
+
+void ToMsgPackVisitor::encode(std::ostream &o, const char *s) {
+    encode(o, s, std::strlen(s));
+}
+
+void ToMsgPackVisitor::encode(std::ostream &o, const char *s, std::size_t length) {
+    const uint32_t LENGTH{static_cast<uint32_t>(length)};
     if (LENGTH < 32) {
         const uint8_t v = static_cast<uint8_t>(MsgPackConstants::FIXSTR) | static_cast<uint8_t>(LENGTH);
         o.write(reinterpret_cast<const char *>(&v), sizeof(uint8_t));
@@ -60,7 +68,7 @@ void ToMsgPackVisitor::encode(std::ostream &o, const std::string &s) {
         uint32_t len = htobe32(LENGTH);
         o.write(reinterpret_cast<const char *>(&len), sizeof(uint32_t));
     }
-    o.write(s.c_str(), static_cast<std::streamsize>(LENGTH)); // LENGTH won't be negative.
+    o.write(s, static_cast<std::streamsize>(LENGTH)); // LENGTH won't be negative.
 }
 
 void ToMsgPackVisitor::encodeUint(std::ostream &o, uint64_t v) {
@@ -123,7 +131,7 @@ void ToMsgPackVisitor::encodeInt(std::ostream &o, int64_t v) {
     }
 }
 
-void ToMsgPackVisitor::preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+void ToMsgPackVisitor::preVisit(int32_t id, const char *shortName, const char *longName) noexcept {
     (void)id;
     (void)shortName;
     (void)longName;
@@ -134,7 +142,7 @@ void ToMsgPackVisitor::preVisit(int32_t id, const std::string &shortName, const
 
 void ToMsgPackVisitor::postVisit() noexcept {}
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -144,7 +152,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -154,7 +162,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -163,7 +171,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -172,7 +180,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -181,7 +189,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -190,7 +198,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -199,7 +207,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -208,7 +216,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -217,7 +225,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -226,7 +234,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -240,7 +248,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -254,7 +262,7 @@ void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&
     m_numberOfFields++;
 }
 
-void ToMsgPackVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void ToMsgPackVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)id;
     (void)typeName;
 
@@ -9,15 +9,34 @@
 #include "cluon/ToProtoVisitor.hpp"
 
 #include <cstring>
+#include <array>
+#include <utility>
 
 namespace cluon {
 
+ToProtoVisitor::ToProtoVisitor(std::string &&buffer) noexcept
+    : m_buffer(std::move(buffer)) {}
+
 std::string ToProtoVisitor::encodedData() const noexcept {
-    std::string s{m_buffer.str()};
+    std::string s{m_buffer};
+    return s;
+}
+
+const std::string &ToProtoVisitor::encodedBuffer() const noexcept {
+    return m_buffer;
+}
+
+std::string ToProtoVisitor::releaseEncodedData() noexcept {
+    std::string s{std::move(m_buffer)};
+    m_buffer.clear();
     return s;
 }
 
-void ToProtoVisitor::preVisit(int32_t id, const std::string &shortName, const std::string &longName) noexcept {
+void ToProtoVisitor::reset() noexcept {
+    m_buffer.clear();
+}
+
+void ToProtoVisitor::preVisit(int32_t id, const char *shortName, const char *longName) noexcept {
     (void)id;
     (void)shortName;
     (void)longName;
@@ -25,68 +44,68 @@ void ToProtoVisitor::preVisit(int32_t id, const std::string &shortName, const st
 
 void ToProtoVisitor::postVisit() noexcept {}
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, bool &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, bool &v) noexcept {
     (void)typeName;
     (void)name;
     toKeyValue<bool>(id, v);
 }
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, char &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, char &v) noexcept {
     (void)typeName;
     (void)name;
     uint8_t _v = static_cast<uint8_t>(v); // NOLINT
     toKeyValue<uint8_t>(id, _v);
 }
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int8_t &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, int8_t &v) noexcept {
     (void)typeName;
     (void)name;
     toKeyValue<int8_t>(id, v);
 }
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint8_t &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, uint8_t &v) noexcept {
     (void)typeName;
     (void)name;
     toKeyValue<uint8_t>(id, v);
 }
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int16_t &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, int16_t &v) noexcept {
     (void)typeName;
     (void)name;
     toKeyValue<int16_t>(id, v);
 }
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint16_t &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, uint16_t &v) noexcept {
     (void)typeName;
     (void)name;
     toKeyValue<uint16_t>(id, v);
 }
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int32_t &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, int32_t &v) noexcept {
     (void)typeName;
     (void)name;
     toKeyValue<int32_t>(id, v);
 }
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint32_t &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, uint32_t &v) noexcept {
     (void)typeName;
     (void)name;
     toKeyValue<uint32_t>(id, v);
 }
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, int64_t &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, int64_t &v) noexcept {
     (void)typeName;
     (void)name;
     toKeyValue<int64_t>(id, v);
 }
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, uint64_t &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, uint64_t &v) noexcept {
     (void)typeName;
     (void)name;
     toKeyValue<uint64_t>(id, v);
 }
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, float &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, float &v) noexcept {
     (void)typeName;
     (void)name;
     uint64_t key = encodeKey(id, static_cast<uint8_t>(ProtoConstants::FOUR_BYTES));
@@ -94,7 +113,7 @@ void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     encode(m_buffer, v);
 }
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, double &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, double &v) noexcept {
     (void)typeName;
     (void)name;
     uint64_t key = encodeKey(id, static_cast<uint8_t>(ProtoConstants::EIGHT_BYTES));
@@ -102,7 +121,7 @@ void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
     encode(m_buffer, v);
 }
 
-void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&name, std::string &v) noexcept {
+void ToProtoVisitor::visit(uint32_t id, const char *typeName, const char *name, std::string &v) noexcept {
     (void)typeName;
     (void)name;
     uint64_t key = encodeKey(id, static_cast<uint8_t>(ProtoConstants::LENGTH_DELIMITED));
@@ -112,72 +131,78 @@ void ToProtoVisitor::visit(uint32_t id, std::string &&typeName, std::string &&na
 
 ////////////////////////////////////////////////////////////////////////////////
 
-std::size_t ToProtoVisitor::encode(std::ostream &o, bool &v) noexcept {
+std::size_t ToProtoVisitor::encode(std::string &o, bool &v) noexcept {
     uint64_t _v{(v ? 1u : 0u)};
     return toVarInt(o, _v);
 }
 
-std::size_t ToProtoVisitor::encode(std::ostream &o, int8_t &v) noexcept {
+std::size_t ToProtoVisitor::encode(std::string &o, int8_t &v) noexcept {
     uint64_t _v = toZigZag8(v);
     return toVarInt(o, _v);
 }
 
-std::size_t ToProtoVisitor::encode(std::ostream &o, uint8_t &v) noexcept {
+std::size_t ToProtoVisitor::encode(std::string &o, uint8_t &v) noexcept {
     uint64_t _v = v;
     return toVarInt(o, _v);
 }
 
-std::size_t ToProtoVisitor::encode(std::ostream &o, int16_t &v) noexcept {
+std::size_t ToProtoVisitor::encode(std::string &o, int16_t &v) noexcept {
     uint64_t _v = toZigZag16(v);
     return toVarInt(o, _v);
 }
 
-std::size_t ToProtoVisitor::encode(std::ostream &o, uint16_t &v) noexcept {
+std::size_t ToProtoVisitor::encode(std::string &o, uint16_t &v) noexcept {
     uint64_t _v = v;
     return toVarInt(o, _v);
 }
 
-std::size_t ToProtoVisitor::encode(std::ostream &o, int32_t &v) noexcept {
+std::size_t ToProtoVisitor::encode(std::string &o, int32_t &v) noexcept {
     uint64_t _v = toZigZag32(v);
     return toVarInt(o, _v);
 }
 
-std::size_t ToProtoVisitor::encode(std::ostream &o, uint32_t &v) noexcept {
+std::size_t ToProtoVisitor::encode(std::string &o, uint32_t &v) noexcept {
     uint64_t _v = v;
     return toVarInt(o, _v);
 }
 
-std::size_t ToProtoVisitor::encode(std::ostream &o, int64_t &v) noexcept {
+std::size_t ToProtoVisitor::encode(std::string &o, int64_t &v) noexcept {
     uint64_t _v = toZigZag64(v);
     return toVarInt(o, _v);
 }
 
-std::size_t ToProtoVisitor::encode(std::ostream &o, uint64_t &v) noexcept {
+std::size_t ToProtoVisitor::encode(std::string &o, uint64_t &v) noexcept {
     return toVarInt(o, v);
 }
 
-std::size_t ToProtoVisitor::encode(std::ostream &o, float &v) noexcept {
+std::size_t ToProtoVisitor::encode(std::string &o, float &v) noexcept {
     // Store 4 bytes as little endian encoding.
     uint32_t _v{0};
     std::memmove(&_v, &v, sizeof(float));
     _v = htole32(_v);
-    o.write(reinterpret_cast<const char *>(&_v), sizeof(uint32_t)); // NOLINT
+    try {
+        o.append(reinterpret_cast<const char *>(&_v), sizeof(uint32_t)); // NOLINT
+    } catch (...) { return 0; } // LCOV_EXCL_LINE
     return sizeof(uint32_t);
 }
 
-std::size_t ToProtoVisitor::encode(std::ostream &o, double &v) noexcept {
+std::size_t ToProtoVisitor::encode(std::string &o, double &v) noexcept {
     // Store 8 bytes as little endian encoding.
     uint64_t _v{0};
     std::memmove(&_v, &v, sizeof(double));
     _v = htole64(_v);
-    o.write(reinterpret_cast<const char *>(&_v), sizeof(uint64_t)); // NOLINT
+    try {
+        o.append(reinterpret_cast<const char *>(&_v), sizeof(uint64_t)); // NOLINT
+    } catch (...) { return 0; } // LCOV_EXCL_LINE
     return sizeof(uint64_t);
 }
 
-std::size_t ToProtoVisitor::encode(std::ostream &o, const std::string &v) noexcept {
+std::size_t ToProtoVisitor::encode(std::string &o, const std::string &v) noexcept {
     const std::size_t LENGTH = v.length();
     std::size_t size         = toVarInt(o, LENGTH);
-    o.write(v.c_str(), static_cast<std::streamsize>(LENGTH)); // LENGTH won't be negative.
+    try {
+        o.append(v);
+    } catch (...) { return size; } // LCOV_EXCL_LINE
     return size + LENGTH;
 }
 
@@ -201,21 +226,21 @@ uint64_t ToProtoVisitor::encodeKey(uint32_t fieldIdentifier, uint8_t protoType)
     return (fieldIdentifier << 0x3) | protoType;
 }
 
-std::size_t ToProtoVisitor::toVarInt(std::ostream &out, uint64_t v) noexcept {
-    // Minimum size is of the encoded data.
-    std::size_t size{1};
-    uint8_t b{0};
+std::size_t ToProtoVisitor::toVarInt(std::string &out, uint64_t v) noexcept {
+    // Assemble the (at most 10) bytes locally and append them at once.
+    std::array<char, 10> bytes;
+    std::size_t size{0};
     while (0x7f < v) {
         // Use the MSB to indicate value overflow for more bytes to come.
-        b = (static_cast<uint8_t>(v & 0x7f)) | 0x80;
-        out.put(static_cast<char>(b));
+        bytes[size++] = static_cast<char>((static_cast<uint8_t>(v & 0x7f)) | 0x80);
         v >>= 7;
-        size++;
     }
     // Write final byte.
-    b = (static_cast<uint8_t>(v)) & 0x7f;
-    out.put(static_cast<char>(b));
+    bytes[size++] = static_cast<char>((static_cast<uint8_t>(v)) & 0x7f);
 
+    try {
+        out.append(bytes.data(), size);
+    } catch (...) { return 0; } // LCOV_EXCL_LINE
     return size;
 }
 } // namespace cluon
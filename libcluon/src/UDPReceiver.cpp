@@ -24,6 +24,7 @@
 #else
     #ifdef __linux__
         #include <linux/sockios.h>
+        #include <netinet/udp.h>
     #endif
 
     #include <arpa/inet.h>
@@ -54,12 +55,54 @@ namespace cluon {
 UDPReceiver::UDPReceiver(const std::string &receiveFromAddress,
                          uint16_t receiveFromPort,
                          std::function<void(std::string &&, std::string &&, std::chrono::system_clock::time_point &&)> delegate,
-                         uint16_t localSendFromPort) noexcept
+                         uint16_t localSendFromPort,
+                         uint16_t receiveBatchSize) noexcept
+    : UDPReceiver(nullptr, receiveFromAddress, receiveFromPort, std::move(delegate), nullptr, localSendFromPort, receiveBatchSize) {}
+
+UDPReceiver::UDPReceiver(const std::string &receiveFromAddress,
+                         uint16_t receiveFromPort,
+                         std::function<void(cluon::PooledBuffer &&, const struct sockaddr_in &, std::chrono::system_clock::time_point &&)> delegate,
+                         uint16_t localSendFromPort,
+                         uint16_t receiveBatchSize) noexcept
+    : UDPReceiver(nullptr, receiveFromAddress, receiveFromPort, nullptr, std::move(delegate), localSendFromPort, receiveBatchSize) {}
+
+UDPReceiver::UDPReceiver(const std::string &receiveFromAddress,
+                         uint16_t receiveFromPort,
+                         std::nullptr_t,
+                         uint16_t localSendFromPort,
+                         uint16_t receiveBatchSize) noexcept
+    : UDPReceiver(nullptr, receiveFromAddress, receiveFromPort, nullptr, nullptr, localSendFromPort, receiveBatchSize) {}
+
+UDPReceiver::UDPReceiver(std::shared_ptr<cluon::Reactor> reactor,
+                         const std::string &receiveFromAddress,
+                         uint16_t receiveFromPort,
+                         std::function<void(std::string &&, std::string &&, std::chrono::system_clock::time_point &&)> delegate,
+                         uint16_t localSendFromPort,
+                         uint16_t receiveBatchSize) noexcept
+    : UDPReceiver(std::move(reactor), receiveFromAddress, receiveFromPort, std::move(delegate), nullptr, localSendFromPort, receiveBatchSize) {}
+
+UDPReceiver::UDPReceiver(std::shared_ptr<cluon::Reactor> reactor,
+                         const std::string &receiveFromAddress,
+                         uint16_t receiveFromPort,
+                         std::function<void(cluon::PooledBuffer &&, const struct sockaddr_in &, std::chrono::system_clock::time_point &&)> delegate,
+                         uint16_t localSendFromPort,
+                         uint16_t receiveBatchSize) noexcept
+    : UDPReceiver(std::move(reactor), receiveFromAddress, receiveFromPort, nullptr, std::move(delegate), localSendFromPort, receiveBatchSize) {}
+
+UDPReceiver::UDPReceiver(std::shared_ptr<cluon::Reactor> reactor,
+                         const std::string &receiveFromAddress,
+                         uint16_t receiveFromPort,
+                         std::function<void(std::string &&, std::string &&, std::chrono::system_clock::time_point &&)> delegate,
+                         std::function<void(cluon::PooledBuffer &&, const struct sockaddr_in &, std::chrono::system_clock::time_point &&)> pooledBufferDelegate,
+                         uint16_t localSendFromPort,
+                         uint16_t receiveBatchSize) noexcept
     : m_localSendFromPort(localSendFromPort)
     , m_receiveFromAddress()
     , m_mreq()
-    , m_readFromSocketThread()
-    , m_delegate(std::move(delegate)) {
+    , m_receiveBatchSize((0 < receiveBatchSize) ? receiveBatchSize : 1)
+    , m_reactor(std::move(reactor))
+    , m_delegate(std::move(delegate))
+    , m_pooledBufferDelegate(std::move(pooledBufferDelegate)) {
     // Decompose given address string to check validity with numerical IPv4 address.
     std::string tmp{cluon::getIPv4FromHostname(receiveFromAddress)};
     std::replace(tmp.begin(), tmp.end(), '.', ' ');
@@ -217,6 +260,18 @@ UDPReceiver::UDPReceiver(const std::string &receiveFromAddress,
             }
         }
 
+#ifdef __linux__
+        if (!(m_socket < 0) && (1 < m_receiveBatchSize)) {
+            // Let the kernel deliver the receive time stamp as control message
+            // alongside each datagram to avoid one ioctl per datagram.
+            uint32_t YES = 1;
+            auto retVal  = ::setsockopt(m_socket, SOL_SOCKET, SO_TIMESTAMPNS, reinterpret_cast<char *>(&YES), sizeof(YES)); // NOLINT
+            if (0 > retVal) {
+                std::cerr << "[cluon::UDPReceiver] Error while trying to set SO_TIMESTAMPNS: " << errno << std::endl; // LCOV_EXCL_LINE
+            }
+        }
+#endif
+
         if (!(m_socket < 0)) {
             // Bind to receive address/port.
             // clang-format off
@@ -291,18 +346,39 @@ UDPReceiver::UDPReceiver(const std::string &receiveFromAddress,
         }
 
         if (!(m_socket < 0)) {
-            // Constructing the receiving thread could fail.
+            // Pre-allocate the slabs that the datagrams are received into.
+            constexpr uint16_t MAX_LENGTH = static_cast<uint16_t>(UDPPacketSizeConstraints::MAX_SIZE_UDP_PACKET)
+                                            - static_cast<uint16_t>(UDPPacketSizeConstraints::SIZE_IPv4_HEADER)
+                                            - static_cast<uint16_t>(UDPPacketSizeConstraints::SIZE_UDP_HEADER);
+            // A full pipeline, the slabs of one batch that are waiting for the kernel, the
+            // datagrams split from one coalesced batch, and the entry that is being
+            // delegated must not fall back to the heap; slabs are only backed by physical
+            // memory once they are used.
+            const uint32_t NUMBER_OF_SLABS{static_cast<uint32_t>(PIPELINE_CAPACITY) + 2 * static_cast<uint32_t>(m_receiveBatchSize) + 1};
             try {
-                m_readFromSocketThread = std::thread(&UDPReceiver::readFromSocket, this);
-
-                // Let the operating system spawn the thread.
-                using namespace std::literals::chrono_literals; // NOLINT
-                do { std::this_thread::sleep_for(1ms); } while (!m_readFromSocketThreadRunning.load());
-            } catch (...) { closeSocket(ECHILD); } // LCOV_EXCL_LINE
+                m_bufferPool = std::make_shared<cluon::BufferPool>(NUMBER_OF_SLABS, MAX_LENGTH);
+            } catch (...) { closeSocket(ENOMEM); } // LCOV_EXCL_LINE
+        }
 
+        if (!(m_socket < 0)) {
+            // The pipeline must exist before the first datagram can arrive.
             try {
-                m_pipeline = std::make_shared<cluon::NotifyingPipeline<PipelineEntry>>(
-                    [this](PipelineEntry &&entry) { this->m_delegate(std::move(entry.m_data), std::move(entry.m_from), std::move(entry.m_sampleTime)); });
+                m_pipeline = std::make_shared<cluon::NotifyingPipeline<PipelineEntry>>([this](PipelineEntry &&entry) {
+                    if (nullptr != this->m_pooledBufferDelegate) {
+                        this->m_pooledBufferDelegate(std::move(entry.m_data), entry.m_from, std::move(entry.m_sampleTime));
+                    } else {
+                        // Transform sender address to C-string.
+                        std::array<char, INET_ADDRSTRLEN> remoteAddress{};
+                        ::inet_ntop(AF_INET, &(entry.m_from.sin_addr), remoteAddress.data(), remoteAddress.max_size());
+                        std::string from{std::string(remoteAddress.data()) + ':' + std::to_string(ntohs(entry.m_from.sin_port))};
+
+                        this->m_delegate(std::string(entry.m_data.data(), entry.m_data.size()), std::move(from), std::move(entry.m_sampleTime));
+                    }
+                },
+                // The socket is only read from the Reactor's thread.
+                cluon::NotifyingPipelineBackend::SPSC_RING,
+                PIPELINE_CAPACITY,
+                cluon::NotifyingPipelineOverflowPolicy::DROP_OLDEST);
                 if (m_pipeline) {
                     // Let the operating system spawn the thread.
                     using namespace std::literals::chrono_literals; // NOLINT
@@ -310,19 +386,33 @@ UDPReceiver::UDPReceiver(const std::string &receiveFromAddress,
                 }
             } catch (...) { closeSocket(ECHILD); } // LCOV_EXCL_LINE
         }
+
+        if (!(m_socket < 0)) {
+            // Creating the Reactor could fail.
+            try {
+                if (!m_reactor) {
+                    m_reactor = std::make_shared<cluon::Reactor>();
+                }
+                m_isReadingFromSocket.store(m_reactor->add(m_socket, [this]() { this->readFromSocket(); }));
+            } catch (...) {} // LCOV_EXCL_LINE
+            if (!m_isReadingFromSocket.load()) {
+                closeSocket(ECHILD); // LCOV_EXCL_LINE
+            }
+        }
     }
 }
 
 UDPReceiver::~UDPReceiver() noexcept {
-    {
-        m_readFromSocketThreadRunning.store(false);
+    // Wake readFromSocket if it is blocked on a full pipeline so that the Reactor can remove the socket.
+    if (m_pipeline) {
+        m_pipeline->stop();
+    }
 
-        // Joining the thread could fail.
-        try {
-            if (m_readFromSocketThread.joinable()) {
-                m_readFromSocketThread.join();
-            }
-        } catch (...) {} // LCOV_EXCL_LINE
+    if (m_reactor) {
+        // Afterwards, readFromSocket is not called anymore.
+        m_reactor->remove(m_socket);
+        m_isReadingFromSocket.store(false);
+        m_reactor.reset();
     }
 
     m_pipeline.reset();
@@ -363,107 +453,249 @@ void UDPReceiver::closeSocket(int errorCode) noexcept {
 }
 
 bool UDPReceiver::isRunning() const noexcept {
-    return (m_readFromSocketThreadRunning.load() && !TerminateHandler::instance().isTerminated.load());
+    return (m_isReadingFromSocket.load() && !TerminateHandler::instance().isTerminated.load());
 }
 
-void UDPReceiver::readFromSocket() noexcept {
-    // Create buffer to store data from socket.
-    constexpr uint16_t MAX_LENGTH = static_cast<uint16_t>(UDPPacketSizeConstraints::MAX_SIZE_UDP_PACKET)
-                                    - static_cast<uint16_t>(UDPPacketSizeConstraints::SIZE_IPv4_HEADER)
-                                    - static_cast<uint16_t>(UDPPacketSizeConstraints::SIZE_UDP_HEADER);
-    std::array<char, MAX_LENGTH> buffer{};
+void UDPReceiver::setOverflowPolicy(cluon::NotifyingPipelineOverflowPolicy overflowPolicy) noexcept {
+    if (m_pipeline) {
+        m_pipeline->setOverflowPolicy(overflowPolicy);
+    }
+}
 
-    struct timeval timeout {};
+cluon::NotifyingPipelineStatistics UDPReceiver::pipelineStatistics() const noexcept {
+    return (m_pipeline ? m_pipeline->statistics() : cluon::NotifyingPipelineStatistics{});
+}
 
-    // Define file descriptor set to watch for read operations.
-    fd_set setOfFiledescriptorsToReadFrom{};
+uint64_t UDPReceiver::numberOfOverflowAllocations() const noexcept {
+    return (m_bufferPool ? m_bufferPool->numberOfOverflowAllocations() : 0);
+}
 
-    // Sender address and port.
-    constexpr uint16_t MAX_ADDR_SIZE{1024};
-    std::array<char, MAX_ADDR_SIZE> remoteAddress{};
+#ifdef __linux__
+bool UDPReceiver::attachSocketFilter(const std::vector<struct sock_filter> &program) noexcept {
+    bool retVal{false};
+    if (!(m_socket < 0) && !program.empty() && (program.size() <= BPF_MAXINSNS)) {
+        struct sock_fprog fprog {};
+        fprog.len    = static_cast<unsigned short>(program.size());
+        fprog.filter = const_cast<struct sock_filter *>(program.data()); // NOLINT
+        retVal       = (0 == ::setsockopt(m_socket, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog)));
+    }
+    return retVal;
+}
+
+bool UDPReceiver::detachSocketFilter() noexcept {
+    int32_t unused{0};
+    return (!(m_socket < 0) && (0 == ::setsockopt(m_socket, SOL_SOCKET, SO_DETACH_FILTER, &unused, sizeof(unused))));
+}
+#endif
 
+bool UDPReceiver::enableReceiveOffload(bool enable) noexcept {
+    bool retVal{!enable};
+#ifdef __linux__
+    if (!(m_socket < 0)) {
+        // Kernels without receive offload reject this option.
+        int32_t value{enable ? 1 : 0};
+        retVal = (0 == ::setsockopt(m_socket, SOL_UDP, UDP_GRO, &value, sizeof(value)));
+        if (retVal && enable) {
+            // Coalesced datagrams are read with recvmmsg that delivers the time stamps as control message.
+            uint32_t YES = 1;
+            if (0 > ::setsockopt(m_socket, SOL_SOCKET, SO_TIMESTAMPNS, reinterpret_cast<char *>(&YES), sizeof(YES))) { // NOLINT
+                std::cerr << "[cluon::UDPReceiver] Error while trying to set SO_TIMESTAMPNS: " << errno << std::endl; // LCOV_EXCL_LINE
+            }
+        }
+    }
+#endif
+    m_isReceiveOffloadEnabled.store(enable && retVal);
+    return retVal;
+}
+
+void UDPReceiver::readFromSocket() noexcept {
+    const bool HAS_DELEGATE{(nullptr != m_delegate) || (nullptr != m_pooledBufferDelegate)};
+
+    // Sender address and port.
     struct sockaddr_storage remote {};
     socklen_t addrLength{sizeof(remote)};
 
-    // Indicate to main thread that we are ready.
-    m_readFromSocketThreadRunning.store(true);
-
-    while (m_readFromSocketThreadRunning.load()) {
-        // Define timeout for select system call. The timeval struct must be
-        // reinitialized for every select call as it might be modified containing
-        // the actual time slept.
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = 20 * 1000; // Check for new data with 50Hz.
-
-        FD_ZERO(&setOfFiledescriptorsToReadFrom);          // NOLINT
-        FD_SET(m_socket, &setOfFiledescriptorsToReadFrom); // NOLINT
-        ::select(m_socket + 1, &setOfFiledescriptorsToReadFrom, nullptr, nullptr, &timeout);
-
-        ssize_t totalBytesRead{0};
-        if (FD_ISSET(m_socket, &setOfFiledescriptorsToReadFrom)) { // NOLINT
-            ssize_t bytesRead{0};
-            do {
-                bytesRead = ::recvfrom(m_socket,
-                                       buffer.data(),
-                                       buffer.max_size(),
-                                       0,
-                                       reinterpret_cast<struct sockaddr *>(&remote), // NOLINT
-                                       reinterpret_cast<socklen_t *>(&addrLength));  // NOLINT
-
-                if ((0 < bytesRead) && (nullptr != m_delegate)) {
+    ssize_t totalBytesRead{0};
 #ifdef __linux__
-                    std::chrono::system_clock::time_point timestamp;
-                    struct timeval receivedTimeStamp {};
-                    if (0 == ::ioctl(m_socket, SIOCGSTAMP, &receivedTimeStamp)) { // NOLINT
-                        // Transform struct timeval to C++ chrono.
-                        std::chrono::time_point<std::chrono::system_clock, std::chrono::microseconds> transformedTimePoint(
-                            std::chrono::microseconds(receivedTimeStamp.tv_sec * 1000000L + receivedTimeStamp.tv_usec));
-                        timestamp = std::chrono::time_point_cast<std::chrono::system_clock::duration>(transformedTimePoint);
-                    } else { // LCOV_EXCL_LINE
-                        // In case the ioctl failed, fall back to chrono. // LCOV_EXCL_LINE
-                        timestamp = std::chrono::system_clock::now(); // LCOV_EXCL_LINE
-                    }
+    if ((1 < m_receiveBatchSize) || m_isReceiveOffloadEnabled.load()) {
+        totalBytesRead = readBatchFromSocket();
+    } else
+#endif
+    {
+        ssize_t bytesRead{0};
+        uint32_t numberOfDatagrams{0};
+        do {
+            // Receive directly into a pooled slab.
+            cluon::PooledBuffer slab{m_bufferPool->acquire()};
+            bytesRead = ::recvfrom(m_socket,
+                                   slab.data(),
+                                   slab.capacity(),
+                                   0,
+                                   reinterpret_cast<struct sockaddr *>(&remote), // NOLINT
+                                   reinterpret_cast<socklen_t *>(&addrLength));  // NOLINT
+
+            if ((0 < bytesRead) && HAS_DELEGATE) {
+#ifdef __linux__
+                std::chrono::system_clock::time_point timestamp;
+                struct timeval receivedTimeStamp {};
+                if (0 == ::ioctl(m_socket, SIOCGSTAMP, &receivedTimeStamp)) { // NOLINT
+                    // Transform struct timeval to C++ chrono.
+                    std::chrono::time_point<std::chrono::system_clock, std::chrono::microseconds> transformedTimePoint(
+                        std::chrono::microseconds(receivedTimeStamp.tv_sec * 1000000L + receivedTimeStamp.tv_usec));
+                    timestamp = std::chrono::time_point_cast<std::chrono::system_clock::duration>(transformedTimePoint);
+                } else { // LCOV_EXCL_LINE
+                    // In case the ioctl failed, fall back to chrono. // LCOV_EXCL_LINE
+                    timestamp = std::chrono::system_clock::now(); // LCOV_EXCL_LINE
+                }
 #else
-                    std::chrono::system_clock::time_point timestamp = std::chrono::system_clock::now();
+                std::chrono::system_clock::time_point timestamp = std::chrono::system_clock::now();
 #endif
+                slab.resize(static_cast<std::size_t>(bytesRead));
+                addToPipeline(std::move(slab), remote, timestamp);
+                totalBytesRead += bytesRead;
+            }
+            // The Reactor is level-triggered and calls again for the remaining datagrams.
+        } while (!m_isBlockingSocket && (bytesRead > 0) && (++numberOfDatagrams < static_cast<uint32_t>(MAX_NUMBER_OF_DATAGRAMS_PER_WAKEUP)));
+    }
 
-                    // Transform sender address to C-string.
-                    ::inet_ntop(remote.ss_family,
-                                &((reinterpret_cast<struct sockaddr_in *>(&remote))->sin_addr), // NOLINT
-                                remoteAddress.data(),
-                                remoteAddress.max_size());
-                    const unsigned long RECVFROM_IP{reinterpret_cast<struct sockaddr_in *>(&remote)->sin_addr.s_addr}; // NOLINT
-                    const uint16_t RECVFROM_PORT{ntohs(reinterpret_cast<struct sockaddr_in *>(&remote)->sin_port)};    // NOLINT
-
-                    // Check if the bytes actually came from us.
-                    bool sentFromUs{false};
-                    {
-                        auto pos                   = m_listOfLocalIPAddresses.find(RECVFROM_IP);
-                        const bool sentFromLocalIP = (pos != m_listOfLocalIPAddresses.end() && (*pos == RECVFROM_IP));
-                        sentFromUs                 = sentFromLocalIP && (m_localSendFromPort == RECVFROM_PORT);
-                    }
+    if (static_cast<int32_t>(totalBytesRead) > 0) {
+        if (m_pipeline) {
+            m_pipeline->notifyAll();
+        }
+    }
+}
+#ifdef __linux__
+ssize_t UDPReceiver::readBatchFromSocket() noexcept {
+    constexpr std::size_t CONTROL_LENGTH{CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(sizeof(int32_t))};
+    const bool HAS_DELEGATE{(nullptr != m_delegate) || (nullptr != m_pooledBufferDelegate)};
+
+    // The data structures are owned by this UDPReceiver as a shared Reactor
+    // calls several UDPReceivers from the same thread.
+    std::vector<cluon::PooledBuffer> &slabs{m_batchSlabs};
+    std::vector<char> &controls{m_batchControls};
+    std::vector<struct sockaddr_storage> &remotes{m_batchRemotes};
+    std::vector<struct iovec> &iovecs{m_batchIovecs};
+    std::vector<struct mmsghdr> &messages{m_batchMessages};
+    if (messages.size() != m_receiveBatchSize) {
+        try {
+            slabs.resize(m_receiveBatchSize);
+            controls.resize(static_cast<std::size_t>(m_receiveBatchSize) * CONTROL_LENGTH);
+            remotes.resize(m_receiveBatchSize);
+            iovecs.resize(m_receiveBatchSize);
+            messages.resize(m_receiveBatchSize);
+        } catch (...) { return 0; } // LCOV_EXCL_LINE
+    }
 
-                    // Create a pipeline entry to be processed concurrently.
-                    if (!sentFromUs) {
-                        PipelineEntry pe;
-                        pe.m_data       = std::string(buffer.data(), static_cast<size_t>(bytesRead));
-                        pe.m_from       = std::string(remoteAddress.data()) + ':' + std::to_string(RECVFROM_PORT);
-                        pe.m_sampleTime = timestamp;
+    ssize_t totalBytesRead{0};
+    // The kernel modifies the lengths; thus, they need to be reset for every call.
+    for (std::size_t i{0}; i < m_receiveBatchSize; i++) {
+        // Replace the slabs that were handed over to the pipeline.
+        if (nullptr == slabs[i].data()) {
+            slabs[i] = m_bufferPool->acquire();
+        }
+        iovecs[i].iov_base = slabs[i].data();
+        iovecs[i].iov_len  = slabs[i].capacity();
+
+        std::memset(&messages[i], 0, sizeof(struct mmsghdr));
+        messages[i].msg_hdr.msg_name       = &remotes[i];
+        messages[i].msg_hdr.msg_namelen    = sizeof(struct sockaddr_storage);
+        messages[i].msg_hdr.msg_iov        = &iovecs[i];
+        messages[i].msg_hdr.msg_iovlen     = 1;
+        messages[i].msg_hdr.msg_control    = &controls[i * CONTROL_LENGTH];
+        messages[i].msg_hdr.msg_controllen = CONTROL_LENGTH;
+    }
 
-                        // Store entry in queue.
-                        if (m_pipeline) {
-                            m_pipeline->add(std::move(pe));
-                        }
+    // Only one batch is read per call; the level-triggered Reactor calls again
+    // while datagrams are waiting so that other sockets are not starved.
+    const int numberOfMessages{::recvmmsg(m_socket, messages.data(), m_receiveBatchSize, MSG_DONTWAIT, nullptr)};
+    for (int i{0}; (i < numberOfMessages) && HAS_DELEGATE; i++) {
+        const std::size_t INDEX{static_cast<std::size_t>(i)};
+        struct msghdr &hdr = messages[INDEX].msg_hdr;
+        const std::size_t LENGTH{messages[INDEX].msg_len};
+        if (0 < LENGTH) {
+            // Extract the kernel time stamp from the control message; fall back to chrono.
+            std::chrono::system_clock::time_point timestamp;
+            bool hasTimeStamp{false};
+            int32_t segmentSize{0};
+            for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr); nullptr != cmsg; cmsg = CMSG_NXTHDR(&hdr, cmsg)) { // NOLINT
+                if ((SOL_SOCKET == cmsg->cmsg_level) && (SCM_TIMESTAMPNS == cmsg->cmsg_type)) {
+                    struct timespec receivedTimeStamp {};
+                    std::memcpy(&receivedTimeStamp, CMSG_DATA(cmsg), sizeof(struct timespec)); /* Flawfinder: ignore */ // NOLINT
+                    std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> transformedTimePoint(
+                        std::chrono::nanoseconds(receivedTimeStamp.tv_sec * 1000000000L + receivedTimeStamp.tv_nsec));
+                    timestamp    = std::chrono::time_point_cast<std::chrono::system_clock::duration>(transformedTimePoint);
+                    hasTimeStamp = true;
+                } else if ((SOL_UDP == cmsg->cmsg_level) && (UDP_GRO == cmsg->cmsg_type)) {
+                    std::memcpy(&segmentSize, CMSG_DATA(cmsg), sizeof(int32_t)); /* Flawfinder: ignore */ // NOLINT
+                }
+            }
+            if (!hasTimeStamp) {
+                timestamp = std::chrono::system_clock::now(); // LCOV_EXCL_LINE
+            }
+
+            std::size_t length{LENGTH};
+            const std::size_t SEGMENT_SIZE{static_cast<std::size_t>((std::max)(segmentSize, 0))};
+            if ((0 < SEGMENT_SIZE) && (SEGMENT_SIZE < length)) {
+                // The kernel coalesced several datagrams from the same sender; all
+                // but the last one have SEGMENT_SIZE bytes. The first datagram stays
+                // in the slab; the others are copied before the slab is handed over.
+                if (0 != (hdr.msg_flags & MSG_TRUNC)) {
+                    length -= length % SEGMENT_SIZE; // LCOV_EXCL_LINE
+                }
+                m_batchSegments.clear();
+                for (std::size_t offset{SEGMENT_SIZE}; offset < length; offset += SEGMENT_SIZE) {
+                    cluon::PooledBuffer segment{m_bufferPool->acquire()};
+                    if (nullptr != segment.data()) {
+                        const std::size_t SIZE{(std::min)(SEGMENT_SIZE, length - offset)};
+                        std::memcpy(segment.data(), slabs[INDEX].data() + offset, SIZE); /* Flawfinder: ignore */ // NOLINT
+                        segment.resize(SIZE);
+                        try {
+                            m_batchSegments.emplace_back(std::move(segment));
+                        } catch (...) {} // LCOV_EXCL_LINE
                     }
-                    totalBytesRead += bytesRead;
                 }
-            } while (!m_isBlockingSocket && (bytesRead > 0));
-        }
+                length = SEGMENT_SIZE;
+            }
 
-        if (static_cast<int32_t>(totalBytesRead) > 0) {
-            if (m_pipeline) {
-                m_pipeline->notifyAll();
+            slabs[INDEX].resize(length);
+            addToPipeline(std::move(slabs[INDEX]), remotes[INDEX], timestamp);
+            for (auto &segment : m_batchSegments) {
+                addToPipeline(std::move(segment), remotes[INDEX], timestamp);
             }
+            m_batchSegments.clear();
+            totalBytesRead += static_cast<ssize_t>(LENGTH);
+        }
+    }
+
+    return totalBytesRead;
+}
+#endif
+
+void UDPReceiver::addToPipeline(cluon::PooledBuffer &&data,
+                                const struct sockaddr_storage &remote,
+                                const std::chrono::system_clock::time_point &timestamp) noexcept {
+    const struct sockaddr_in *remoteAddress{reinterpret_cast<const struct sockaddr_in *>(&remote)}; // NOLINT
+    const unsigned long RECVFROM_IP{remoteAddress->sin_addr.s_addr};
+    const uint16_t RECVFROM_PORT{ntohs(remoteAddress->sin_port)};
+
+    // Check if the bytes actually came from us.
+    bool sentFromUs{false};
+    {
+        auto pos                   = m_listOfLocalIPAddresses.find(RECVFROM_IP);
+        const bool sentFromLocalIP = (pos != m_listOfLocalIPAddresses.end() && (*pos == RECVFROM_IP));
+        sentFromUs                 = sentFromLocalIP && (m_localSendFromPort == RECVFROM_PORT);
+    }
+
+    // Create a pipeline entry to be processed concurrently.
+    if (!sentFromUs) {
+        PipelineEntry pe;
+        pe.m_data       = std::move(data);
+        pe.m_from       = *remoteAddress;
+        pe.m_sampleTime = timestamp;
+
+        // Store entry in queue.
+        if (m_pipeline) {
+            m_pipeline->add(std::move(pe));
         }
     }
 }
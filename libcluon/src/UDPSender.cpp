@@ -12,6 +12,10 @@
 
 // clang-format off
 #ifndef WIN32
+    #ifdef __linux__
+        #include <netinet/udp.h>
+    #endif
+
     #include <arpa/inet.h>
     #include <ifaddrs.h>
     #include <netdb.h>
@@ -143,6 +147,29 @@ UDPSender::UDPSender(const std::string &sendToAddress, uint16_t sendToPort) noex
 }
 
 UDPSender::~UDPSender() noexcept {
+    {
+        std::lock_guard<std::mutex> lck(m_queueMutex);
+        m_flushThreadRunning.store(false);
+    }
+    m_queueCondition.notify_all();
+
+    // Joining the thread could fail.
+    try {
+        if (m_flushThread.joinable()) {
+            m_flushThread.join();
+        }
+    } catch (...) {} // LCOV_EXCL_LINE
+
+    // Send what is still waiting.
+    {
+        std::unique_lock<std::mutex> lck(m_queueMutex);
+        auto flushResultDelegate{m_flushResultDelegate};
+        auto retVal{flushQueue(lck)};
+        if (!retVal.empty() && (nullptr != flushResultDelegate)) {
+            flushResultDelegate(std::move(retVal));
+        }
+    }
+
     if (!(m_socket < 0)) {
 #ifdef WIN32
         ::shutdown(m_socket, SD_BOTH);
@@ -161,29 +188,283 @@ uint16_t UDPSender::getSendFromPort() const noexcept {
 }
 
 std::pair<ssize_t, int32_t> UDPSender::send(std::string &&data) const noexcept {
+    return send(data.data(), data.size());
+}
+
+std::pair<ssize_t, int32_t> UDPSender::send(const char *data, std::size_t length) const noexcept {
     if (-1 == m_socket) {
         return {-1, EBADF};
     }
 
-    if (data.empty()) {
+    if ((nullptr == data) || (0 == length)) {
         return {0, 0};
     }
 
     constexpr uint16_t MAX_LENGTH = static_cast<uint16_t>(UDPPacketSizeConstraints::MAX_SIZE_UDP_PACKET)
                                     - static_cast<uint16_t>(UDPPacketSizeConstraints::SIZE_IPv4_HEADER)
                                     - static_cast<uint16_t>(UDPPacketSizeConstraints::SIZE_UDP_HEADER);
-    if (MAX_LENGTH < data.size()) {
+    if (MAX_LENGTH < length) {
         return {-1, E2BIG};
     }
 
     std::lock_guard<std::mutex> lck(m_socketMutex);
     ssize_t bytesSent = ::sendto(m_socket,
-                                 data.c_str(),
-                                 data.length(),
+                                 data,
+                                 length,
                                  0,
                                  reinterpret_cast<const struct sockaddr *>(&m_sendToAddress), // NOLINT
                                  sizeof(m_sendToAddress));
 
     return {bytesSent, (0 > bytesSent ? errno : 0)};
 }
+
+std::vector<std::pair<ssize_t, int32_t>> UDPSender::send(std::vector<std::string> &&data) const noexcept {
+    std::lock_guard<std::mutex> lck(m_socketMutex);
+    return sendBatch(data);
+}
+
+std::vector<std::pair<ssize_t, int32_t>> UDPSender::sendBatch(std::vector<std::string> &data) const noexcept {
+    std::vector<std::pair<ssize_t, int32_t>> retVal;
+    try {
+        retVal.resize(data.size(), std::make_pair(0, 0));
+#ifdef __linux__
+        m_messages.resize(data.size());
+        m_iovecs.resize(data.size());
+        m_datagramIndices.resize(data.size());
+        m_numberOfSegments.resize(data.size());
+        m_segmentControls.resize(data.size() * CMSG_SPACE(sizeof(uint16_t)));
+#endif
+    } catch (...) { // LCOV_EXCL_LINE
+        retVal.clear(); // LCOV_EXCL_LINE
+        return retVal;  // LCOV_EXCL_LINE
+    }
+
+    constexpr uint16_t MAX_LENGTH = static_cast<uint16_t>(UDPPacketSizeConstraints::MAX_SIZE_UDP_PACKET)
+                                    - static_cast<uint16_t>(UDPPacketSizeConstraints::SIZE_IPv4_HEADER)
+                                    - static_cast<uint16_t>(UDPPacketSizeConstraints::SIZE_UDP_HEADER);
+
+#ifdef __linux__
+    constexpr std::size_t CONTROL_LENGTH{CMSG_SPACE(sizeof(uint16_t))};
+    const bool SEGMENTATION_OFFLOAD{m_isSegmentationOffloadEnabled.load()};
+
+    // Collect the datagrams that can be sent at all; with segmentation offload,
+    // consecutive datagrams of the same size (the last one may be shorter) are
+    // combined into one message.
+    std::size_t numberOfMessages{0};
+    for (std::size_t i{0}; i < data.size(); i++) {
+        if (-1 == m_socket) {
+            retVal[i] = std::make_pair(-1, EBADF);
+        } else if (MAX_LENGTH < data[i].size()) {
+            retVal[i] = std::make_pair(-1, E2BIG);
+        } else if (!data[i].empty()) {
+            m_iovecs[i].iov_base = const_cast<char *>(data[i].data()); // NOLINT
+            m_iovecs[i].iov_len  = data[i].size();
+
+            bool appendToPreviousMessage{false};
+            if (SEGMENTATION_OFFLOAD && (0 < numberOfMessages)) {
+                const std::size_t PREVIOUS{numberOfMessages - 1};
+                const std::size_t FIRST{m_datagramIndices[PREVIOUS]};
+                const std::size_t SEGMENT_SIZE{data[FIRST].size()};
+                appendToPreviousMessage = (FIRST + m_numberOfSegments[PREVIOUS] == i) && (data[i - 1].size() == SEGMENT_SIZE)
+                                          && (data[i].size() <= SEGMENT_SIZE) && (m_numberOfSegments[PREVIOUS] < MAX_SEGMENTS_PER_DATAGRAM)
+                                          && (SEGMENT_SIZE * m_numberOfSegments[PREVIOUS] + data[i].size() <= MAX_LENGTH);
+            }
+
+            if (appendToPreviousMessage) {
+                m_messages[numberOfMessages - 1].msg_hdr.msg_iovlen++;
+                m_numberOfSegments[numberOfMessages - 1]++;
+            } else {
+                std::memset(&m_messages[numberOfMessages], 0, sizeof(struct mmsghdr));
+                m_messages[numberOfMessages].msg_hdr.msg_name    = const_cast<struct sockaddr_in *>(&m_sendToAddress); // NOLINT
+                m_messages[numberOfMessages].msg_hdr.msg_namelen = sizeof(m_sendToAddress);
+                m_messages[numberOfMessages].msg_hdr.msg_iov     = &m_iovecs[i];
+                m_messages[numberOfMessages].msg_hdr.msg_iovlen  = 1;
+                m_datagramIndices[numberOfMessages]               = i;
+                m_numberOfSegments[numberOfMessages]              = 1;
+                numberOfMessages++;
+            }
+        }
+    }
+
+    // Tell the kernel where to split combined datagrams.
+    for (std::size_t i{0}; (i < numberOfMessages) && SEGMENTATION_OFFLOAD; i++) {
+        if (1 < m_numberOfSegments[i]) {
+            struct msghdr &hdr = m_messages[i].msg_hdr;
+            hdr.msg_control    = &m_segmentControls[i * CONTROL_LENGTH];
+            hdr.msg_controllen = CONTROL_LENGTH;
+            struct cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr);
+            cmsg->cmsg_level     = SOL_UDP;
+            cmsg->cmsg_type      = UDP_SEGMENT;
+            cmsg->cmsg_len       = CMSG_LEN(sizeof(uint16_t));
+            const uint16_t SEGMENT_SIZE{static_cast<uint16_t>(data[m_datagramIndices[i]].size())};
+            std::memcpy(CMSG_DATA(cmsg), &SEGMENT_SIZE, sizeof(uint16_t)); /* Flawfinder: ignore */ // NOLINT
+        }
+    }
+
+    std::size_t offset{0};
+    while (offset < numberOfMessages) {
+        const unsigned int LENGTH{static_cast<unsigned int>((std::min)(numberOfMessages - offset, static_cast<std::size_t>(MAX_DATAGRAMS_PER_SYSTEM_CALL)))};
+        const int SENT{::sendmmsg(m_socket, &m_messages[offset], LENGTH, 0)};
+        if (0 >= SENT) {
+            const int32_t ERROR_CODE{(0 > SENT) ? errno : EAGAIN};
+            const std::size_t FIRST{m_datagramIndices[offset]};
+            if (1 == m_numberOfSegments[offset]) {
+                // The first datagram of this call failed; report and skip it.
+                retVal[FIRST] = std::make_pair(-1, ERROR_CODE);
+            } else {
+                // The network path does not support the combined message; send its datagrams one by one.
+                for (std::size_t i{FIRST}; i < FIRST + m_numberOfSegments[offset]; i++) {
+                    ssize_t bytesSent = ::sendto(m_socket,
+                                                 data[i].c_str(),
+                                                 data[i].length(),
+                                                 0,
+                                                 reinterpret_cast<const struct sockaddr *>(&m_sendToAddress), // NOLINT
+                                                 sizeof(m_sendToAddress));
+                    retVal[i] = std::make_pair(bytesSent, (0 > bytesSent ? errno : 0));
+                }
+            }
+            offset++;
+        } else {
+            for (std::size_t i{offset}; i < offset + static_cast<std::size_t>(SENT); i++) {
+                const std::size_t FIRST{m_datagramIndices[i]};
+                if (1 == m_numberOfSegments[i]) {
+                    retVal[FIRST] = std::make_pair(static_cast<ssize_t>(m_messages[i].msg_len), 0);
+                } else {
+                    for (std::size_t j{FIRST}; j < FIRST + m_numberOfSegments[i]; j++) {
+                        retVal[j] = std::make_pair(static_cast<ssize_t>(data[j].size()), 0);
+                    }
+                }
+            }
+            offset += static_cast<std::size_t>(SENT);
+        }
+    }
+#else
+    for (std::size_t i{0}; i < data.size(); i++) {
+        if (-1 == m_socket) {
+            retVal[i] = std::make_pair(-1, EBADF);
+        } else if (MAX_LENGTH < data[i].size()) {
+            retVal[i] = std::make_pair(-1, E2BIG);
+        } else if (!data[i].empty()) {
+            ssize_t bytesSent = ::sendto(m_socket,
+                                         data[i].c_str(),
+                                         data[i].length(),
+                                         0,
+                                         reinterpret_cast<const struct sockaddr *>(&m_sendToAddress), // NOLINT
+                                         sizeof(m_sendToAddress));
+            retVal[i] = std::make_pair(bytesSent, (0 > bytesSent ? errno : 0));
+        }
+    }
+#endif
+
+    return retVal;
+}
+
+bool UDPSender::enableSegmentationOffload(bool enable) noexcept {
+    bool retVal{!enable};
+#ifdef __linux__
+    if (enable && !(m_socket < 0)) {
+        // Kernels without segmentation offload reject this option.
+        int32_t segmentSize{0};
+        retVal = (0 == ::setsockopt(m_socket, SOL_UDP, UDP_SEGMENT, &segmentSize, sizeof(segmentSize)));
+    }
+#endif
+    m_isSegmentationOffloadEnabled.store(enable && retVal);
+    return retVal;
+}
+
+void UDPSender::setFlushPolicy(uint32_t maxNumberOfQueuedDatagrams,
+                               std::chrono::microseconds maxDelay,
+                               std::function<void(std::vector<std::pair<ssize_t, int32_t>> &&)> flushResultDelegate) noexcept {
+    {
+        std::lock_guard<std::mutex> lck(m_queueMutex);
+        m_maxNumberOfQueuedDatagrams = (0 < maxNumberOfQueuedDatagrams) ? maxNumberOfQueuedDatagrams : 1;
+        m_maxDelay                   = (std::max)(maxDelay, std::chrono::microseconds(0));
+        m_flushResultDelegate        = std::move(flushResultDelegate);
+
+        // The thread to meet the deadline is only needed once a delay is set.
+        if ((0 < m_maxDelay.count()) && !m_flushThreadRunning.load()) {
+            // Constructing a thread could fail.
+            try {
+                m_flushThreadRunning.store(true);
+                m_flushThread = std::thread(&UDPSender::flushOnDeadline, this);
+            } catch (...) {                          // LCOV_EXCL_LINE
+                m_flushThreadRunning.store(false); // LCOV_EXCL_LINE
+            }
+        }
+    }
+    m_queueCondition.notify_all();
+}
+
+std::pair<ssize_t, int32_t> UDPSender::enqueue(std::string &&data) noexcept {
+    if (-1 == m_socket) {
+        return {-1, EBADF};
+    }
+
+    if (data.empty()) {
+        return {0, 0};
+    }
+
+    constexpr uint16_t MAX_LENGTH = static_cast<uint16_t>(UDPPacketSizeConstraints::MAX_SIZE_UDP_PACKET)
+                                    - static_cast<uint16_t>(UDPPacketSizeConstraints::SIZE_IPv4_HEADER)
+                                    - static_cast<uint16_t>(UDPPacketSizeConstraints::SIZE_UDP_HEADER);
+    if (MAX_LENGTH < data.size()) {
+        return {-1, E2BIG};
+    }
+
+    const ssize_t LENGTH{static_cast<ssize_t>(data.size())};
+    std::unique_lock<std::mutex> lck(m_queueMutex);
+    try {
+        if (m_queue.empty()) {
+            m_oldestQueuedDatagram = std::chrono::steady_clock::now();
+            m_queueCondition.notify_all();
+        }
+        m_queue.emplace_back(std::move(data));
+    } catch (...) { return {-1, ENOMEM}; } // LCOV_EXCL_LINE
+
+    if (m_maxNumberOfQueuedDatagrams <= m_queue.size()) {
+        auto flushResultDelegate{m_flushResultDelegate};
+        auto retVal{flushQueue(lck)};
+        if (nullptr != flushResultDelegate) {
+            flushResultDelegate(std::move(retVal));
+        }
+    }
+    return {LENGTH, 0};
+}
+
+std::vector<std::pair<ssize_t, int32_t>> UDPSender::flush() noexcept {
+    std::unique_lock<std::mutex> lck(m_queueMutex);
+    return flushQueue(lck);
+}
+
+std::vector<std::pair<ssize_t, int32_t>> UDPSender::flushQueue(std::unique_lock<std::mutex> &lck) noexcept {
+    std::vector<std::string> datagrams;
+    datagrams.swap(m_queue);
+
+    // Take the socket before releasing the queue so that concurrently
+    // flushed queues are sent in the order they were filled.
+    std::lock_guard<std::mutex> socketLck(m_socketMutex);
+    lck.unlock();
+    return (datagrams.empty() ? std::vector<std::pair<ssize_t, int32_t>>{} : sendBatch(datagrams));
+}
+
+void UDPSender::flushOnDeadline() noexcept {
+    std::unique_lock<std::mutex> lck(m_queueMutex);
+    while (m_flushThreadRunning.load()) {
+        if (m_queue.empty() || (0 == m_maxDelay.count())) {
+            m_queueCondition.wait(lck);
+        } else {
+            const auto DEADLINE{m_oldestQueuedDatagram + m_maxDelay};
+            if (std::chrono::steady_clock::now() < DEADLINE) {
+                m_queueCondition.wait_until(lck, DEADLINE);
+            } else {
+                auto flushResultDelegate{m_flushResultDelegate};
+                auto retVal{flushQueue(lck)};
+                if (nullptr != flushResultDelegate) {
+                    flushResultDelegate(std::move(retVal));
+                }
+                lck.lock();
+            }
+        }
+    }
+}
 } // namespace cluon
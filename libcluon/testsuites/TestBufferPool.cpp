@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2017-2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/BufferPool.hpp"
+
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+TEST_CASE("Acquire and release slabs from BufferPool.") {
+    auto pool = std::make_shared<cluon::BufferPool>(2, 16);
+    REQUIRE(16 == pool->slabSize());
+    REQUIRE(2 == pool->numberOfAvailableSlabs());
+
+    {
+        cluon::PooledBuffer b1 = pool->acquire();
+        REQUIRE(nullptr != b1.data());
+        REQUIRE(16 == b1.capacity());
+        REQUIRE(0 == b1.size());
+        REQUIRE(1 == pool->numberOfAvailableSlabs());
+
+        std::memcpy(b1.data(), "Hello", 5);
+        b1.resize(5);
+        REQUIRE(5 == b1.size());
+
+        // Size is limited by capacity.
+        b1.resize(100);
+        REQUIRE(16 == b1.size());
+    }
+    REQUIRE(2 == pool->numberOfAvailableSlabs());
+    REQUIRE(0 == pool->numberOfOverflowAllocations());
+}
+
+TEST_CASE("Move PooledBuffer.") {
+    auto pool = std::make_shared<cluon::BufferPool>(1, 16);
+
+    cluon::PooledBuffer b1 = pool->acquire();
+    char *slab{b1.data()};
+    b1.resize(3);
+
+    cluon::PooledBuffer b2{std::move(b1)};
+    REQUIRE(nullptr == b1.data()); // NOLINT
+    REQUIRE(0 == b1.size());       // NOLINT
+    REQUIRE(slab == b2.data());
+    REQUIRE(3 == b2.size());
+    REQUIRE(0 == pool->numberOfAvailableSlabs());
+
+    cluon::PooledBuffer b3;
+    b3 = std::move(b2);
+    REQUIRE(slab == b3.data());
+    REQUIRE(0 == pool->numberOfAvailableSlabs());
+
+    b3.release();
+    REQUIRE(nullptr == b3.data());
+    REQUIRE(1 == pool->numberOfAvailableSlabs());
+}
+
+TEST_CASE("Exhausted BufferPool falls back to heap.") {
+    auto pool = std::make_shared<cluon::BufferPool>(1, 16);
+
+    std::vector<cluon::PooledBuffer> buffers;
+    buffers.emplace_back(pool->acquire());
+    buffers.emplace_back(pool->acquire());
+    REQUIRE(0 == pool->numberOfAvailableSlabs());
+    REQUIRE(1 == pool->numberOfOverflowAllocations());
+    REQUIRE(nullptr != buffers[1].data());
+    REQUIRE(16 == buffers[1].capacity());
+
+    buffers.clear();
+    REQUIRE(1 == pool->numberOfAvailableSlabs());
+}
+
+TEST_CASE("PooledBuffer keeps BufferPool alive.") {
+    cluon::PooledBuffer b1;
+    {
+        auto pool = std::make_shared<cluon::BufferPool>(1, 16);
+        b1        = pool->acquire();
+    }
+    REQUIRE(nullptr != b1.data());
+    b1.data()[0] = 'a';
+    b1.release();
+    REQUIRE(nullptr == b1.data());
+}
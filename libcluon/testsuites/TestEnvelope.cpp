@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2017-2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/Envelope.hpp"
+#include "cluon/ProtoSizeVisitor.hpp"
+#include "cluon/ToProtoVisitor.hpp"
+#include "cluon/cluonDataStructures.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+
+TEST_CASE("Peek dataType from serialized Envelopes.") {
+    for (int32_t dataType : {0, 1, 12, -1, 63, 64, -65, 1000000, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min()}) {
+        cluon::data::Envelope env;
+        env.dataType(dataType).senderStamp(3);
+        const std::string DATA{cluon::serializeEnvelope(std::move(env))};
+
+        auto retVal = cluon::peekEnvelopeDataType(DATA.data(), DATA.size());
+        REQUIRE(retVal.first);
+        REQUIRE(dataType == retVal.second);
+
+        // Peeking must match the complete decoding.
+        std::stringstream sstr(DATA);
+        auto decoded = cluon::extractEnvelope(sstr);
+        REQUIRE(decoded.first);
+        REQUIRE(decoded.second.dataType() == retVal.second);
+
+        auto decodedFromMemory = cluon::extractEnvelope(DATA.data(), DATA.size());
+        REQUIRE(decodedFromMemory.first);
+        REQUIRE(decodedFromMemory.second.dataType() == retVal.second);
+        REQUIRE(3 == decodedFromMemory.second.senderStamp());
+    }
+}
+
+TEST_CASE("Peek dataType from invalid data.") {
+    cluon::data::Envelope env;
+    env.dataType(12);
+    const std::string DATA{cluon::serializeEnvelope(std::move(env))};
+
+    REQUIRE(!cluon::peekEnvelopeDataType(nullptr, 0).first);
+    REQUIRE(!cluon::peekEnvelopeDataType(DATA.data(), 6).first);
+    REQUIRE(cluon::peekEnvelopeDataType(DATA.data(), 7).first);
+
+    // Wrong OD4 header.
+    std::string wrongHeader{DATA};
+    wrongHeader[1] = 0x0D;
+    REQUIRE(!cluon::peekEnvelopeDataType(wrongHeader.data(), wrongHeader.size()).first);
+
+    // The Envelope does not start with the field dataType.
+    std::string wrongKey{DATA};
+    wrongKey[5] = 0x12;
+    REQUIRE(!cluon::peekEnvelopeDataType(wrongKey.data(), wrongKey.size()).first);
+
+    // Unterminated VarInt.
+    const std::string UNTERMINATED{"\x0D\xA4\x00\x00\x00\x08\xFF\xFF", 8};
+    REQUIRE(!cluon::peekEnvelopeDataType(UNTERMINATED.data(), UNTERMINATED.size()).first);
+}
+
+TEST_CASE("Extract Envelope from invalid data in memory.") {
+    cluon::data::Envelope env;
+    env.dataType(12);
+    const std::string DATA{cluon::serializeEnvelope(std::move(env))};
+
+    REQUIRE(!cluon::extractEnvelope(nullptr, 0).first);
+    REQUIRE(!cluon::extractEnvelope(DATA.data(), 4).first);
+    REQUIRE(!cluon::extractEnvelope(DATA.data(), DATA.size() - 1).first);
+
+    std::string wrongHeader{DATA};
+    wrongHeader[1] = 0x0D;
+    REQUIRE(!cluon::extractEnvelope(wrongHeader.data(), wrongHeader.size()).first);
+}
+
+TEST_CASE("Serialize Envelope into one pre-sized buffer.") {
+    cluon::data::TimeStamp ts;
+    ts.seconds(1526000000).microseconds(123456);
+
+    for (std::size_t payloadSize : {0u, 1u, 127u, 128u, 70000u}) {
+        const std::string PAYLOAD(payloadSize, 'p');
+        cluon::data::Envelope env;
+        env.dataType(42).serializedData(PAYLOAD).sent(ts).sampleTimeStamp(ts).senderStamp(7);
+
+        cluon::ProtoSizeVisitor protoSize;
+        env.accept(protoSize);
+        cluon::ToProtoVisitor protoEncoder;
+        env.accept(protoEncoder);
+        REQUIRE(protoEncoder.encodedBuffer().size() == protoSize.encodedSize());
+
+        const std::string DATA{cluon::serializeEnvelope(std::move(env))};
+        REQUIRE(5 + protoSize.encodedSize() == DATA.size());
+        REQUIRE(0x0D == static_cast<uint8_t>(DATA[0]));
+        REQUIRE(0xA4 == static_cast<uint8_t>(DATA[1]));
+        REQUIRE(protoEncoder.encodedBuffer() == DATA.substr(5));
+
+        auto decoded = cluon::extractEnvelope(DATA.data(), DATA.size());
+        REQUIRE(decoded.first);
+        REQUIRE(42 == decoded.second.dataType());
+        REQUIRE(PAYLOAD == decoded.second.serializedData());
+        REQUIRE(123456 == decoded.second.sampleTimeStamp().microseconds());
+        REQUIRE(7 == decoded.second.senderStamp());
+    }
+}
+
+TEST_CASE("Encode after existing bytes and release encoded data.") {
+    cluon::data::TimeStamp ts;
+    ts.seconds(1).microseconds(2);
+
+    cluon::ToProtoVisitor protoEncoder;
+    ts.accept(protoEncoder);
+    const std::string EXPECTED{protoEncoder.encodedData()};
+
+    std::string prefix{"ABC"};
+    prefix.reserve(3 + EXPECTED.size());
+    cluon::ToProtoVisitor protoEncoderWithPrefix{std::move(prefix)};
+    ts.accept(protoEncoderWithPrefix);
+    const std::string DATA{protoEncoderWithPrefix.releaseEncodedData()};
+    REQUIRE(("ABC" + EXPECTED) == DATA);
+    REQUIRE(protoEncoderWithPrefix.encodedBuffer().empty());
+
+    // The released payload is moved into the Envelope.
+    cluon::data::Envelope env;
+    env.serializedData(protoEncoder.releaseEncodedData());
+    REQUIRE(EXPECTED == env.serializedData());
+    REQUIRE(protoEncoder.encodedBuffer().empty());
+}
+
+TEST_CASE("Benchmark serializing Envelopes.", "[.benchmark]") {
+    constexpr uint32_t ITERATIONS{100 * 1000};
+    for (std::size_t payloadSize : {16u, 1024u, 60000u}) {
+        const std::string PAYLOAD(payloadSize, 'b');
+        std::size_t bytes{0};
+        auto before = std::chrono::steady_clock::now();
+        for (uint32_t i{0}; i < ITERATIONS; i++) {
+            cluon::data::Envelope env;
+            env.dataType(42).serializedData(PAYLOAD).senderStamp(i);
+            bytes += cluon::serializeEnvelope(std::move(env)).size();
+        }
+        auto after = std::chrono::steady_clock::now();
+        REQUIRE(0 < bytes);
+        std::cout << "Serializing an Envelope with " << payloadSize << " bytes payload took "
+                  << (std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count() / ITERATIONS) << " ns." << std::endl;
+    }
+}
+
+TEST_CASE("Scan Envelope headers without decoding the payload.") {
+    for (std::size_t payloadSize : {0u, 1u, 200u, 70000u}) {
+        for (int32_t dataType : {0, 12, -1, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min()}) {
+            cluon::data::TimeStamp sent;
+            sent.seconds(1).microseconds(2);
+            cluon::data::TimeStamp sampleTimeStamp;
+            sampleTimeStamp.seconds(-1526000000).microseconds(999999);
+            cluon::data::Envelope env;
+            env.dataType(dataType).serializedData(std::string(payloadSize, 's')).sent(sent).sampleTimeStamp(sampleTimeStamp).senderStamp(4000000000u);
+            const std::string DATA{cluon::serializeEnvelope(std::move(env))};
+
+            auto scanned = cluon::scanEnvelope(DATA.data(), DATA.size());
+            REQUIRE(scanned.first);
+            REQUIRE(DATA.size() == scanned.second.m_length);
+
+            // Scanning must match the complete decoding.
+            auto decoded = cluon::extractEnvelope(DATA.data(), DATA.size());
+            REQUIRE(decoded.first);
+            REQUIRE(decoded.second.dataType() == scanned.second.m_dataType);
+            REQUIRE(decoded.second.senderStamp() == scanned.second.m_senderStamp);
+            REQUIRE(decoded.second.sampleTimeStamp().seconds() == scanned.second.m_sampleTimeStamp.seconds());
+            REQUIRE(decoded.second.sampleTimeStamp().microseconds() == scanned.second.m_sampleTimeStamp.microseconds());
+            REQUIRE(payloadSize == scanned.second.m_serializedDataLength);
+            REQUIRE(decoded.second.serializedData()
+                    == DATA.substr(scanned.second.m_serializedDataOffset, scanned.second.m_serializedDataLength));
+
+            // Trailing bytes from the next Envelope are ignored.
+            const std::string TWO_ENVELOPES{DATA + DATA};
+            auto first = cluon::scanEnvelope(TWO_ENVELOPES.data(), TWO_ENVELOPES.size());
+            REQUIRE(first.first);
+            REQUIRE(DATA.size() == first.second.m_length);
+        }
+    }
+}
+
+TEST_CASE("Scan Envelope with unknown fields.") {
+    // dataType=3, unknown fields of all wire types, senderStamp=7.
+    const std::string DATA{"\x0D\xA4\x19\x00\x00"
+                           "\x08\x06"
+                           "\x38\x96\x01"
+                           "\x41\x01\x02\x03\x04\x05\x06\x07\x08"
+                           "\x4D\x01\x02\x03\x04"
+                           "\x52\x02\xAB\xCD"
+                           "\x30\x07",
+                           30};
+    auto scanned = cluon::scanEnvelope(DATA.data(), DATA.size());
+    REQUIRE(scanned.first);
+    REQUIRE(3 == scanned.second.m_dataType);
+    REQUIRE(7 == scanned.second.m_senderStamp);
+    REQUIRE(0 == scanned.second.m_serializedDataLength);
+}
+
+TEST_CASE("Scan Envelope from invalid data.") {
+    cluon::data::TimeStamp sampleTimeStamp;
+    sampleTimeStamp.seconds(1).microseconds(2);
+    cluon::data::Envelope env;
+    env.dataType(12).serializedData("abc").sampleTimeStamp(sampleTimeStamp);
+    const std::string DATA{cluon::serializeEnvelope(std::move(env))};
+
+    REQUIRE(!cluon::scanEnvelope(nullptr, 0).first);
+    for (std::size_t length{0}; length < DATA.size(); length++) {
+        REQUIRE(!cluon::scanEnvelope(DATA.data(), length).first);
+    }
+
+    std::string wrongHeader{DATA};
+    wrongHeader[1] = 0x0D;
+    REQUIRE(!cluon::scanEnvelope(wrongHeader.data(), wrongHeader.size()).first);
+
+    // Unterminated VarInt.
+    const std::string UNTERMINATED{"\x0D\xA4\x02\x00\x00\x08\xFF", 7};
+    REQUIRE(!cluon::scanEnvelope(UNTERMINATED.data(), UNTERMINATED.size()).first);
+
+    // Length-delimited field exceeding the Envelope.
+    const std::string TOO_LONG{"\x0D\xA4\x03\x00\x00\x12\x05\x00", 8};
+    REQUIRE(!cluon::scanEnvelope(TOO_LONG.data(), TOO_LONG.size()).first);
+
+    // Unsupported wire type.
+    const std::string WRONG_WIRE_TYPE{"\x0D\xA4\x02\x00\x00\x0B\x00", 7};
+    REQUIRE(!cluon::scanEnvelope(WRONG_WIRE_TYPE.data(), WRONG_WIRE_TYPE.size()).first);
+
+    // Malformed nested sampleTimeStamp.
+    const std::string WRONG_TIMESTAMP{"\x0D\xA4\x03\x00\x00\x2A\x01\x08", 8};
+    REQUIRE(!cluon::scanEnvelope(WRONG_TIMESTAMP.data(), WRONG_TIMESTAMP.size()).first);
+}
+
+TEST_CASE("Extract bytes of Envelopes from stream.") {
+    std::string expected[2];
+    std::stringstream sstr;
+    for (int32_t i{0}; i < 2; i++) {
+        cluon::data::Envelope env;
+        env.dataType(10 + i).serializedData(std::string(static_cast<std::size_t>(100 * i), 'e'));
+        expected[i] = cluon::serializeEnvelope(std::move(env));
+        sstr << expected[i];
+    }
+    sstr << std::string("\x0D\xA4\x10\x00\x00\x08", 6);
+
+    std::string data;
+    REQUIRE(cluon::extractEnvelopeData(sstr, data));
+    REQUIRE(expected[0] == data);
+    REQUIRE(cluon::extractEnvelopeData(sstr, data));
+    REQUIRE(expected[1] == data);
+    // Truncated Envelope.
+    REQUIRE(!cluon::extractEnvelopeData(sstr, data));
+    REQUIRE(!cluon::extractEnvelopeData(sstr, data));
+
+    std::stringstream wrongHeader(std::string("\x0D\xA5\x00\x00\x00", 5));
+    REQUIRE(!cluon::extractEnvelopeData(wrongHeader, data));
+}
+
+TEST_CASE("Extract Envelope with mismatching wire types from memory.") {
+    // serializedData = "ab" followed by dataType encoded as length-delimited field of 1000 bytes.
+    const std::string DATA{"\x0D\xA4\x07\x00\x00"
+                           "\x12\x02" "ab"
+                           "\x10\xE8\x07",
+                           12};
+    auto env = cluon::extractEnvelope(DATA.data(), DATA.size());
+    REQUIRE(env.first);
+    REQUIRE(0 == env.second.dataType());
+    REQUIRE("ab" == env.second.serializedData());
+
+    // serializedData encoded as VarInt must not be interpreted as length.
+    const std::string VARINT{"\x0D\xA4\x05\x00\x00"
+                             "\x10\xFF\xFF\xFF\x0F",
+                             10};
+    env = cluon::extractEnvelope(VARINT.data(), VARINT.size());
+    REQUIRE(env.first);
+    REQUIRE(env.second.serializedData().empty());
+}
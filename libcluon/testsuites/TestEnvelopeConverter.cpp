@@ -1388,3 +1388,41 @@ message MyTestMessage5 [id = 30009] {
     REQUIRE(tmp2.attribute10() == Approx(tmp.attribute10()));
     REQUIRE(tmp2.attribute11() == tmp.attribute11());
 }
+
+TEST_CASE("Transform Envelope into JSON represention for payload with mismatching wire types.") {
+    // attribute2 is a valid nested message, followed by attribute1 (string) as
+    // VarInt of 1000 and attribute3 (float) as length-delimited field.
+    const std::string PAYLOAD{"\x12\x02\x08\x07"
+                              "\x08\xE8\x07"
+                              "\x1A\x01x",
+                              10};
+
+    cluon::data::Envelope env;
+    env.dataType(30010).serializedData(PAYLOAD);
+
+    const char *messageSpecification = R"(
+message MessageA [id = 30002] {
+    uint8 attribute1 [ default = 123, id = 1 ];
+}
+
+message MessageC [id = 30010] {
+    string attribute1 [ id = 1 ];
+    MessageA attribute2 [ id = 2 ];
+    float attribute3 [ id = 3 ];
+}
+)";
+
+    cluon::EnvelopeConverter envConverter;
+    REQUIRE(2 == envConverter.setMessageSpecification(std::string(messageSpecification)));
+    const std::string JSON{envConverter.getJSONFromEnvelope(env)};
+    REQUIRE(std::string::npos != JSON.find(R"("MessageC":{"attribute1":"",)"));
+    REQUIRE(std::string::npos != JSON.find(R"("attribute2":{"attribute1":7},)"));
+    REQUIRE(std::string::npos != JSON.find(R"("attribute3":0}})"));
+
+    // The same payload decoded into a message type that is known at compile time.
+    testdata::MyTestMessage5 tmp5;
+    env.dataType(testdata::MyTestMessage5::ID()).serializedData(std::string{"\x58\xE8\x07\x48\x05", 5});
+    tmp5 = cluon::extractMessage<testdata::MyTestMessage5>(std::move(env));
+    REQUIRE("Hello World!" == tmp5.attribute11());
+    REQUIRE(-1.2345f == Approx(tmp5.attribute9()));
+}
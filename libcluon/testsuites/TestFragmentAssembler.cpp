@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2017-2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/Envelope.hpp"
+#include "cluon/FragmentAssembler.hpp"
+#include "cluon/PortableEndian.hpp"
+#include "cluon/cluonDataStructures.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+static std::string createSerializedEnvelope(int32_t dataType, std::size_t size) {
+    cluon::data::Envelope env;
+    std::string payload(size, ' ');
+    for (std::size_t i{0}; i < payload.size(); i++) {
+        payload[i] = static_cast<char>(i % 253);
+    }
+    env.dataType(dataType).serializedData(payload);
+    return cluon::serializeEnvelope(std::move(env));
+}
+
+TEST_CASE("Fragment and reassemble an Envelope.") {
+    const std::string ENVELOPE{createSerializedEnvelope(-17, 200 * 1000)};
+    auto fragments = cluon::FragmentAssembler::fragment(ENVELOPE, -17, 42, 65507);
+    REQUIRE(4 == fragments.size());
+    for (const auto &f : fragments) {
+        REQUIRE(65507 >= f.size());
+        REQUIRE(cluon::FragmentAssembler::isFragment(f.data(), f.size()));
+        REQUIRE(!cluon::FragmentAssembler::isFragment(ENVELOPE.data(), ENVELOPE.size()));
+
+        // The dataType can be read from every fragment.
+        auto dataType = cluon::peekEnvelopeDataType(f.data(), f.size());
+        REQUIRE(dataType.first);
+        REQUIRE(-17 == dataType.second);
+    }
+
+    cluon::FragmentAssembler fa;
+    const auto NOW{std::chrono::steady_clock::now()};
+    for (std::size_t i{0}; i < fragments.size() - 1; i++) {
+        auto retVal = fa.add(fragments[i].data(), fragments[i].size(), 1, NOW);
+        REQUIRE(!retVal.first);
+        REQUIRE(1 == fa.statistics().numberOfIncompleteMessages);
+    }
+    auto retVal = fa.add(fragments.back().data(), fragments.back().size(), 1, NOW);
+    REQUIRE(retVal.first);
+    REQUIRE(ENVELOPE == retVal.second);
+
+    auto stats = fa.statistics();
+    REQUIRE(1 == stats.numberOfReassembledMessages);
+    REQUIRE(0 == stats.numberOfEvictedMessages);
+    REQUIRE(0 == stats.numberOfIncompleteMessages);
+    REQUIRE(0 == stats.numberOfBufferedBytes);
+}
+
+TEST_CASE("Reassemble fragments out of order, with duplicates, and from interleaved senders.") {
+    const std::string ENVELOPE1{createSerializedEnvelope(1, 12 * 1000)};
+    const std::string ENVELOPE2{createSerializedEnvelope(2, 9 * 1000)};
+    auto fragments1 = cluon::FragmentAssembler::fragment(ENVELOPE1, 1, 7, 1500);
+    auto fragments2 = cluon::FragmentAssembler::fragment(ENVELOPE2, 2, 7, 1500);
+    REQUIRE(7 < fragments1.size());
+    REQUIRE(6 < fragments2.size());
+    std::reverse(fragments1.begin(), fragments1.end());
+
+    cluon::FragmentAssembler fa;
+    const auto NOW{std::chrono::steady_clock::now()};
+    uint32_t completed{0};
+    for (std::size_t i{0}; i < fragments1.size(); i++) {
+        // Same sequence number but different senders.
+        auto retVal1 = fa.add(fragments1[i].data(), fragments1[i].size(), 100, NOW);
+        if (retVal1.first) {
+            REQUIRE(ENVELOPE1 == retVal1.second);
+            completed++;
+        }
+        if (i < fragments2.size()) {
+            auto retVal2 = fa.add(fragments2[i].data(), fragments2[i].size(), 200, NOW);
+            if (retVal2.first) {
+                REQUIRE(ENVELOPE2 == retVal2.second);
+                completed++;
+            }
+            // A duplicate does not complete the message twice.
+            auto retVal3 = fa.add(fragments2[0].data(), fragments2[0].size(), 200, NOW);
+            REQUIRE(!retVal3.first);
+        }
+    }
+    REQUIRE(2 == completed);
+}
+
+TEST_CASE("Incomplete messages are evicted after the timeout.") {
+    const std::string ENVELOPE{createSerializedEnvelope(1, 10 * 1000)};
+    auto fragments = cluon::FragmentAssembler::fragment(ENVELOPE, 1, 1, 1500);
+
+    cluon::FragmentAssembler fa(1024 * 1024, std::chrono::milliseconds(100));
+    const auto NOW{std::chrono::steady_clock::now()};
+    REQUIRE(!fa.add(fragments[0].data(), fragments[0].size(), 1, NOW).first);
+    REQUIRE(1 == fa.statistics().numberOfIncompleteMessages);
+
+    // The remaining fragments arrive too late.
+    for (std::size_t i{1}; i < fragments.size(); i++) {
+        REQUIRE(!fa.add(fragments[i].data(), fragments[i].size(), 1, NOW + std::chrono::milliseconds(200)).first);
+    }
+    auto stats = fa.statistics();
+    REQUIRE(1 == stats.numberOfEvictedMessages);
+    REQUIRE(1 == stats.numberOfIncompleteMessages);
+    REQUIRE(0 == stats.numberOfReassembledMessages);
+}
+
+TEST_CASE("Oldest incomplete messages are evicted when the memory limit is reached.") {
+    const std::string ENVELOPE{createSerializedEnvelope(1, 10 * 1000)};
+    cluon::FragmentAssembler fa(static_cast<uint32_t>(2 * ENVELOPE.size()));
+    const auto NOW{std::chrono::steady_clock::now()};
+    for (uint32_t sequenceNumber{0}; sequenceNumber < 3; sequenceNumber++) {
+        auto fragments = cluon::FragmentAssembler::fragment(ENVELOPE, 1, sequenceNumber, 1500);
+        REQUIRE(!fa.add(fragments[0].data(), fragments[0].size(), 1, NOW + std::chrono::milliseconds(sequenceNumber)).first);
+    }
+    auto stats = fa.statistics();
+    REQUIRE(1 == stats.numberOfEvictedMessages);
+    REQUIRE(2 == stats.numberOfIncompleteMessages);
+    REQUIRE(2 * ENVELOPE.size() == stats.numberOfBufferedBytes);
+
+    // The oldest message cannot be completed anymore; the newest one can.
+    auto fragments0 = cluon::FragmentAssembler::fragment(ENVELOPE, 1, 0, 1500);
+    auto fragments2 = cluon::FragmentAssembler::fragment(ENVELOPE, 1, 2, 1500);
+    bool completed0{false};
+    bool completed2{false};
+    for (std::size_t i{1}; i < fragments2.size(); i++) {
+        completed2 |= fa.add(fragments2[i].data(), fragments2[i].size(), 1, NOW).first;
+    }
+    for (std::size_t i{1}; i < fragments0.size(); i++) {
+        completed0 |= fa.add(fragments0[i].data(), fragments0[i].size(), 1, NOW).first;
+    }
+    REQUIRE(completed2);
+    REQUIRE(!completed0);
+
+    // A message larger than the memory limit is rejected right away.
+    cluon::FragmentAssembler small(1000);
+    auto fragments = cluon::FragmentAssembler::fragment(ENVELOPE, 1, 0, 1500);
+    REQUIRE(!small.add(fragments[0].data(), fragments[0].size(), 1, NOW).first);
+    REQUIRE(1 == small.statistics().numberOfEvictedMessages);
+    REQUIRE(0 == small.statistics().numberOfIncompleteMessages);
+}
+
+TEST_CASE("Invalid fragments are ignored.") {
+    const std::string ENVELOPE{createSerializedEnvelope(1, 5000)};
+    auto fragments = cluon::FragmentAssembler::fragment(ENVELOPE, 1, 1, 1500);
+    const auto NOW{std::chrono::steady_clock::now()};
+
+    cluon::FragmentAssembler fa;
+    REQUIRE(!fa.add(nullptr, 0, 1, NOW).first);
+    REQUIRE(!fa.add(ENVELOPE.data(), ENVELOPE.size(), 1, NOW).first);
+
+    // Truncated fragment.
+    REQUIRE(!fa.add(fragments[0].data(), fragments[0].size() - 1, 1, NOW).first);
+    REQUIRE(!fa.add(fragments[0].data(), 10, 1, NOW).first);
+    REQUIRE(0 == fa.statistics().numberOfIncompleteMessages);
+
+    // Nothing to fragment or no space for any payload.
+    REQUIRE(cluon::FragmentAssembler::fragment("", 1, 1, 1500).empty());
+    REQUIRE(cluon::FragmentAssembler::fragment(ENVELOPE, 1, 1, 10).empty());
+}
+
+TEST_CASE("Envelopes exceeding the length of the OD4 header are rejected.") {
+    constexpr std::size_t MAX_LENGTH{0xFFFFFF};
+
+    // The largest Envelope that fits is fragmented and reassembled.
+    const std::string LARGEST{createSerializedEnvelope(5, MAX_LENGTH - 64)};
+    REQUIRE(!LARGEST.empty());
+    REQUIRE(5 + MAX_LENGTH >= LARGEST.size());
+    auto fragments = cluon::FragmentAssembler::fragment(LARGEST, 5, 1, 65507);
+    REQUIRE(!fragments.empty());
+
+    cluon::FragmentAssembler fa;
+    const auto NOW{std::chrono::steady_clock::now()};
+    std::pair<bool, std::string> retVal;
+    for (const auto &f : fragments) {
+        retVal = fa.add(f.data(), f.size(), 1, NOW);
+    }
+    REQUIRE(retVal.first);
+    auto env = cluon::extractEnvelope(retVal.second.data(), retVal.second.size());
+    REQUIRE(env.first);
+    REQUIRE(MAX_LENGTH - 64 == env.second.serializedData().size());
+
+    // Larger Envelopes cannot be serialized.
+    REQUIRE(createSerializedEnvelope(5, MAX_LENGTH).empty());
+
+    // Larger data cannot be fragmented.
+    const std::string TOO_LARGE(5 + MAX_LENGTH + 1, 'x');
+    REQUIRE(cluon::FragmentAssembler::fragment(TOO_LARGE, 5, 1, 65507).empty());
+
+    // Fragments announcing a larger Envelope are ignored.
+    std::string f{fragments.front()};
+    constexpr std::size_t TOTAL_LENGTH_OFFSET{5 + 2 + 4 + 2 + 2};
+    const uint32_t TOTAL_LENGTH{htole32(static_cast<uint32_t>(5 + MAX_LENGTH + 1))};
+    f.replace(TOTAL_LENGTH_OFFSET, sizeof(uint32_t), reinterpret_cast<const char *>(&TOTAL_LENGTH), sizeof(uint32_t)); // NOLINT
+    cluon::FragmentAssembler fa2;
+    REQUIRE(!fa2.add(f.data(), f.size(), 1, NOW).first);
+    REQUIRE(0 == fa2.statistics().numberOfIncompleteMessages);
+}
@@ -119,6 +119,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYMESSAGE1_HPP
 #define MYMESSAGE1_HPP
@@ -173,6 +213,10 @@ class LIB_API MyMessage1 {
             m_s = v;
             return *this;
         }
+        inline MyMessage1& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -184,7 +228,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -192,16 +236,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "MyMessage1");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "MyMessage1");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -320,6 +364,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYMESSAGE1_HPP
 #define MYMESSAGE1_HPP
@@ -374,6 +458,10 @@ class LIB_API MyMessage1 {
             m_s = v;
             return *this;
         }
+        inline MyMessage1& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -385,7 +473,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -393,16 +481,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "MyMessage1");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "MyMessage1");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -499,6 +587,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYMESSAGE2_HPP
 #define MYMESSAGE2_HPP
@@ -553,6 +681,10 @@ class LIB_API MyMessage2 {
             m_s = v;
             return *this;
         }
+        inline MyMessage2& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -564,7 +696,7 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -572,16 +704,16 @@ class LIB_API MyMessage2 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage2", "MyMessage2");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage2", "MyMessage2");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -709,6 +841,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYPACKAGE_MYMESSAGE1_HPP
 #define MYPACKAGE_MYMESSAGE1_HPP
@@ -763,6 +935,10 @@ class LIB_API MyMessage1 {
             m_s = v;
             return *this;
         }
+        inline MyMessage1& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -774,7 +950,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -782,16 +958,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "MyPackage.MyMessage1");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "MyPackage.MyMessage1");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -888,6 +1064,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYPACKAGE_MYMESSAGE2_HPP
 #define MYPACKAGE_MYMESSAGE2_HPP
@@ -942,6 +1158,10 @@ class LIB_API MyMessage2 {
             m_s = v;
             return *this;
         }
+        inline MyMessage2& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -953,7 +1173,7 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -961,16 +1181,16 @@ class LIB_API MyMessage2 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage2", "MyPackage.MyMessage2");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage2", "MyPackage.MyMessage2");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -1099,6 +1319,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYPACKAGE_MYMESSAGE1_HPP
 #define MYPACKAGE_MYMESSAGE1_HPP
@@ -1153,6 +1413,10 @@ class LIB_API MyMessage1 {
             m_s = v;
             return *this;
         }
+        inline MyMessage1& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -1164,7 +1428,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -1172,16 +1436,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "MyPackage.MyMessage1");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "MyPackage.MyMessage1");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -1278,6 +1542,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYPACKAGE_MYMESSAGE2_HPP
 #define MYPACKAGE_MYMESSAGE2_HPP
@@ -1332,6 +1636,10 @@ class LIB_API MyMessage2 {
             m_s = v;
             return *this;
         }
+        inline MyMessage2& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -1343,7 +1651,7 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -1351,16 +1659,16 @@ class LIB_API MyMessage2 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage2", "MyPackage.MyMessage2");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage2", "MyPackage.MyMessage2");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -1489,6 +1797,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYPACKAGE_SUBPACKAGE_MYMESSAGE1_HPP
 #define MYPACKAGE_SUBPACKAGE_MYMESSAGE1_HPP
@@ -1543,6 +1891,10 @@ class LIB_API MyMessage1 {
             m_s = v;
             return *this;
         }
+        inline MyMessage1& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -1554,7 +1906,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -1562,16 +1914,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "MyPackage.SubPackage.MyMessage1");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "MyPackage.SubPackage.MyMessage1");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -1668,6 +2020,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYPACKAGE_SUBPACKAGE_MYMESSAGE2_HPP
 #define MYPACKAGE_SUBPACKAGE_MYMESSAGE2_HPP
@@ -1722,6 +2114,10 @@ class LIB_API MyMessage2 {
             m_s = v;
             return *this;
         }
+        inline MyMessage2& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -1733,7 +2129,7 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -1741,16 +2137,16 @@ class LIB_API MyMessage2 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage2", "MyPackage.SubPackage.MyMessage2");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage2", "MyPackage.SubPackage.MyMessage2");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -1875,6 +2271,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYPACKAGE1_MYMESSAGE1_HPP
 #define MYPACKAGE1_MYMESSAGE1_HPP
@@ -1929,6 +2365,10 @@ class LIB_API MyMessage1 {
             m_s = v;
             return *this;
         }
+        inline MyMessage1& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -1940,7 +2380,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -1948,16 +2388,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "MyPackage1.MyMessage1");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "MyPackage1.MyMessage1");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -2073,6 +2513,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYPACKAGE1_MYSUBPACKAGE_MYMESSAGE1_HPP
 #define MYPACKAGE1_MYSUBPACKAGE_MYMESSAGE1_HPP
@@ -2127,6 +2607,10 @@ class LIB_API MyMessage1 {
             m_s = v;
             return *this;
         }
+        inline MyMessage1& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -2138,7 +2622,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -2146,16 +2630,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "MyPackage1.MySubPackage.MyMessage1");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "MyPackage1.MySubPackage.MyMessage1");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -2271,6 +2755,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYPACKAGE1_MYSUBPACKAGEMESSAGE_MYMESSAGE1_HPP
 #define MYPACKAGE1_MYSUBPACKAGEMESSAGE_MYMESSAGE1_HPP
@@ -2325,6 +2849,10 @@ class LIB_API MyMessage1 {
             m_s = v;
             return *this;
         }
+        inline MyMessage1& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -2336,7 +2864,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -2344,16 +2872,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "MyPackage1.MySubPackageMessage.MyMessage1");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "MyPackage1.MySubPackageMessage.MyMessage1");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -2470,6 +2998,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYPACKAGE1_MYSUBPACKAGE_MYSUBPACKAGEMESSAGE_MYMESSAGE1_HPP
 #define MYPACKAGE1_MYSUBPACKAGE_MYSUBPACKAGEMESSAGE_MYMESSAGE1_HPP
@@ -2524,6 +3092,10 @@ class LIB_API MyMessage1 {
             m_s = v;
             return *this;
         }
+        inline MyMessage1& s(std::string &&v) noexcept {
+            m_s = std::move(v);
+            return *this;
+        }
         inline std::string s() const noexcept {
             return m_s;
         }
@@ -2535,7 +3107,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+                doVisit(1, "std::string", "s", m_s, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -2543,16 +3115,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("s"s), m_s, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "MyPackage1.MySubPackage.MySubPackageMessage.MyMessage1");
+            doVisit(1, "std::string", "s", m_s, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("s"s), m_s, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "MyPackage1.MySubPackage.MySubPackageMessage.MyMessage1");
+            doTripletForwardVisit(1, "std::string", "s", m_s, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -2673,6 +3245,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYMESSAGE1_HPP
 #define MYMESSAGE1_HPP
@@ -2769,6 +3381,10 @@ class LIB_API MyMessage1 {
             m_attribute7 = v;
             return *this;
         }
+        inline MyMessage1& attribute7(std::string &&v) noexcept {
+            m_attribute7 = std::move(v);
+            return *this;
+        }
         inline std::string attribute7() const noexcept {
             return m_attribute7;
         }
@@ -2780,31 +3396,31 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("bool"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "bool", "attribute1", m_attribute1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("char"s), std::move("attribute2"s), m_attribute2, visitor);
+                doVisit(2, "char", "attribute2", m_attribute2, visitor);
                 return;
             }
             if (3 == fieldId) {
-                doVisit(3, std::move("int32_t"s), std::move("attribute3"s), m_attribute3, visitor);
+                doVisit(3, "int32_t", "attribute3", m_attribute3, visitor);
                 return;
             }
             if (4 == fieldId) {
-                doVisit(4, std::move("uint32_t"s), std::move("attribute4"s), m_attribute4, visitor);
+                doVisit(4, "uint32_t", "attribute4", m_attribute4, visitor);
                 return;
             }
             if (5 == fieldId) {
-                doVisit(5, std::move("float"s), std::move("attribute5"s), m_attribute5, visitor);
+                doVisit(5, "float", "attribute5", m_attribute5, visitor);
                 return;
             }
             if (6 == fieldId) {
-                doVisit(6, std::move("double"s), std::move("attribute6"s), m_attribute6, visitor);
+                doVisit(6, "double", "attribute6", m_attribute6, visitor);
                 return;
             }
             if (7 == fieldId) {
-                doVisit(7, std::move("std::string"s), std::move("attribute7"s), m_attribute7, visitor);
+                doVisit(7, "std::string", "attribute7", m_attribute7, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -2812,28 +3428,28 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("bool"s), std::move("attribute1"s), m_attribute1, visitor);
-            doVisit(2, std::move("char"s), std::move("attribute2"s), m_attribute2, visitor);
-            doVisit(3, std::move("int32_t"s), std::move("attribute3"s), m_attribute3, visitor);
-            doVisit(4, std::move("uint32_t"s), std::move("attribute4"s), m_attribute4, visitor);
-            doVisit(5, std::move("float"s), std::move("attribute5"s), m_attribute5, visitor);
-            doVisit(6, std::move("double"s), std::move("attribute6"s), m_attribute6, visitor);
-            doVisit(7, std::move("std::string"s), std::move("attribute7"s), m_attribute7, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "MyMessage1");
+            doVisit(1, "bool", "attribute1", m_attribute1, visitor);
+            doVisit(2, "char", "attribute2", m_attribute2, visitor);
+            doVisit(3, "int32_t", "attribute3", m_attribute3, visitor);
+            doVisit(4, "uint32_t", "attribute4", m_attribute4, visitor);
+            doVisit(5, "float", "attribute5", m_attribute5, visitor);
+            doVisit(6, "double", "attribute6", m_attribute6, visitor);
+            doVisit(7, "std::string", "attribute7", m_attribute7, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("bool"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("char"s), std::move("attribute2"s), m_attribute2, preVisit, visit, postVisit);
-            doTripletForwardVisit(3, std::move("int32_t"s), std::move("attribute3"s), m_attribute3, preVisit, visit, postVisit);
-            doTripletForwardVisit(4, std::move("uint32_t"s), std::move("attribute4"s), m_attribute4, preVisit, visit, postVisit);
-            doTripletForwardVisit(5, std::move("float"s), std::move("attribute5"s), m_attribute5, preVisit, visit, postVisit);
-            doTripletForwardVisit(6, std::move("double"s), std::move("attribute6"s), m_attribute6, preVisit, visit, postVisit);
-            doTripletForwardVisit(7, std::move("std::string"s), std::move("attribute7"s), m_attribute7, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "MyMessage1");
+            doTripletForwardVisit(1, "bool", "attribute1", m_attribute1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "char", "attribute2", m_attribute2, preVisit, visit, postVisit);
+            doTripletForwardVisit(3, "int32_t", "attribute3", m_attribute3, preVisit, visit, postVisit);
+            doTripletForwardVisit(4, "uint32_t", "attribute4", m_attribute4, preVisit, visit, postVisit);
+            doTripletForwardVisit(5, "float", "attribute5", m_attribute5, preVisit, visit, postVisit);
+            doTripletForwardVisit(6, "double", "attribute6", m_attribute6, preVisit, visit, postVisit);
+            doTripletForwardVisit(7, "std::string", "attribute7", m_attribute7, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -2967,6 +3583,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYMESSAGE1_HPP
 #define MYMESSAGE1_HPP
@@ -3105,6 +3761,10 @@ class LIB_API MyMessage1 {
             m_attribute13 = v;
             return *this;
         }
+        inline MyMessage1& attribute13(std::string &&v) noexcept {
+            m_attribute13 = std::move(v);
+            return *this;
+        }
         inline std::string attribute13() const noexcept {
             return m_attribute13;
         }
@@ -3112,6 +3772,10 @@ class LIB_API MyMessage1 {
             m_attribute14 = v;
             return *this;
         }
+        inline MyMessage1& attribute14(std::string &&v) noexcept {
+            m_attribute14 = std::move(v);
+            return *this;
+        }
         inline std::string attribute14() const noexcept {
             return m_attribute14;
         }
@@ -3123,59 +3787,59 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("bool"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "bool", "attribute1", m_attribute1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("char"s), std::move("attribute2"s), m_attribute2, visitor);
+                doVisit(2, "char", "attribute2", m_attribute2, visitor);
                 return;
             }
             if (3 == fieldId) {
-                doVisit(3, std::move("int8_t"s), std::move("attribute3"s), m_attribute3, visitor);
+                doVisit(3, "int8_t", "attribute3", m_attribute3, visitor);
                 return;
             }
             if (4 == fieldId) {
-                doVisit(4, std::move("uint8_t"s), std::move("attribute4"s), m_attribute4, visitor);
+                doVisit(4, "uint8_t", "attribute4", m_attribute4, visitor);
                 return;
             }
             if (5 == fieldId) {
-                doVisit(5, std::move("int16_t"s), std::move("attribute5"s), m_attribute5, visitor);
+                doVisit(5, "int16_t", "attribute5", m_attribute5, visitor);
                 return;
             }
             if (6 == fieldId) {
-                doVisit(6, std::move("uint16_t"s), std::move("attribute6"s), m_attribute6, visitor);
+                doVisit(6, "uint16_t", "attribute6", m_attribute6, visitor);
                 return;
             }
             if (7 == fieldId) {
-                doVisit(7, std::move("int32_t"s), std::move("attribute7"s), m_attribute7, visitor);
+                doVisit(7, "int32_t", "attribute7", m_attribute7, visitor);
                 return;
             }
             if (8 == fieldId) {
-                doVisit(8, std::move("uint32_t"s), std::move("attribute8"s), m_attribute8, visitor);
+                doVisit(8, "uint32_t", "attribute8", m_attribute8, visitor);
                 return;
             }
             if (9 == fieldId) {
-                doVisit(9, std::move("int64_t"s), std::move("attribute9"s), m_attribute9, visitor);
+                doVisit(9, "int64_t", "attribute9", m_attribute9, visitor);
                 return;
             }
             if (10 == fieldId) {
-                doVisit(10, std::move("uint64_t"s), std::move("attribute10"s), m_attribute10, visitor);
+                doVisit(10, "uint64_t", "attribute10", m_attribute10, visitor);
                 return;
             }
             if (11 == fieldId) {
-                doVisit(11, std::move("float"s), std::move("attribute11"s), m_attribute11, visitor);
+                doVisit(11, "float", "attribute11", m_attribute11, visitor);
                 return;
             }
             if (12 == fieldId) {
-                doVisit(12, std::move("double"s), std::move("attribute12"s), m_attribute12, visitor);
+                doVisit(12, "double", "attribute12", m_attribute12, visitor);
                 return;
             }
             if (13 == fieldId) {
-                doVisit(13, std::move("std::string"s), std::move("attribute13"s), m_attribute13, visitor);
+                doVisit(13, "std::string", "attribute13", m_attribute13, visitor);
                 return;
             }
             if (14 == fieldId) {
-                doVisit(14, std::move("std::string"s), std::move("attribute14"s), m_attribute14, visitor);
+                doVisit(14, "std::string", "attribute14", m_attribute14, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -3183,42 +3847,42 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("bool"s), std::move("attribute1"s), m_attribute1, visitor);
-            doVisit(2, std::move("char"s), std::move("attribute2"s), m_attribute2, visitor);
-            doVisit(3, std::move("int8_t"s), std::move("attribute3"s), m_attribute3, visitor);
-            doVisit(4, std::move("uint8_t"s), std::move("attribute4"s), m_attribute4, visitor);
-            doVisit(5, std::move("int16_t"s), std::move("attribute5"s), m_attribute5, visitor);
-            doVisit(6, std::move("uint16_t"s), std::move("attribute6"s), m_attribute6, visitor);
-            doVisit(7, std::move("int32_t"s), std::move("attribute7"s), m_attribute7, visitor);
-            doVisit(8, std::move("uint32_t"s), std::move("attribute8"s), m_attribute8, visitor);
-            doVisit(9, std::move("int64_t"s), std::move("attribute9"s), m_attribute9, visitor);
-            doVisit(10, std::move("uint64_t"s), std::move("attribute10"s), m_attribute10, visitor);
-            doVisit(11, std::move("float"s), std::move("attribute11"s), m_attribute11, visitor);
-            doVisit(12, std::move("double"s), std::move("attribute12"s), m_attribute12, visitor);
-            doVisit(13, std::move("std::string"s), std::move("attribute13"s), m_attribute13, visitor);
-            doVisit(14, std::move("std::string"s), std::move("attribute14"s), m_attribute14, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "MyMessage1");
+            doVisit(1, "bool", "attribute1", m_attribute1, visitor);
+            doVisit(2, "char", "attribute2", m_attribute2, visitor);
+            doVisit(3, "int8_t", "attribute3", m_attribute3, visitor);
+            doVisit(4, "uint8_t", "attribute4", m_attribute4, visitor);
+            doVisit(5, "int16_t", "attribute5", m_attribute5, visitor);
+            doVisit(6, "uint16_t", "attribute6", m_attribute6, visitor);
+            doVisit(7, "int32_t", "attribute7", m_attribute7, visitor);
+            doVisit(8, "uint32_t", "attribute8", m_attribute8, visitor);
+            doVisit(9, "int64_t", "attribute9", m_attribute9, visitor);
+            doVisit(10, "uint64_t", "attribute10", m_attribute10, visitor);
+            doVisit(11, "float", "attribute11", m_attribute11, visitor);
+            doVisit(12, "double", "attribute12", m_attribute12, visitor);
+            doVisit(13, "std::string", "attribute13", m_attribute13, visitor);
+            doVisit(14, "std::string", "attribute14", m_attribute14, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("bool"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("char"s), std::move("attribute2"s), m_attribute2, preVisit, visit, postVisit);
-            doTripletForwardVisit(3, std::move("int8_t"s), std::move("attribute3"s), m_attribute3, preVisit, visit, postVisit);
-            doTripletForwardVisit(4, std::move("uint8_t"s), std::move("attribute4"s), m_attribute4, preVisit, visit, postVisit);
-            doTripletForwardVisit(5, std::move("int16_t"s), std::move("attribute5"s), m_attribute5, preVisit, visit, postVisit);
-            doTripletForwardVisit(6, std::move("uint16_t"s), std::move("attribute6"s), m_attribute6, preVisit, visit, postVisit);
-            doTripletForwardVisit(7, std::move("int32_t"s), std::move("attribute7"s), m_attribute7, preVisit, visit, postVisit);
-            doTripletForwardVisit(8, std::move("uint32_t"s), std::move("attribute8"s), m_attribute8, preVisit, visit, postVisit);
-            doTripletForwardVisit(9, std::move("int64_t"s), std::move("attribute9"s), m_attribute9, preVisit, visit, postVisit);
-            doTripletForwardVisit(10, std::move("uint64_t"s), std::move("attribute10"s), m_attribute10, preVisit, visit, postVisit);
-            doTripletForwardVisit(11, std::move("float"s), std::move("attribute11"s), m_attribute11, preVisit, visit, postVisit);
-            doTripletForwardVisit(12, std::move("double"s), std::move("attribute12"s), m_attribute12, preVisit, visit, postVisit);
-            doTripletForwardVisit(13, std::move("std::string"s), std::move("attribute13"s), m_attribute13, preVisit, visit, postVisit);
-            doTripletForwardVisit(14, std::move("std::string"s), std::move("attribute14"s), m_attribute14, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "MyMessage1");
+            doTripletForwardVisit(1, "bool", "attribute1", m_attribute1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "char", "attribute2", m_attribute2, preVisit, visit, postVisit);
+            doTripletForwardVisit(3, "int8_t", "attribute3", m_attribute3, preVisit, visit, postVisit);
+            doTripletForwardVisit(4, "uint8_t", "attribute4", m_attribute4, preVisit, visit, postVisit);
+            doTripletForwardVisit(5, "int16_t", "attribute5", m_attribute5, preVisit, visit, postVisit);
+            doTripletForwardVisit(6, "uint16_t", "attribute6", m_attribute6, preVisit, visit, postVisit);
+            doTripletForwardVisit(7, "int32_t", "attribute7", m_attribute7, preVisit, visit, postVisit);
+            doTripletForwardVisit(8, "uint32_t", "attribute8", m_attribute8, preVisit, visit, postVisit);
+            doTripletForwardVisit(9, "int64_t", "attribute9", m_attribute9, preVisit, visit, postVisit);
+            doTripletForwardVisit(10, "uint64_t", "attribute10", m_attribute10, preVisit, visit, postVisit);
+            doTripletForwardVisit(11, "float", "attribute11", m_attribute11, preVisit, visit, postVisit);
+            doTripletForwardVisit(12, "double", "attribute12", m_attribute12, preVisit, visit, postVisit);
+            doTripletForwardVisit(13, "std::string", "attribute13", m_attribute13, preVisit, visit, postVisit);
+            doTripletForwardVisit(14, "std::string", "attribute14", m_attribute14, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -3351,6 +4015,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef MYMESSAGE1_HPP
 #define MYMESSAGE1_HPP
@@ -3405,6 +4109,10 @@ class LIB_API MyMessage1 {
             m_attribute1 = v;
             return *this;
         }
+        inline MyMessage1& attribute1(std::string &&v) noexcept {
+            m_attribute1 = std::move(v);
+            return *this;
+        }
         inline std::string attribute1() const noexcept {
             return m_attribute1;
         }
@@ -3416,7 +4124,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -3424,16 +4132,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "MyMessage1");
+            doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "MyMessage1");
+            doTripletForwardVisit(1, "std::string", "attribute1", m_attribute1, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -3491,26 +4199,71 @@ void doVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&nam
 }
 #endif
 
-#ifndef TRIPLET_FORWARD_VISITABLE_TYPE_TRAIT
-#define TRIPLET_FORWARD_VISITABLE_TYPE_TRAIT
+#ifndef TRIPLET_FORWARD_VISITABLE_TYPE_TRAIT
+#define TRIPLET_FORWARD_VISITABLE_TYPE_TRAIT
+#include <cstdint>
+#include <string>
+#include <utility>
+
+template<bool b>
+struct tripletForwardVisitorSelector {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelector<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template<typename T>
+struct isTripletForwardVisitable {
+    static const bool value = false;
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
 #include <cstdint>
-#include <string>
 #include <utility>
 
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
 template<bool b>
-struct tripletForwardVisitorSelector {
+struct tripletForwardVisitorSelectorWithConstCharNames {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)preVisit;
         (void)postVisit;
-        std::forward<Visitor>(visit)(fieldIdentifier, std::move(typeName), std::move(name), value);
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
     }
 };
 
 template<>
-struct tripletForwardVisitorSelector<true> {
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
     template<typename T, class PreVisitor, class Visitor, class PostVisitor>
-    static void impl(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
         (void)fieldIdentifier;
         (void)typeName;
         (void)name;
@@ -3519,14 +4272,9 @@ struct tripletForwardVisitorSelector<true> {
     }
 };
 
-template<typename T>
-struct isTripletForwardVisitable {
-    static const bool value = false;
-};
-
 template< typename T, class PreVisitor, class Visitor, class PostVisitor>
-void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std::string &&name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
-    tripletForwardVisitorSelector<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, std::move(typeName), std::move(name), value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
 }
 #endif
 
@@ -3602,11 +4350,11 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
+                doVisit(1, "uint8_t", "field1", m_field1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("MyMessage1"s), std::move("field2"s), m_field2, visitor);
+                doVisit(2, "MyMessage1", "field2", m_field2, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -3614,18 +4362,18 @@ class LIB_API MyMessage2 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
-            doVisit(2, std::move("MyMessage1"s), std::move("field2"s), m_field2, visitor);
+            visitor.preVisit(ID(), "MyMessage2", "MyMessage2");
+            doVisit(1, "uint8_t", "field1", m_field1, visitor);
+            doVisit(2, "MyMessage1", "field2", m_field2, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("MyMessage1"s), std::move("field2"s), m_field2, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage2", "MyMessage2");
+            doTripletForwardVisit(1, "uint8_t", "field1", m_field1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "MyMessage1", "field2", m_field2, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -3754,6 +4502,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef DEF_MYMESSAGE1_HPP
 #define DEF_MYMESSAGE1_HPP
@@ -3808,6 +4596,10 @@ class LIB_API MyMessage1 {
             m_attribute1 = v;
             return *this;
         }
+        inline MyMessage1& attribute1(std::string &&v) noexcept {
+            m_attribute1 = std::move(v);
+            return *this;
+        }
         inline std::string attribute1() const noexcept {
             return m_attribute1;
         }
@@ -3819,7 +4611,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -3827,16 +4619,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "DEF.MyMessage1");
+            doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "DEF.MyMessage1");
+            doTripletForwardVisit(1, "std::string", "attribute1", m_attribute1, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -3933,6 +4725,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef DEF_MYMESSAGE2_HPP
 #define DEF_MYMESSAGE2_HPP
@@ -4005,11 +4837,11 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
+                doVisit(1, "uint8_t", "field1", m_field1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+                doVisit(2, "DEF::MyMessage1", "field2", m_field2, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -4017,18 +4849,18 @@ class LIB_API MyMessage2 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
-            doVisit(2, std::move("DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+            visitor.preVisit(ID(), "MyMessage2", "DEF.MyMessage2");
+            doVisit(1, "uint8_t", "field1", m_field1, visitor);
+            doVisit(2, "DEF::MyMessage1", "field2", m_field2, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("DEF::MyMessage1"s), std::move("field2"s), m_field2, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage2", "DEF.MyMessage2");
+            doTripletForwardVisit(1, "uint8_t", "field1", m_field1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "DEF::MyMessage1", "field2", m_field2, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -4158,6 +4990,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef DEF_MYMESSAGE1_HPP
 #define DEF_MYMESSAGE1_HPP
@@ -4212,6 +5084,10 @@ class LIB_API MyMessage1 {
             m_attribute1 = v;
             return *this;
         }
+        inline MyMessage1& attribute1(std::string &&v) noexcept {
+            m_attribute1 = std::move(v);
+            return *this;
+        }
         inline std::string attribute1() const noexcept {
             return m_attribute1;
         }
@@ -4223,7 +5099,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -4231,16 +5107,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "DEF.MyMessage1");
+            doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "DEF.MyMessage1");
+            doTripletForwardVisit(1, "std::string", "attribute1", m_attribute1, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -4337,6 +5213,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef DEF_MYMESSAGE2_HPP
 #define DEF_MYMESSAGE2_HPP
@@ -4409,11 +5325,11 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
+                doVisit(1, "uint8_t", "field1", m_field1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+                doVisit(2, "DEF::MyMessage1", "field2", m_field2, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -4421,18 +5337,18 @@ class LIB_API MyMessage2 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
-            doVisit(2, std::move("DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+            visitor.preVisit(ID(), "MyMessage2", "DEF.MyMessage2");
+            doVisit(1, "uint8_t", "field1", m_field1, visitor);
+            doVisit(2, "DEF::MyMessage1", "field2", m_field2, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("DEF::MyMessage1"s), std::move("field2"s), m_field2, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage2", "DEF.MyMessage2");
+            doTripletForwardVisit(1, "uint8_t", "field1", m_field1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "DEF::MyMessage1", "field2", m_field2, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -4563,6 +5479,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef ABC_DEF_MYMESSAGE1_HPP
 #define ABC_DEF_MYMESSAGE1_HPP
@@ -4617,6 +5573,10 @@ class LIB_API MyMessage1 {
             m_attribute1 = v;
             return *this;
         }
+        inline MyMessage1& attribute1(std::string &&v) noexcept {
+            m_attribute1 = std::move(v);
+            return *this;
+        }
         inline std::string attribute1() const noexcept {
             return m_attribute1;
         }
@@ -4628,7 +5588,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -4636,16 +5596,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "ABC.DEF.MyMessage1");
+            doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "ABC.DEF.MyMessage1");
+            doTripletForwardVisit(1, "std::string", "attribute1", m_attribute1, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -4742,6 +5702,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef ABC_DEF_MYMESSAGE2_HPP
 #define ABC_DEF_MYMESSAGE2_HPP
@@ -4814,11 +5814,11 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
+                doVisit(1, "uint8_t", "field1", m_field1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("ABC::DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+                doVisit(2, "ABC::DEF::MyMessage1", "field2", m_field2, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -4826,18 +5826,18 @@ class LIB_API MyMessage2 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
-            doVisit(2, std::move("ABC::DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+            visitor.preVisit(ID(), "MyMessage2", "ABC.DEF.MyMessage2");
+            doVisit(1, "uint8_t", "field1", m_field1, visitor);
+            doVisit(2, "ABC::DEF::MyMessage1", "field2", m_field2, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("ABC::DEF::MyMessage1"s), std::move("field2"s), m_field2, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage2", "ABC.DEF.MyMessage2");
+            doTripletForwardVisit(1, "uint8_t", "field1", m_field1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "ABC::DEF::MyMessage1", "field2", m_field2, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -4968,6 +5968,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef ABC_GHI_DEF_MYMESSAGE1_HPP
 #define ABC_GHI_DEF_MYMESSAGE1_HPP
@@ -5022,6 +6062,10 @@ class LIB_API MyMessage1 {
             m_attribute1 = v;
             return *this;
         }
+        inline MyMessage1& attribute1(std::string &&v) noexcept {
+            m_attribute1 = std::move(v);
+            return *this;
+        }
         inline std::string attribute1() const noexcept {
             return m_attribute1;
         }
@@ -5033,7 +6077,7 @@ class LIB_API MyMessage1 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+                doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -5041,16 +6085,16 @@ class LIB_API MyMessage1 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, visitor);
+            visitor.preVisit(ID(), "MyMessage1", "ABC.GHI.DEF.MyMessage1");
+            doVisit(1, "std::string", "attribute1", m_attribute1, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("std::string"s), std::move("attribute1"s), m_attribute1, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage1", "ABC.GHI.DEF.MyMessage1");
+            doTripletForwardVisit(1, "std::string", "attribute1", m_attribute1, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -5147,6 +6191,46 @@ void doTripletForwardVisit(uint32_t fieldIdentifier, std::string &&typeName, std
 }
 #endif
 
+#ifndef VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#define VISITABLE_TYPE_TRAIT_WITH_CONST_CHAR_NAMES
+#include <cstdint>
+#include <utility>
+
+// Type and field names are passed as string literals to not allocate memory per
+// visited field; visitors accepting only std::string&& receive temporaries instead.
+template<typename T, class Visitor>
+void doVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, Visitor &visitor) {
+    visitor.visit(fieldIdentifier, typeName, name, value);
+}
+
+template<bool b>
+struct tripletForwardVisitorSelectorWithConstCharNames {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)preVisit;
+        (void)postVisit;
+        std::forward<Visitor>(visit)(fieldIdentifier, typeName, name, value);
+    }
+};
+
+template<>
+struct tripletForwardVisitorSelectorWithConstCharNames<true> {
+    template<typename T, class PreVisitor, class Visitor, class PostVisitor>
+    static void impl(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+        (void)fieldIdentifier;
+        (void)typeName;
+        (void)name;
+        // Apply preVisit, visit, and postVisit on value.
+        value.accept(preVisit, visit, postVisit);
+    }
+};
+
+template< typename T, class PreVisitor, class Visitor, class PostVisitor>
+void doTripletForwardVisit(uint32_t fieldIdentifier, const char *typeName, const char *name, T &value, PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
+    tripletForwardVisitorSelectorWithConstCharNames<isTripletForwardVisitable<T>::value >::impl(fieldIdentifier, typeName, name, value, std::move(preVisit), std::move(visit), std::move(postVisit)); // NOLINT
+}
+#endif
+
 
 #ifndef ABC_GHI_DEF_MYMESSAGE2_HPP
 #define ABC_GHI_DEF_MYMESSAGE2_HPP
@@ -5219,11 +6303,11 @@ class LIB_API MyMessage2 {
             (void)visitor;
 //            visitor.preVisit(ID(), ShortName(), LongName());
             if (1 == fieldId) {
-                doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
+                doVisit(1, "uint8_t", "field1", m_field1, visitor);
                 return;
             }
             if (2 == fieldId) {
-                doVisit(2, std::move("ABC::GHI::DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+                doVisit(2, "ABC::GHI::DEF::MyMessage1", "field2", m_field2, visitor);
                 return;
             }
 //            visitor.postVisit();
@@ -5231,18 +6315,18 @@ class LIB_API MyMessage2 {
 
         template<class Visitor>
         inline void accept(Visitor &visitor) {
-            visitor.preVisit(ID(), ShortName(), LongName());
-            doVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, visitor);
-            doVisit(2, std::move("ABC::GHI::DEF::MyMessage1"s), std::move("field2"s), m_field2, visitor);
+            visitor.preVisit(ID(), "MyMessage2", "ABC.GHI.DEF.MyMessage2");
+            doVisit(1, "uint8_t", "field1", m_field1, visitor);
+            doVisit(2, "ABC::GHI::DEF::MyMessage1", "field2", m_field2, visitor);
             visitor.postVisit();
         }
 
         template<class PreVisitor, class Visitor, class PostVisitor>
         inline void accept(PreVisitor &&preVisit, Visitor &&visit, PostVisitor &&postVisit) {
             (void)visit; // Prevent warnings from empty messages.
-            std::forward<PreVisitor>(preVisit)(ID(), ShortName(), LongName());
-            doTripletForwardVisit(1, std::move("uint8_t"s), std::move("field1"s), m_field1, preVisit, visit, postVisit);
-            doTripletForwardVisit(2, std::move("ABC::GHI::DEF::MyMessage1"s), std::move("field2"s), m_field2, preVisit, visit, postVisit);
+            std::forward<PreVisitor>(preVisit)(ID(), "MyMessage2", "ABC.GHI.DEF.MyMessage2");
+            doTripletForwardVisit(1, "uint8_t", "field1", m_field1, preVisit, visit, postVisit);
+            doTripletForwardVisit(2, "ABC::GHI::DEF::MyMessage1", "field2", m_field2, preVisit, visit, postVisit);
             std::forward<PostVisitor>(postVisit)();
         }
 
@@ -5281,3 +6365,39 @@ struct isTripletForwardVisitable<ABC::GHI::DEF::MyMessage2> {
 //    std::cout << t.content() << std::endl;
     REQUIRE(t.content() == std::string(EXPECTED_HEADER2));
 }
+
+TEST_CASE("Transforming one message with generated Proto codec.") {
+    const char *input = R"(
+message MyMessage1 [id = 1] {
+    int8 a [id = 1];
+    float b [id = 2];
+    string c [id = 3];
+}
+)";
+
+    cluon::MessageParser mp;
+    auto retVal = mp.parse(std::string(input));
+    REQUIRE(cluon::MessageParser::MessageParserErrorCodes::NO_MESSAGEPARSER_ERROR == retVal.second);
+    REQUIRE(1 == retVal.first.size());
+
+    cluon::MetaMessageToCPPTransformator withoutCodec;
+    retVal.first[0].accept([&trans = withoutCodec](const cluon::MetaMessage &_mm) { trans.visit(_mm); });
+    const std::string contentWithoutCodec{withoutCodec.content()};
+    REQUIRE(std::string::npos == contentWithoutCodec.find("encodeProto"));
+    REQUIRE(std::string::npos == contentWithoutCodec.find("PROTO_CODEC_HELPERS"));
+
+    cluon::MetaMessageToCPPTransformator withCodec{true};
+    retVal.first[0].accept([&trans = withCodec](const cluon::MetaMessage &_mm) { trans.visit(_mm); });
+    const std::string contentWithCodec{withCodec.content()};
+    REQUIRE(std::string::npos != contentWithCodec.find("#define PROTO_CODEC_HELPERS"));
+    REQUIRE(std::string::npos != contentWithCodec.find("inline void encodeProto(std::string &buffer) const {"));
+    REQUIRE(std::string::npos != contentWithCodec.find("inline bool decodeProto(const char *data, std::size_t length) {"));
+    // Keys are precomputed: (fieldIdentifier << 3) | wire type.
+    REQUIRE(std::string::npos != contentWithCodec.find("protoCodec::writeVarInt(buffer, 8u);"));
+    REQUIRE(std::string::npos != contentWithCodec.find("case 21u: {"));
+    REQUIRE(std::string::npos != contentWithCodec.find("case 26u: {"));
+    REQUIRE(std::string::npos != contentWithCodec.find("m_a = static_cast<int8_t>(protoCodec::fromZigZag(static_cast<uint8_t>(value)));"));
+    // Sizes of the keys are precomputed as well.
+    REQUIRE(std::string::npos != contentWithCodec.find("inline std::size_t encodedProtoSize() const {"));
+    REQUIRE(std::string::npos != contentWithCodec.find("size += 1 + 4;"));
+}
@@ -9,6 +9,7 @@
 #include "catch.hpp"
 
 #include "cluon/FromJSONVisitor.hpp"
+#include "cluon/FromProtoVisitor.hpp"
 #include "cluon/ToJSONVisitor.hpp"
 #include "cluon/ToProtoVisitor.hpp"
 #include "cluon/cluon.hpp"
@@ -561,3 +562,41 @@ TEST_CASE("Transform Envelope into JSON represention for simple payload.") {
         REQUIRE(0x8 == env2.serializedData().at(3));
     }
 }
+
+// This message passes its names as std::string like messages generated by earlier versions of cluon-msc.
+class MessageWithNamesAsStdString {
+   public:
+    static int32_t ID() { return 9999; }
+    template <class Visitor>
+    void accept(Visitor &visitor) {
+        visitor.preVisit(ID(), std::string("MessageWithNamesAsStdString"), std::string("MessageWithNamesAsStdString"));
+        visitor.visit(1, std::string("uint8_t"), std::string("attribute1"), m_attribute1);
+        visitor.postVisit();
+    }
+
+    uint8_t m_attribute1{0};
+};
+
+TEST_CASE("Testing visitors with names passed as std::string.") {
+    testdata::MyTestMessage2 tmp;
+    tmp.attribute1(42);
+
+    MessageWithNamesAsStdString tmp2;
+    tmp2.m_attribute1 = 42;
+
+    cluon::ToJSONVisitor j;
+    tmp.accept(j);
+    cluon::ToJSONVisitor j2;
+    tmp2.accept(j2);
+    REQUIRE(j.json() == j2.json());
+
+    cluon::ToProtoVisitor protoEncoder;
+    tmp2.accept(protoEncoder);
+
+    MessageWithNamesAsStdString tmp3;
+    std::stringstream sstr{protoEncoder.encodedData()};
+    cluon::FromProtoVisitor protoDecoder;
+    protoDecoder.decodeFrom(sstr);
+    tmp3.accept(protoDecoder);
+    REQUIRE(42 == tmp3.m_attribute1);
+}
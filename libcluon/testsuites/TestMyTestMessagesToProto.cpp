@@ -372,3 +372,86 @@ TEST_CASE("Testing MyTestMessage7 with visitor to visit nested messages for seri
                   []() {});
     std::cout << buffer.str() << std::endl;
 }
+
+namespace {
+class InnerMessageWithString {
+   public:
+    std::string m_text{};
+
+    template <class Visitor>
+    void accept(uint32_t fieldId, Visitor &visitor) {
+        if (1 == fieldId) {
+            visitor.visit(1, "string", "text", m_text);
+        }
+    }
+
+    template <class Visitor>
+    void accept(Visitor &visitor) {
+        visitor.preVisit(1, "InnerMessageWithString", "InnerMessageWithString");
+        visitor.visit(1, "string", "text", m_text);
+        visitor.postVisit();
+    }
+};
+
+class OuterMessage {
+   public:
+    InnerMessageWithString m_inner{};
+    uint32_t m_value{0};
+
+    template <class Visitor>
+    void accept(uint32_t fieldId, Visitor &visitor) {
+        uint32_t id{1};
+        if (1 == fieldId) {
+            visitor.visit(id, "InnerMessageWithString", "inner", m_inner);
+        } else if (2 == fieldId) {
+            visitor.visit(2, "uint32", "value", m_value);
+        }
+    }
+
+    template <class Visitor>
+    void accept(Visitor &visitor) {
+        visitor.preVisit(2, "OuterMessage", "OuterMessage");
+        uint32_t id{1};
+        visitor.visit(id, "InnerMessageWithString", "inner", m_inner);
+        visitor.visit(2, "uint32", "value", m_value);
+        visitor.postVisit();
+    }
+};
+} // namespace
+
+TEST_CASE("Testing nested message with multi-byte length and reusing ToProtoVisitor.") {
+    OuterMessage msg;
+    msg.m_inner.m_text = std::string(200, 'A');
+    msg.m_value        = 7;
+
+    cluon::ToProtoVisitor protoEncoder;
+    msg.accept(protoEncoder);
+    std::string s = protoEncoder.encodedData();
+
+    REQUIRE(208 == s.size());
+    REQUIRE(0xa == static_cast<uint8_t>(s.at(0)));
+    REQUIRE(0xcb == static_cast<uint8_t>(s.at(1)));
+    REQUIRE(0x1 == static_cast<uint8_t>(s.at(2)));
+    REQUIRE(0xa == static_cast<uint8_t>(s.at(3)));
+    REQUIRE(0xc8 == static_cast<uint8_t>(s.at(4)));
+    REQUIRE(0x1 == static_cast<uint8_t>(s.at(5)));
+    REQUIRE(std::string(200, 'A') == s.substr(6, 200));
+    REQUIRE(0x10 == static_cast<uint8_t>(s.at(206)));
+    REQUIRE(0x7 == static_cast<uint8_t>(s.at(207)));
+
+    // Encoding the same message again after reset must not allocate new memory.
+    const char *BUFFER{protoEncoder.encodedBuffer().data()};
+    protoEncoder.reset();
+    REQUIRE(protoEncoder.encodedBuffer().empty());
+    msg.accept(protoEncoder);
+    REQUIRE(s == protoEncoder.encodedBuffer());
+    REQUIRE(BUFFER == protoEncoder.encodedBuffer().data());
+
+    std::stringstream sstr{s};
+    cluon::FromProtoVisitor protoDecoder;
+    protoDecoder.decodeFrom(sstr);
+    OuterMessage msg2;
+    msg2.accept(protoDecoder);
+    REQUIRE(std::string(200, 'A') == msg2.m_inner.m_text);
+    REQUIRE(7 == msg2.m_value);
+}
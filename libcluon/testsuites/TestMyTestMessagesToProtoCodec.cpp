@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/FromProtoVisitor.hpp"
+#include "cluon/ToProtoVisitor.hpp"
+#include "cluon/cluon.hpp"
+#include "cluon/cluonTestDataStructures.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+TEST_CASE("Testing MyTestMessage1 with generated Proto codec.") {
+    testdata::MyTestMessage1 tmp;
+    tmp.attribute1(false)
+        .attribute2('d')
+        .attribute3(-128)
+        .attribute4(255)
+        .attribute5(-32768)
+        .attribute6(65535)
+        .attribute7(-2147483647 - 1)
+        .attribute8(4294967295u)
+        .attribute9(-9223372036854775807ll - 1)
+        .attribute10(18446744073709551615ull)
+        .attribute11(-1.5f)
+        .attribute12(3.25)
+        .attribute13("Hello Codec")
+        .attribute14(std::string("\0\1\2", 3));
+
+    cluon::ToProtoVisitor protoEncoder;
+    tmp.accept(protoEncoder);
+
+    std::string s;
+    tmp.encodeProto(s);
+    REQUIRE(protoEncoder.encodedData() == s);
+    REQUIRE(s.size() == tmp.encodedProtoSize());
+
+    testdata::MyTestMessage1 tmp2;
+    REQUIRE(tmp2.decodeProto(s.data(), s.size()));
+    REQUIRE(!tmp2.attribute1());
+    REQUIRE('d' == tmp2.attribute2());
+    REQUIRE(-128 == tmp2.attribute3());
+    REQUIRE(255 == tmp2.attribute4());
+    REQUIRE(-32768 == tmp2.attribute5());
+    REQUIRE(65535 == tmp2.attribute6());
+    REQUIRE((-2147483647 - 1) == tmp2.attribute7());
+    REQUIRE(4294967295u == tmp2.attribute8());
+    REQUIRE((-9223372036854775807ll - 1) == tmp2.attribute9());
+    REQUIRE(18446744073709551615ull == tmp2.attribute10());
+    REQUIRE(-1.5f == Approx(tmp2.attribute11()));
+    REQUIRE(3.25 == Approx(tmp2.attribute12()));
+    REQUIRE("Hello Codec" == tmp2.attribute13());
+    REQUIRE(std::string("\0\1\2", 3) == tmp2.attribute14());
+
+    // The visitor-based decoder understands the bytes from the generated encoder.
+    testdata::MyTestMessage1 tmp3;
+    cluon::FromProtoVisitor protoDecoder;
+    protoDecoder.decodeFrom(s.data(), s.size(), tmp3);
+    REQUIRE(tmp2.attribute9() == tmp3.attribute9());
+    REQUIRE(tmp2.attribute13() == tmp3.attribute13());
+
+    // Fields unknown to the receiving message are skipped.
+    testdata::MyTestMessage0 tmp0;
+    REQUIRE(tmp0.decodeProto(s.data(), s.size()));
+    REQUIRE(!tmp0.attribute1());
+    REQUIRE('d' == tmp0.attribute2());
+
+    // Truncated bytes are rejected.
+    testdata::MyTestMessage1 tmp4;
+    REQUIRE(!tmp4.decodeProto(s.data(), s.size() - 1));
+}
+
+TEST_CASE("Testing MyTestMessage7 with nested messages and generated Proto codec.") {
+    testdata::MyTestMessage7 tmp7;
+    testdata::MyTestMessage2 tmp2_1;
+    testdata::MyTestMessage2 tmp2_3;
+    tmp7.attribute1(tmp2_1.attribute1(9)).attribute2(12).attribute3(tmp2_3.attribute1(13));
+
+    cluon::ToProtoVisitor protoEncoder;
+    tmp7.accept(protoEncoder);
+
+    std::string s;
+    tmp7.encodeProto(s);
+    REQUIRE(10 == s.size());
+    REQUIRE(10 == tmp7.encodedProtoSize());
+    REQUIRE(protoEncoder.encodedData() == s);
+
+    testdata::MyTestMessage7 tmp7_2;
+    REQUIRE(tmp7_2.decodeProto(s.data(), s.size()));
+    REQUIRE(9 == tmp7_2.attribute1().attribute1());
+    REQUIRE(12 == tmp7_2.attribute2());
+    REQUIRE(13 == tmp7_2.attribute3().attribute1());
+
+    // Empty messages encode to nothing.
+    testdata::MyTestMessage11 tmp11;
+    std::string empty;
+    tmp11.encodeProto(empty);
+    REQUIRE(empty.empty());
+    REQUIRE(0 == tmp11.encodedProtoSize());
+    REQUIRE(tmp11.decodeProto(empty.data(), empty.size()));
+    REQUIRE(tmp11.decodeProto(nullptr, 0));
+}
+
+template <typename T>
+static void benchmarkCodec(T &msg, const std::string &name) {
+    constexpr uint32_t ITERATIONS{200 * 1000};
+    cluon::ToProtoVisitor protoEncoder;
+    std::string buffer;
+
+    auto before = std::chrono::steady_clock::now();
+    for (uint32_t i{0}; i < ITERATIONS; i++) {
+        protoEncoder.reset();
+        msg.accept(protoEncoder);
+    }
+    auto after = std::chrono::steady_clock::now();
+    const auto DURATION_ENCODE_VISITOR{std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count()};
+
+    before = std::chrono::steady_clock::now();
+    for (uint32_t i{0}; i < ITERATIONS; i++) {
+        buffer.clear();
+        msg.encodeProto(buffer);
+    }
+    after = std::chrono::steady_clock::now();
+    const auto DURATION_ENCODE_CODEC{std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count()};
+    REQUIRE(protoEncoder.encodedBuffer() == buffer);
+
+    cluon::FromProtoVisitor protoDecoder;
+    before = std::chrono::steady_clock::now();
+    for (uint32_t i{0}; i < ITERATIONS; i++) {
+        T decoded;
+        protoDecoder.decodeFrom(buffer.data(), buffer.size(), decoded);
+    }
+    after = std::chrono::steady_clock::now();
+    const auto DURATION_DECODE_VISITOR{std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count()};
+
+    bool decodedAll{true};
+    before = std::chrono::steady_clock::now();
+    for (uint32_t i{0}; i < ITERATIONS; i++) {
+        T decoded;
+        decodedAll &= decoded.decodeProto(buffer.data(), buffer.size());
+    }
+    after = std::chrono::steady_clock::now();
+    const auto DURATION_DECODE_CODEC{std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count()};
+    REQUIRE(decodedAll);
+
+    std::cout << name << " (" << buffer.size() << " bytes): encoding took " << (DURATION_ENCODE_VISITOR / ITERATIONS) << " ns via visitor and "
+              << (DURATION_ENCODE_CODEC / ITERATIONS) << " ns via generated codec; decoding took " << (DURATION_DECODE_VISITOR / ITERATIONS)
+              << " ns via visitor and " << (DURATION_DECODE_CODEC / ITERATIONS) << " ns via generated codec." << std::endl;
+}
+
+TEST_CASE("Benchmark encoding and decoding test data structures via visitor and generated Proto codec.", "[.benchmark]") {
+    testdata::MyTestMessage1 tmp1;
+    benchmarkCodec(tmp1, "testdata::MyTestMessage1");
+
+    testdata::MyTestMessage2 tmp2;
+    benchmarkCodec(tmp2, "testdata::MyTestMessage2");
+
+    testdata::MyTestMessage5 tmp5;
+    benchmarkCodec(tmp5, "testdata::MyTestMessage5");
+
+    testdata::MyTestMessage7 tmp7;
+    benchmarkCodec(tmp7, "testdata::MyTestMessage7");
+
+    testdata::MyTestMessage9 tmp9;
+    benchmarkCodec(tmp9, "testdata::MyTestMessage9");
+}
@@ -11,8 +11,10 @@
 #include "cluon/FromProtoVisitor.hpp"
 #include "cluon/ToProtoVisitor.hpp"
 #include "cluon/cluon.hpp"
+#include "cluon/cluonDataStructures.hpp"
 #include "cluon/cluonTestDataStructures.hpp"
 
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -361,3 +363,150 @@ TEST_CASE("Testing MyTestMessage7 with visitor to visit nested messages for seri
                   []() {});
     std::cout << buffer.str() << std::endl;
 }
+
+TEST_CASE("Testing MyTestMessage7 decoded directly from memory.") {
+    testdata::MyTestMessage7 tmp7;
+    testdata::MyTestMessage2 tmp2_1;
+    tmp7.attribute1(tmp2_1.attribute1(9));
+    tmp7.attribute2(300);
+    testdata::MyTestMessage2 tmp2_3;
+    tmp7.attribute3(tmp2_3.attribute1(13));
+
+    cluon::ToProtoVisitor protoEncoder;
+    tmp7.accept(protoEncoder);
+    const std::string s{protoEncoder.encodedData()};
+
+    testdata::MyTestMessage7 tmp7_2;
+    cluon::FromProtoVisitor protoDecoder;
+    protoDecoder.decodeFrom(s.data(), s.size(), tmp7_2);
+    REQUIRE(9 == tmp7_2.attribute1().attribute1());
+    REQUIRE(300 == tmp7_2.attribute2());
+    REQUIRE(13 == tmp7_2.attribute3().attribute1());
+
+    // Decoding via the map of key/values must yield the same result.
+    testdata::MyTestMessage7 tmp7_3;
+    protoDecoder.decodeFrom(s.data(), s.size());
+    tmp7_3.accept(protoDecoder);
+    REQUIRE(9 == tmp7_3.attribute1().attribute1());
+    REQUIRE(300 == tmp7_3.attribute2());
+    REQUIRE(13 == tmp7_3.attribute3().attribute1());
+
+    // Truncated data: only the complete fields are decoded.
+    testdata::MyTestMessage7 tmp7_4;
+    protoDecoder.decodeFrom(s.data(), 5, tmp7_4);
+    REQUIRE(9 == tmp7_4.attribute1().attribute1());
+    REQUIRE(12345 == tmp7_4.attribute2());
+    REQUIRE(123 == tmp7_4.attribute3().attribute1());
+
+    testdata::MyTestMessage7 tmp7_5;
+    protoDecoder.decodeFrom(nullptr, 0, tmp7_5);
+    REQUIRE(12345 == tmp7_5.attribute2());
+}
+
+TEST_CASE("Testing MyTestMessage5 decoded directly from memory.") {
+    testdata::MyTestMessage5 tmp5;
+    tmp5.attribute1(3).attribute2(-3).attribute3(103).attribute4(-103).attribute5(10003).attribute6(-10003).attribute7(54321).attribute8(-54321).attribute9(-5.4321f).attribute10(-50.4321).attribute11("Hello cluon World!");
+
+    cluon::ToProtoVisitor protoEncoder;
+    tmp5.accept(protoEncoder);
+    const std::string s{protoEncoder.encodedData()};
+
+    testdata::MyTestMessage5 tmp5_2;
+    cluon::FromProtoVisitor protoDecoder;
+    protoDecoder.decodeFrom(s.data(), s.size(), tmp5_2);
+    REQUIRE(3 == tmp5_2.attribute1());
+    REQUIRE(-3 == tmp5_2.attribute2());
+    REQUIRE(103 == tmp5_2.attribute3());
+    REQUIRE(-103 == tmp5_2.attribute4());
+    REQUIRE(10003 == tmp5_2.attribute5());
+    REQUIRE(-10003 == tmp5_2.attribute6());
+    REQUIRE(54321 == tmp5_2.attribute7());
+    REQUIRE(-54321 == tmp5_2.attribute8());
+    REQUIRE(-5.4321f == Approx(tmp5_2.attribute9()));
+    REQUIRE(-50.4321 == Approx(tmp5_2.attribute10()));
+    REQUIRE("Hello cluon World!" == tmp5_2.attribute11());
+}
+
+template <typename T>
+static void benchmarkDecoding(T &msg, const std::string &name) {
+    constexpr uint32_t ITERATIONS{200 * 1000};
+    cluon::ToProtoVisitor protoEncoder;
+    msg.accept(protoEncoder);
+    const std::string DATA{protoEncoder.encodedData()};
+
+    cluon::FromProtoVisitor protoDecoder;
+    auto before = std::chrono::steady_clock::now();
+    for (uint32_t i{0}; i < ITERATIONS; i++) {
+        T decoded;
+        protoDecoder.decodeFrom(DATA.data(), DATA.size());
+        decoded.accept(protoDecoder);
+    }
+    auto after = std::chrono::steady_clock::now();
+    const auto DURATION_MAP{std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count()};
+
+    before = std::chrono::steady_clock::now();
+    for (uint32_t i{0}; i < ITERATIONS; i++) {
+        T decoded;
+        protoDecoder.decodeFrom(DATA.data(), DATA.size(), decoded);
+    }
+    after = std::chrono::steady_clock::now();
+    const auto DURATION_DIRECT{std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count()};
+
+    std::cout << "Decoding " << name << " (" << DATA.size() << " bytes) took " << (DURATION_MAP / ITERATIONS) << " ns via key/value map and "
+              << (DURATION_DIRECT / ITERATIONS) << " ns via direct injection." << std::endl;
+    REQUIRE(0 < DURATION_DIRECT);
+}
+
+TEST_CASE("Benchmark decoding cluon data structures via key/value map and direct injection.", "[.benchmark]") {
+    cluon::data::TimeStamp ts;
+    ts.seconds(1234567).microseconds(890123);
+    benchmarkDecoding(ts, "cluon::data::TimeStamp");
+
+    cluon::data::Envelope env;
+    env.dataType(1234).serializedData(std::string(128, 'A')).sent(ts).received(ts).sampleTimeStamp(ts).senderStamp(7);
+    benchmarkDecoding(env, "cluon::data::Envelope");
+
+    cluon::data::PlayerCommand playerCommand;
+    playerCommand.command(3).seekTo(0.5f);
+    benchmarkDecoding(playerCommand, "cluon::data::PlayerCommand");
+
+    cluon::data::PlayerStatus playerStatus;
+    playerStatus.state(2).numberOfEntries(100000).currentEntryForPlayback(5000);
+    benchmarkDecoding(playerStatus, "cluon::data::PlayerStatus");
+
+    cluon::data::RecorderCommand recorderCommand;
+    recorderCommand.command(1);
+    benchmarkDecoding(recorderCommand, "cluon::data::RecorderCommand");
+}
+
+TEST_CASE("Testing MyTestMessage5 decoded directly from memory with mismatching wire types.") {
+    // Each field is encoded with a wire type that does not match its declared type except attribute2.
+    const std::string s{"\x0A\x01x"                         // attribute1 (uint8) as length-delimited.
+                        "\x48\x05"                          // attribute9 (float) as VarInt.
+                        "\x55\x01\x02\x03\x04"              // attribute10 (double) as four bytes.
+                        "\x58\xE8\x07"                      // attribute11 (string) as VarInt of 1000.
+                        "\x39\x01\x02\x03\x04\x05\x06\x07\x08" // attribute7 (uint64) as eight bytes.
+                        "\x10\x05",                         // attribute2 (int8) as VarInt of -3.
+                        24};
+
+    testdata::MyTestMessage5 tmp5;
+    cluon::FromProtoVisitor protoDecoder;
+    protoDecoder.decodeFrom(s.data(), s.size(), tmp5);
+    REQUIRE(1 == tmp5.attribute1());
+    REQUIRE(-3 == tmp5.attribute2());
+    REQUIRE(12345 == tmp5.attribute7());
+    REQUIRE(-1.2345f == Approx(tmp5.attribute9()));
+    REQUIRE(-10.2345 == Approx(tmp5.attribute10()));
+    REQUIRE("Hello World!" == tmp5.attribute11());
+
+    // A nested message encoded as VarInt after a length-delimited field must not be decoded.
+    const std::string s7{"\x1A\x02\x08\x07" // attribute3 with attribute1 = 7.
+                         "\x08\xE8\x07"     // attribute1 as VarInt of 1000.
+                         "\x10\x05",         // attribute2 = 5.
+                         9};
+    testdata::MyTestMessage7 tmp7;
+    protoDecoder.decodeFrom(s7.data(), s7.size(), tmp7);
+    REQUIRE(123 == tmp7.attribute1().attribute1());
+    REQUIRE(5 == tmp7.attribute2());
+    REQUIRE(7 == tmp7.attribute3().attribute1());
+}
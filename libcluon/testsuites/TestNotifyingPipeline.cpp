@@ -12,9 +12,14 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 TEST_CASE("Creating a NotifyingPipeline and stop immediately.") {
     cluon::NotifyingPipeline<std::string> pipeline(nullptr);
@@ -47,3 +52,432 @@ TEST_CASE("Creating a NotifyingPipeline, add one entry, and get notified.") {
         REQUIRE("Hello World" == data);
     } catch (...) { REQUIRE(false); } // LCOV_EXCL_LINE
 }
+
+TEST_CASE("Creating a NotifyingPipeline with SPSC ring buffer and stop immediately.") {
+    cluon::NotifyingPipeline<std::string> pipeline(nullptr, cluon::NotifyingPipelineBackend::SPSC_RING, 16);
+    REQUIRE(pipeline.isRunning());
+}
+
+TEST_CASE("Creating a NotifyingPipeline with SPSC ring buffer, add one entry, and get notified.") {
+    std::atomic<bool> hasDataReceived{false};
+    std::string data;
+
+    try {
+        cluon::NotifyingPipeline<std::string> pipeline(
+            [&hasDataReceived, &data](std::string &&entry) {
+                data = entry;
+                hasDataReceived.store(true);
+            },
+            cluon::NotifyingPipelineBackend::SPSC_RING,
+            16);
+        REQUIRE(pipeline.isRunning());
+        REQUIRE(!hasDataReceived);
+        REQUIRE(data.empty());
+
+        std::string dataToSend("Hello World");
+        pipeline.add(std::move(dataToSend));
+
+        REQUIRE(!hasDataReceived);
+        pipeline.notifyAll();
+
+        using namespace std::literals::chrono_literals; // NOLINT
+        do { std::this_thread::sleep_for(1ms); } while (!hasDataReceived.load());
+
+        REQUIRE("Hello World" == data);
+    } catch (...) { REQUIRE(false); } // LCOV_EXCL_LINE
+}
+
+TEST_CASE("Creating a NotifyingPipeline with small SPSC ring buffer and add more entries than slots.") {
+    constexpr uint32_t ENTRIES{10000};
+    std::atomic<uint32_t> numberOfEntries{0};
+    std::atomic<bool> inOrder{true};
+
+    try {
+        cluon::NotifyingPipeline<uint32_t> pipeline(
+            [&numberOfEntries, &inOrder](uint32_t &&entry) {
+                if (entry != numberOfEntries.load()) {
+                    inOrder.store(false);
+                }
+                numberOfEntries++;
+            },
+            cluon::NotifyingPipelineBackend::SPSC_RING,
+            3);
+        REQUIRE(pipeline.isRunning());
+
+        for (uint32_t i{0}; i < ENTRIES; i++) {
+            uint32_t entry{i};
+            pipeline.add(std::move(entry));
+            if (0 == (i % 100)) {
+                pipeline.notifyAll();
+            }
+        }
+        pipeline.notifyAll();
+
+        using namespace std::literals::chrono_literals; // NOLINT
+        do { std::this_thread::sleep_for(1ms); } while (ENTRIES > numberOfEntries.load());
+
+        REQUIRE(ENTRIES == numberOfEntries);
+        REQUIRE(inOrder);
+    } catch (...) { REQUIRE(false); } // LCOV_EXCL_LINE
+}
+
+TEST_CASE("Benchmark NotifyingPipeline with deque and SPSC ring buffer.", "[.benchmark]") {
+    constexpr uint64_t ENTRIES{500000};
+    constexpr uint32_t BATCH{64};
+    constexpr uint32_t ROUNDTRIPS{2000};
+
+    for (auto backend : {cluon::NotifyingPipelineBackend::DEQUE, cluon::NotifyingPipelineBackend::SPSC_RING}) {
+        const std::string NAME{(cluon::NotifyingPipelineBackend::DEQUE == backend) ? "deque" : "SPSC ring"};
+        using namespace std::literals::chrono_literals; // NOLINT
+
+        // Throughput: Add entries in batches and wake the consumer once per batch.
+        {
+            std::atomic<uint64_t> numberOfEntries{0};
+            cluon::NotifyingPipeline<uint64_t> pipeline([&numberOfEntries](uint64_t &&) { numberOfEntries++; }, backend, 4096);
+            REQUIRE(pipeline.isRunning());
+
+            auto start = std::chrono::steady_clock::now();
+            for (uint64_t i{0}; i < ENTRIES; i++) {
+                uint64_t entry{i};
+                pipeline.add(std::move(entry));
+                if (0 == (i % BATCH)) {
+                    pipeline.notifyAll();
+                }
+            }
+            pipeline.notifyAll();
+            while (ENTRIES > numberOfEntries.load()) { std::this_thread::yield(); }
+            auto stop = std::chrono::steady_clock::now();
+
+            const double DURATION{std::chrono::duration<double>(stop - start).count()};
+            std::cout << "[NotifyingPipeline, " << NAME << "]: " << static_cast<uint64_t>(static_cast<double>(ENTRIES) / DURATION)
+                      << " entries/s" << std::endl;
+            REQUIRE(ENTRIES == numberOfEntries);
+        }
+
+        // Throughput with a batch delegate.
+        {
+            std::atomic<uint64_t> numberOfEntries{0};
+            cluon::NotifyingPipeline<uint64_t> pipeline(
+                [&numberOfEntries](std::vector<uint64_t> &&entries) { numberOfEntries += entries.size(); }, backend, 4096);
+            REQUIRE(pipeline.isRunning());
+
+            auto start = std::chrono::steady_clock::now();
+            for (uint64_t i{0}; i < ENTRIES; i++) {
+                uint64_t entry{i};
+                pipeline.add(std::move(entry));
+                if (0 == (i % BATCH)) {
+                    pipeline.notifyAll();
+                }
+            }
+            pipeline.notifyAll();
+            while (ENTRIES > numberOfEntries.load()) { std::this_thread::yield(); }
+            auto stop = std::chrono::steady_clock::now();
+
+            const double DURATION{std::chrono::duration<double>(stop - start).count()};
+            std::cout << "[NotifyingPipeline, " << NAME << ", batch delegate]: "
+                      << static_cast<uint64_t>(static_cast<double>(ENTRIES) / DURATION) << " entries/s" << std::endl;
+            REQUIRE(ENTRIES == numberOfEntries);
+        }
+
+        // Latency: Add one entry, wake the consumer, and wait for its acknowledgement.
+        {
+            std::atomic<uint32_t> acknowledged{0};
+            cluon::NotifyingPipeline<uint32_t> pipeline([&acknowledged](uint32_t &&) { acknowledged++; }, backend, 4096);
+            REQUIRE(pipeline.isRunning());
+
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i{0}; i < ROUNDTRIPS; i++) {
+                uint32_t entry{i};
+                pipeline.add(std::move(entry));
+                pipeline.notifyAll();
+                while (i >= acknowledged.load()) { std::this_thread::yield(); }
+            }
+            auto stop = std::chrono::steady_clock::now();
+
+            const double DURATION{std::chrono::duration<double, std::micro>(stop - start).count()};
+            std::cout << "[NotifyingPipeline, " << NAME << "]: " << DURATION / ROUNDTRIPS << " us per round trip" << std::endl;
+            REQUIRE(ROUNDTRIPS == acknowledged);
+        }
+    }
+}
+
+TEST_CASE("Bounded NotifyingPipeline applies overflow policies.") {
+    for (auto backend : {cluon::NotifyingPipelineBackend::DEQUE, cluon::NotifyingPipelineBackend::SPSC_RING}) {
+        std::mutex blockMutex;
+        std::atomic<bool> consumerIsBlocked{false};
+        std::atomic<uint32_t> lastEntry{0};
+        std::atomic<uint32_t> numberOfEntries{0};
+
+        try {
+            // Keep the consumer busy with the first entry until the pipeline is filled.
+            std::unique_lock<std::mutex> block(blockMutex);
+            cluon::NotifyingPipeline<uint32_t> pipeline(
+                [&blockMutex, &consumerIsBlocked, &lastEntry, &numberOfEntries](uint32_t &&entry) {
+                    if (0 == entry) {
+                        consumerIsBlocked.store(true);
+                        std::lock_guard<std::mutex> lck(blockMutex);
+                    }
+                    lastEntry.store(entry);
+                    numberOfEntries++;
+                },
+                backend,
+                4,
+                cluon::NotifyingPipelineOverflowPolicy::DROP_NEWEST);
+            REQUIRE(pipeline.isRunning());
+
+            using namespace std::literals::chrono_literals; // NOLINT
+            {
+                uint32_t entry{0};
+                pipeline.add(std::move(entry));
+                pipeline.notifyAll();
+            }
+            do { std::this_thread::sleep_for(1ms); } while (!consumerIsBlocked.load());
+
+            // The consumer is now blocked while processing entry 0; fill all four slots.
+            for (uint32_t i{1}; i < 7; i++) {
+                uint32_t entry{i};
+                pipeline.add(std::move(entry));
+            }
+            auto stats = pipeline.statistics();
+            REQUIRE(5 == stats.numberOfQueuedEntries);
+            REQUIRE(2 == stats.numberOfDroppedEntries);
+            REQUIRE(4 == stats.highWaterMark);
+
+            // Latest wins: 5 and 6 replace 1 and 2.
+            pipeline.setOverflowPolicy(cluon::NotifyingPipelineOverflowPolicy::DROP_OLDEST);
+            for (uint32_t i{7}; i < 9; i++) {
+                uint32_t entry{i};
+                pipeline.add(std::move(entry));
+            }
+            stats = pipeline.statistics();
+            REQUIRE(7 == stats.numberOfQueuedEntries);
+            REQUIRE(4 == stats.numberOfDroppedEntries);
+            REQUIRE(4 == stats.highWaterMark);
+
+            block.unlock();
+            pipeline.notifyAll();
+            do { std::this_thread::sleep_for(1ms); } while (5 > numberOfEntries.load());
+
+            REQUIRE(5 == numberOfEntries);
+            REQUIRE(8 == lastEntry);
+        } catch (...) { REQUIRE(false); } // LCOV_EXCL_LINE
+    }
+}
+
+TEST_CASE("Bounded NotifyingPipeline blocks producer.") {
+    for (auto backend : {cluon::NotifyingPipelineBackend::DEQUE, cluon::NotifyingPipelineBackend::SPSC_RING}) {
+        constexpr uint32_t ENTRIES{1000};
+        std::atomic<uint32_t> numberOfEntries{0};
+
+        try {
+            cluon::NotifyingPipeline<uint32_t> pipeline(
+                [&numberOfEntries](uint32_t &&) {
+                    using namespace std::literals::chrono_literals; // NOLINT
+                    if (0 == (numberOfEntries.load() % 100)) {
+                        std::this_thread::sleep_for(1ms);
+                    }
+                    numberOfEntries++;
+                },
+                backend,
+                8,
+                cluon::NotifyingPipelineOverflowPolicy::BLOCK);
+            REQUIRE(pipeline.isRunning());
+
+            // add() is called without notifyAll() in between; a full pipeline must wake the consumer itself.
+            for (uint32_t i{0}; i < ENTRIES; i++) {
+                uint32_t entry{i};
+                pipeline.add(std::move(entry));
+            }
+            pipeline.notifyAll();
+
+            using namespace std::literals::chrono_literals; // NOLINT
+            do { std::this_thread::sleep_for(1ms); } while (ENTRIES > numberOfEntries.load());
+
+            auto stats = pipeline.statistics();
+            REQUIRE(ENTRIES == numberOfEntries);
+            REQUIRE(ENTRIES == stats.numberOfQueuedEntries);
+            REQUIRE(0 == stats.numberOfDroppedEntries);
+            REQUIRE(8 == stats.highWaterMark);
+        } catch (...) { REQUIRE(false); } // LCOV_EXCL_LINE
+    }
+}
+
+TEST_CASE("Bounded NotifyingPipeline with SPSC ring buffer does not spin while blocking producer.") {
+    constexpr uint32_t ENTRIES{12};
+    std::atomic<uint32_t> numberOfEntries{0};
+
+    try {
+        cluon::NotifyingPipeline<uint32_t> pipeline(
+            [&numberOfEntries](uint32_t &&) {
+                using namespace std::literals::chrono_literals; // NOLINT
+                std::this_thread::sleep_for(25ms);
+                numberOfEntries++;
+            },
+            cluon::NotifyingPipelineBackend::SPSC_RING,
+            4,
+            cluon::NotifyingPipelineOverflowPolicy::BLOCK);
+        REQUIRE(pipeline.isRunning());
+
+        // The producer is blocked for most of the time; thus, hardly any CPU time must be used.
+        const std::clock_t BEFORE{std::clock()};
+        for (uint32_t i{0}; i < ENTRIES; i++) {
+            uint32_t entry{i};
+            pipeline.add(std::move(entry));
+        }
+        pipeline.notifyAll();
+        const std::clock_t AFTER{std::clock()};
+
+        using namespace std::literals::chrono_literals; // NOLINT
+        do { std::this_thread::sleep_for(1ms); } while (ENTRIES > numberOfEntries.load());
+
+        const double CPU_TIME_IN_MS{1000.0 * static_cast<double>(AFTER - BEFORE) / CLOCKS_PER_SEC};
+        std::cout << "Producer used " << CPU_TIME_IN_MS << " ms CPU time while blocked." << std::endl;
+        REQUIRE(ENTRIES == numberOfEntries);
+        REQUIRE(0 == pipeline.statistics().numberOfDroppedEntries);
+        REQUIRE(50.0 > CPU_TIME_IN_MS);
+    } catch (...) { REQUIRE(false); } // LCOV_EXCL_LINE
+}
+
+TEST_CASE("Stopping a bounded NotifyingPipeline wakes a blocked producer.") {
+    for (auto backend : {cluon::NotifyingPipelineBackend::DEQUE, cluon::NotifyingPipelineBackend::SPSC_RING}) {
+        std::atomic<bool> isDelegateBlocked{true};
+        std::atomic<bool> hasProducerReturned{false};
+
+        try {
+            cluon::NotifyingPipeline<uint32_t> pipeline(
+                [&isDelegateBlocked](uint32_t &&) {
+                    using namespace std::literals::chrono_literals; // NOLINT
+                    while (isDelegateBlocked.load()) { std::this_thread::sleep_for(1ms); }
+                },
+                backend,
+                4,
+                cluon::NotifyingPipelineOverflowPolicy::BLOCK);
+            REQUIRE(pipeline.isRunning());
+
+            // The producer blocks as the consumer does not free any slot.
+            std::thread producer([&pipeline, &hasProducerReturned]() noexcept {
+                for (uint32_t i{0}; i < 16; i++) {
+                    uint32_t entry{i};
+                    pipeline.add(std::move(entry));
+                    pipeline.notifyAll();
+                }
+                hasProducerReturned.store(true);
+            });
+
+            using namespace std::literals::chrono_literals; // NOLINT
+            std::this_thread::sleep_for(100ms);
+            const bool HAS_PRODUCER_RETURNED_BEFORE_STOP{hasProducerReturned.load()};
+
+            pipeline.stop();
+            producer.join();
+            isDelegateBlocked.store(false);
+
+            REQUIRE(!HAS_PRODUCER_RETURNED_BEFORE_STOP);
+            REQUIRE(hasProducerReturned.load());
+            REQUIRE(!pipeline.isRunning());
+        } catch (...) { REQUIRE(false); } // LCOV_EXCL_LINE
+    }
+}
+
+namespace {
+// Entry that can neither be default constructed nor be assigned.
+class MoveOnlyEntry {
+   public:
+    MoveOnlyEntry()                      = delete;
+    MoveOnlyEntry(const MoveOnlyEntry &) = delete;
+    MoveOnlyEntry &operator=(const MoveOnlyEntry &) = delete;
+    MoveOnlyEntry &operator=(MoveOnlyEntry &&) = delete;
+    MoveOnlyEntry(MoveOnlyEntry &&)            = default;
+    ~MoveOnlyEntry()                           = default;
+
+    MoveOnlyEntry(uint32_t value, std::shared_ptr<uint32_t> resource)
+        : m_value(value)
+        , m_resource(std::move(resource)) {}
+
+    uint32_t m_value;
+    std::shared_ptr<uint32_t> m_resource;
+};
+} // namespace
+
+TEST_CASE("NotifyingPipeline with entries that are neither default constructible nor assignable.") {
+    for (auto backend : {cluon::NotifyingPipelineBackend::DEQUE, cluon::NotifyingPipelineBackend::SPSC_RING}) {
+        constexpr uint32_t ENTRIES{100};
+        auto resource = std::make_shared<uint32_t>(0);
+        std::atomic<uint32_t> sum{0};
+        std::atomic<bool> isDelegateBlocked{false};
+
+        {
+            cluon::NotifyingPipeline<MoveOnlyEntry> pipeline(
+                [&sum, &isDelegateBlocked](MoveOnlyEntry &&entry) {
+                    using namespace std::literals::chrono_literals; // NOLINT
+                    while (isDelegateBlocked.load()) { std::this_thread::sleep_for(1ms); }
+                    sum += entry.m_value;
+                },
+                backend,
+                8,
+                cluon::NotifyingPipelineOverflowPolicy::BLOCK);
+            REQUIRE(pipeline.isRunning());
+
+            for (uint32_t i{1}; i <= ENTRIES; i++) {
+                pipeline.add(MoveOnlyEntry(i, resource));
+            }
+            pipeline.notifyAll();
+
+            using namespace std::literals::chrono_literals; // NOLINT
+            do { std::this_thread::sleep_for(1ms); } while (ENTRIES * (ENTRIES + 1) / 2 > sum.load());
+            REQUIRE(ENTRIES * (ENTRIES + 1) / 2 == sum.load());
+
+            // Discarded entries and entries that are still waiting at the end are destroyed.
+            isDelegateBlocked.store(true);
+            pipeline.setOverflowPolicy(cluon::NotifyingPipelineOverflowPolicy::DROP_OLDEST);
+            for (uint32_t i{0}; i < 3 * 8; i++) {
+                pipeline.add(MoveOnlyEntry(0, resource));
+            }
+            pipeline.notifyAll();
+            REQUIRE(0 < pipeline.statistics().numberOfDroppedEntries);
+
+            pipeline.stop();
+            isDelegateBlocked.store(false);
+        }
+        REQUIRE(1 == resource.use_count());
+    }
+}
+
+TEST_CASE("Creating a NotifyingPipeline with batch delegate.") {
+    for (auto backend : {cluon::NotifyingPipelineBackend::DEQUE, cluon::NotifyingPipelineBackend::SPSC_RING}) {
+        constexpr uint32_t ENTRIES{100};
+        std::atomic<uint32_t> numberOfEntries{0};
+        std::atomic<uint32_t> numberOfBatches{0};
+        std::atomic<bool> inOrder{true};
+
+        try {
+            cluon::NotifyingPipeline<uint32_t> pipeline(
+                [&numberOfEntries, &numberOfBatches, &inOrder](std::vector<uint32_t> &&entries) {
+                    for (auto entry : entries) {
+                        if (entry != numberOfEntries.load()) {
+                            inOrder.store(false);
+                        }
+                        numberOfEntries++;
+                    }
+                    numberOfBatches++;
+                },
+                backend,
+                128);
+            REQUIRE(pipeline.isRunning());
+
+            for (uint32_t i{0}; i < ENTRIES; i++) {
+                uint32_t entry{i};
+                pipeline.add(std::move(entry));
+            }
+            REQUIRE(0 == numberOfBatches);
+            pipeline.notifyAll();
+
+            using namespace std::literals::chrono_literals; // NOLINT
+            do { std::this_thread::sleep_for(1ms); } while (ENTRIES > numberOfEntries.load());
+
+            REQUIRE(ENTRIES == numberOfEntries);
+            REQUIRE(1 == numberOfBatches);
+            REQUIRE(inOrder);
+        } catch (...) { REQUIRE(false); } // LCOV_EXCL_LINE
+    }
+}
@@ -13,6 +13,7 @@
 #include "cluon/OD4Session.hpp"
 #include "cluon/Time.hpp"
 #include "cluon/cluonDataStructures.hpp"
+#include "cluon/cluonTestDataStructures.hpp"
 
 #include <iostream>
 
@@ -20,6 +21,7 @@
 #include <chrono>
 #include <mutex>
 #include <sstream>
+#include <stdexcept>
 #include <thread>
 #include <vector>
 
@@ -499,3 +501,300 @@ TEST_CASE("Create OD4 session with dataTrigger and transmission storm from 5 thr
 #endif
 #endif
 }
+
+TEST_CASE("Create OD4 session with workers where a slow delegate does not block other dataTypes.") {
+    std::mutex slowDelegateMutex;
+    std::atomic<bool> timeStampReceived{false};
+    std::atomic<bool> playerCommandReceived{false};
+
+    cluon::OD4Session od4(90, nullptr, 2);
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+    REQUIRE(od4.isRunning());
+    REQUIRE(2 == od4.workerStatistics().size());
+
+    // TimeStamp (12) and PlayerCommand (9) are handled by different workers.
+    std::unique_lock<std::mutex> block(slowDelegateMutex);
+    REQUIRE(od4.dataTrigger(cluon::data::TimeStamp::ID(), [&slowDelegateMutex, &timeStampReceived](cluon::data::Envelope &&) {
+        timeStampReceived = true;
+        std::lock_guard<std::mutex> lck(slowDelegateMutex);
+    }));
+    REQUIRE(od4.dataTrigger(cluon::data::PlayerCommand::ID(),
+                            [&playerCommandReceived](cluon::data::Envelope &&) { playerCommandReceived = true; }));
+
+    cluon::OD4Session od4ToSendFrom(90);
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+    REQUIRE(od4ToSendFrom.isRunning());
+
+    cluon::data::TimeStamp ts;
+    od4ToSendFrom.send(ts);
+    do { std::this_thread::sleep_for(1ms); } while (!timeStampReceived);
+
+    // The TimeStamp delegate is still blocked.
+    cluon::data::PlayerCommand pc;
+    od4ToSendFrom.send(pc);
+    do { std::this_thread::sleep_for(1ms); } while (!playerCommandReceived);
+    block.unlock();
+
+    std::vector<cluon::OD4Session::WorkerStatistics> stats;
+    do {
+        std::this_thread::sleep_for(1ms);
+        stats = od4.workerStatistics();
+    } while ((1 > stats[0].numberOfProcessedEnvelopes) || (1 > stats[1].numberOfProcessedEnvelopes));
+    for (auto s : stats) {
+        REQUIRE(1 == s.numberOfProcessedEnvelopes);
+        REQUIRE(0 == s.numberOfDroppedEnvelopes);
+        REQUIRE(0 == s.queueDepth);
+        REQUIRE(1 == s.highWaterMark);
+        REQUIRE(0 <= s.averageLatencyInMicroseconds);
+        REQUIRE(s.averageLatencyInMicroseconds <= s.maximumLatencyInMicroseconds);
+    }
+}
+
+TEST_CASE("Create OD4 session with dataTrigger delegate that changes the dataTriggers itself.") {
+    std::atomic<bool> replyReceived{false};
+    std::atomic<bool> reregistered{false};
+
+    cluon::OD4Session od4(91);
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+    REQUIRE(od4.isRunning());
+
+    REQUIRE(od4.dataTrigger(cluon::data::TimeStamp::ID(), [&od4, &replyReceived, &reregistered](cluon::data::Envelope &&) {
+        // Replacing the own delegate from within a delegate must not deadlock.
+        reregistered = od4.dataTrigger(cluon::data::TimeStamp::ID(), nullptr);
+        replyReceived = true;
+    }));
+
+    cluon::OD4Session od4ToSendFrom(91);
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+    REQUIRE(od4ToSendFrom.isRunning());
+
+    cluon::data::TimeStamp ts;
+    od4ToSendFrom.send(ts);
+    do { std::this_thread::sleep_for(1ms); } while (!replyReceived);
+    REQUIRE(reregistered);
+}
+
+#ifdef __linux__
+TEST_CASE("Create OD4 session with socket filter that drops unsubscribed Envelopes in the kernel.") {
+    std::atomic<uint32_t> timeStampsReceived{0};
+    std::atomic<uint32_t> playerCommandsReceived{0};
+
+    cluon::OD4Session od4(92);
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+    REQUIRE(od4.isRunning());
+
+    REQUIRE(od4.dataTrigger(cluon::data::TimeStamp::ID(), [&timeStampsReceived](cluon::data::Envelope &&) { timeStampsReceived++; }));
+    REQUIRE(od4.useSocketFilter(true));
+
+    cluon::OD4Session od4ToSendFrom(92);
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+    REQUIRE(od4ToSendFrom.isRunning());
+
+    cluon::data::PlayerCommand pc;
+    for (uint32_t i{0}; i < 10; i++) {
+        od4ToSendFrom.send(pc);
+    }
+    cluon::data::TimeStamp ts;
+    od4ToSendFrom.send(ts);
+    do { std::this_thread::sleep_for(1ms); } while (1 > timeStampsReceived.load());
+
+    // Only the TimeStamp reached user space.
+    std::this_thread::sleep_for(100ms);
+    REQUIRE(1 == od4.pipelineStatistics().numberOfQueuedEntries);
+
+    // The filter is regenerated for new delegates.
+    REQUIRE(od4.dataTrigger(cluon::data::PlayerCommand::ID(), [&playerCommandsReceived](cluon::data::Envelope &&) { playerCommandsReceived++; }));
+    od4ToSendFrom.send(pc);
+    do { std::this_thread::sleep_for(1ms); } while (1 > playerCommandsReceived.load());
+    REQUIRE(2 == od4.pipelineStatistics().numberOfQueuedEntries);
+
+    // Without filter, all Envelopes reach user space again.
+    REQUIRE(od4.dataTrigger(cluon::data::PlayerCommand::ID(), nullptr));
+    REQUIRE(od4.useSocketFilter(false));
+    od4ToSendFrom.send(pc);
+    od4ToSendFrom.send(ts);
+    do { std::this_thread::sleep_for(1ms); } while (2 > timeStampsReceived.load());
+    REQUIRE(4 == od4.pipelineStatistics().numberOfQueuedEntries);
+    REQUIRE(1 == playerCommandsReceived);
+}
+
+TEST_CASE("Socket filter cannot be used with catch-all delegate.") {
+    cluon::OD4Session od4(93, [](cluon::data::Envelope &&) {});
+    REQUIRE(!od4.useSocketFilter(true));
+}
+#endif
+
+TEST_CASE("Create OD4 session and send Envelope that needs to be fragmented.") {
+    std::atomic<bool> replyReceived{false};
+    cluon::data::Envelope reply;
+
+    cluon::OD4Session od4(94, [&reply, &replyReceived](cluon::data::Envelope &&envelope) {
+        reply         = std::move(envelope);
+        replyReceived = true;
+    });
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+    REQUIRE(od4.isRunning());
+
+    cluon::OD4Session od4ToSendFrom(94);
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+    REQUIRE(od4ToSendFrom.isRunning());
+
+    std::string payload(1024 * 1024, ' ');
+    for (std::size_t i{0}; i < payload.size(); i++) {
+        payload[i] = static_cast<char>(i % 251);
+    }
+    cluon::data::Envelope env;
+    env.dataType(1234).serializedData(payload).senderStamp(5);
+    od4ToSendFrom.send(std::move(env));
+
+    do { std::this_thread::sleep_for(1ms); } while (!replyReceived);
+    REQUIRE(1234 == reply.dataType());
+    REQUIRE(5 == reply.senderStamp());
+    REQUIRE(payload == reply.serializedData());
+    REQUIRE(1 == od4.fragmentStatistics().numberOfReassembledMessages);
+    REQUIRE(0 == od4.fragmentStatistics().numberOfIncompleteMessages);
+    REQUIRE(0 == od4.fragmentStatistics().numberOfBufferedBytes);
+}
+
+#ifdef __linux__
+TEST_CASE("Socket filter passes fragments of subscribed Envelopes.") {
+    std::atomic<uint32_t> envelopesReceived{0};
+    std::size_t size{0};
+
+    cluon::OD4Session od4(95);
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+    REQUIRE(od4.isRunning());
+    REQUIRE(od4.dataTrigger(1234, [&envelopesReceived, &size](cluon::data::Envelope &&envelope) {
+        size = envelope.serializedData().size();
+        envelopesReceived++;
+    }));
+    REQUIRE(od4.useSocketFilter(true));
+
+    cluon::OD4Session od4ToSendFrom(95);
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+    REQUIRE(od4ToSendFrom.isRunning());
+
+    cluon::data::Envelope unsubscribed;
+    unsubscribed.dataType(4321).serializedData(std::string(200 * 1000, 'A'));
+    od4ToSendFrom.send(std::move(unsubscribed));
+
+    cluon::data::Envelope subscribed;
+    subscribed.dataType(1234).serializedData(std::string(200 * 1000, 'B'));
+    od4ToSendFrom.send(std::move(subscribed));
+
+    do { std::this_thread::sleep_for(1ms); } while (1 > envelopesReceived.load());
+    std::this_thread::sleep_for(100ms);
+    REQUIRE(1 == envelopesReceived.load());
+    REQUIRE(200 * 1000 == size);
+
+    // Only the fragments of the subscribed Envelope reached user space.
+    REQUIRE(4 == od4.pipelineStatistics().numberOfQueuedEntries);
+}
+#endif
+
+TEST_CASE("Benchmark publishing messages from several threads.", "[.benchmark]") {
+    cluon::OD4Session od4ToSendFrom(96);
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+    REQUIRE(od4ToSendFrom.isRunning());
+
+    constexpr uint32_t MESSAGES_PER_THREAD{20 * 1000};
+    for (uint32_t numberOfThreads : {1u, 2u, 4u}) {
+        auto before = std::chrono::steady_clock::now();
+        std::vector<std::thread> senders;
+        for (uint32_t t{0}; t < numberOfThreads; t++) {
+            senders.emplace_back([&od4ToSendFrom, t]() noexcept {
+                testdata::MyTestMessage1 msg;
+                msg.attribute13(std::string(1000, 'a')).attribute14(std::string(200, 'b'));
+                for (uint32_t i{0}; i < MESSAGES_PER_THREAD; i++) {
+                    msg.attribute8(i);
+                    od4ToSendFrom.send(msg, cluon::data::TimeStamp(), t);
+                }
+            });
+        }
+        for (auto &sender : senders) {
+            sender.join();
+        }
+        auto after = std::chrono::steady_clock::now();
+
+        const auto DURATION{std::chrono::duration_cast<std::chrono::microseconds>(after - before).count()};
+        REQUIRE(0 < DURATION);
+        std::cout << "Publishing " << numberOfThreads << " x " << MESSAGES_PER_THREAD << " messages took " << DURATION / 1000 << " ms ("
+                  << (static_cast<int64_t>(numberOfThreads * MESSAGES_PER_THREAD) * 1000 * 1000) / DURATION << " messages/s)." << std::endl;
+    }
+}
+
+TEST_CASE("Create OD4 session with delegates that throw exceptions.") {
+    std::atomic<uint32_t> dataTriggerCalls{0};
+    std::atomic<uint32_t> catchAllCalls{0};
+
+    cluon::OD4Session od4DataTrigger(97);
+    REQUIRE(od4DataTrigger.dataTrigger(cluon::data::TimeStamp::ID(), [&dataTriggerCalls](cluon::data::Envelope &&) {
+        dataTriggerCalls++;
+        throw std::runtime_error("exception from dataTrigger delegate");
+    }));
+
+    cluon::OD4Session od4CatchAll(97, [&catchAllCalls](cluon::data::Envelope &&) {
+        catchAllCalls++;
+        throw std::runtime_error("exception from catch-all delegate");
+    });
+
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!od4DataTrigger.isRunning() || !od4CatchAll.isRunning());
+
+    cluon::OD4Session od4ToSendFrom(97);
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+    REQUIRE(od4ToSendFrom.isRunning());
+
+    // Both sessions must survive the exceptions and receive the subsequent Envelopes.
+    cluon::data::TimeStamp ts;
+    for (uint32_t i{0}; (i < 1000) && ((dataTriggerCalls < 2) || (catchAllCalls < 2)); i++) {
+        od4ToSendFrom.send(ts);
+        std::this_thread::sleep_for(10ms);
+    }
+    REQUIRE(2 <= dataTriggerCalls);
+    REQUIRE(2 <= catchAllCalls);
+}
+
+TEST_CASE("Create OD4 session and send a large message followed by small messages from the same thread.") {
+    std::mutex receivedSizesMutex;
+    std::vector<std::size_t> receivedSizes;
+
+    cluon::OD4Session od4(98);
+    REQUIRE(od4.dataTrigger(testdata::MyTestMessage4::ID(), [&receivedSizesMutex, &receivedSizes](cluon::data::Envelope &&envelope) {
+        testdata::MyTestMessage4 msg = cluon::extractMessage<testdata::MyTestMessage4>(std::move(envelope));
+        std::lock_guard<std::mutex> lck(receivedSizesMutex);
+        receivedSizes.push_back(msg.attribute1().size());
+    }));
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!od4.isRunning());
+
+    cluon::OD4Session od4ToSendFrom(98);
+    do { std::this_thread::sleep_for(1ms); } while (!od4ToSendFrom.isRunning());
+    REQUIRE(od4ToSendFrom.isRunning());
+
+    // The buffers of the sending thread are released after the large message and are reused afterwards.
+    testdata::MyTestMessage4 msg;
+    msg.attribute1(std::string(200 * 1000, 'L'));
+    od4ToSendFrom.send(msg);
+    msg.attribute1("small");
+    od4ToSendFrom.send(msg);
+    od4ToSendFrom.send(msg);
+
+    std::size_t numberOfReceivedMessages{0};
+    for (uint32_t i{0}; (i < 1000) && (3 > numberOfReceivedMessages); i++) {
+        std::this_thread::sleep_for(1ms);
+        std::lock_guard<std::mutex> lck(receivedSizesMutex);
+        numberOfReceivedMessages = receivedSizes.size();
+    }
+    std::lock_guard<std::mutex> lck(receivedSizesMutex);
+    REQUIRE(3 == receivedSizes.size());
+    REQUIRE(200 * 1000 == receivedSizes[0]);
+    REQUIRE(5 == receivedSizes[1]);
+    REQUIRE(5 == receivedSizes[2]);
+}
@@ -14,10 +14,14 @@
 #include "cluon/cluonDataStructures.hpp"
 #include "cluon/cluonTestDataStructures.hpp"
 
+#include <chrono>
+#include <cstdint>
 #include <cstdio>
 #include <fstream>
+#include <iostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 // clang-format off
 #ifdef WIN32
@@ -781,3 +785,228 @@ TEST_CASE("Create simple player for file with three entries with manual rewind a
     REQUIRE(6 == retrievedEntries);
     UNLINK("rec9");
 }
+
+TEST_CASE("Replay file with large payloads forwards and after seeking backwards.") {
+    constexpr bool AUTO_REWIND{false};
+    constexpr bool THREADING{false};
+
+    UNLINK("rec10");
+    UNLINK("rec10.idx");
+    constexpr int32_t MAX_ENTRIES{40};
+    constexpr std::size_t PAYLOAD_SIZE{1024 * 1024};
+    {
+        std::fstream recordingFile("rec10", std::ios::out | std::ios::binary | std::ios::trunc);
+        REQUIRE(recordingFile.good());
+
+        for (int32_t entryCounter{0}; entryCounter < MAX_ENTRIES; entryCounter++) {
+            cluon::data::TimeStamp sampleTimeStamp;
+            sampleTimeStamp.seconds(10000).microseconds(entryCounter);
+
+            cluon::data::Envelope env;
+            env.dataType(entryCounter).serializedData(std::string(PAYLOAD_SIZE, static_cast<char>('a' + entryCounter % 26))).sampleTimeStamp(sampleTimeStamp);
+
+            const std::string tmp{cluon::serializeEnvelope(std::move(env))};
+            recordingFile.write(tmp.c_str(), static_cast<std::streamsize>(tmp.size()));
+        }
+        recordingFile.close();
+    }
+    cluon::Player player("rec10", AUTO_REWIND, THREADING);
+    REQUIRE(MAX_ENTRIES == player.totalNumberOfEnvelopesInRecFile());
+
+    int32_t retrievedEntries{0};
+    while (player.hasMoreData()) {
+        auto entry = player.getNextEnvelopeToBeReplayed();
+        REQUIRE(entry.first);
+        REQUIRE(retrievedEntries == entry.second.dataType());
+        REQUIRE(std::string(PAYLOAD_SIZE, static_cast<char>('a' + retrievedEntries % 26)) == entry.second.serializedData());
+        retrievedEntries++;
+    }
+    REQUIRE(MAX_ENTRIES == retrievedEntries);
+
+    for (float ratio : {0.75f, 0.25f}) {
+        player.seekTo(ratio);
+        const int32_t EXPECTED{static_cast<int32_t>(static_cast<float>(MAX_ENTRIES) * ratio)};
+        auto entry = player.getNextEnvelopeToBeReplayed();
+        REQUIRE(entry.first);
+        REQUIRE(EXPECTED == entry.second.dataType());
+        REQUIRE(std::string(PAYLOAD_SIZE, static_cast<char>('a' + EXPECTED % 26)) == entry.second.serializedData());
+    }
+    UNLINK("rec10");
+    UNLINK("rec10.idx");
+}
+
+#ifndef WIN32
+TEST_CASE("Replay file that is truncated while it is replayed.") {
+    constexpr bool AUTO_REWIND{false};
+    constexpr bool THREADING{false};
+
+    UNLINK("rec13");
+    UNLINK("rec13.idx");
+    constexpr int32_t MAX_ENTRIES{40};
+    constexpr int32_t REMAINING_ENTRIES{MAX_ENTRIES / 2};
+    constexpr std::size_t PAYLOAD_SIZE{64 * 1024};
+    off_t sizeOfRemainingEntries{0};
+    {
+        std::fstream recordingFile("rec13", std::ios::out | std::ios::binary | std::ios::trunc);
+        REQUIRE(recordingFile.good());
+
+        for (int32_t entryCounter{0}; entryCounter < MAX_ENTRIES; entryCounter++) {
+            cluon::data::TimeStamp sampleTimeStamp;
+            sampleTimeStamp.seconds(10000).microseconds(entryCounter);
+
+            cluon::data::Envelope env;
+            env.dataType(entryCounter).serializedData(std::string(PAYLOAD_SIZE, static_cast<char>('a' + entryCounter % 26))).sampleTimeStamp(sampleTimeStamp);
+
+            const std::string tmp{cluon::serializeEnvelope(std::move(env))};
+            recordingFile.write(tmp.c_str(), static_cast<std::streamsize>(tmp.size()));
+            if (entryCounter < REMAINING_ENTRIES) {
+                sizeOfRemainingEntries += static_cast<off_t>(tmp.size());
+            }
+        }
+        recordingFile.close();
+    }
+    cluon::Player player("rec13", AUTO_REWIND, THREADING);
+    REQUIRE(MAX_ENTRIES == player.totalNumberOfEnvelopesInRecFile());
+
+    int32_t retrievedEntries{0};
+    while (player.hasMoreData()) {
+        if (REMAINING_ENTRIES / 2 == retrievedEntries) {
+            REQUIRE(0 == ::truncate("rec13", sizeOfRemainingEntries));
+        }
+        auto entry = player.getNextEnvelopeToBeReplayed();
+        REQUIRE(entry.first);
+        if (retrievedEntries < REMAINING_ENTRIES) {
+            REQUIRE(retrievedEntries == entry.second.dataType());
+            REQUIRE(std::string(PAYLOAD_SIZE, static_cast<char>('a' + retrievedEntries % 26)) == entry.second.serializedData());
+        } else {
+            // Envelopes that were removed from the file are replayed empty.
+            REQUIRE(entry.second.serializedData().empty());
+        }
+        retrievedEntries++;
+    }
+    REQUIRE(MAX_ENTRIES == retrievedEntries);
+
+    UNLINK("rec13");
+    UNLINK("rec13.idx");
+}
+#endif
+
+TEST_CASE("Replay unsorted file chronologically and seek to sample time stamps.") {
+    constexpr bool AUTO_REWIND{false};
+    constexpr bool THREADING{false};
+
+    UNLINK("rec11");
+    UNLINK("rec11.idx");
+    // Pairs of microseconds for the sample time stamp and senderStamp in the order of the .rec file.
+    const std::vector<std::pair<int32_t, uint32_t>> ENTRIES{{50, 0}, {10, 1}, {30, 2}, {10, 3}, {70, 4}, {30, 5}};
+    {
+        std::fstream recordingFile("rec11", std::ios::out | std::ios::binary | std::ios::trunc);
+        REQUIRE(recordingFile.good());
+        for (const auto &e : ENTRIES) {
+            cluon::data::TimeStamp sampleTimeStamp;
+            sampleTimeStamp.seconds(10000).microseconds(e.first);
+            cluon::data::Envelope env;
+            env.dataType(1).senderStamp(e.second).sampleTimeStamp(sampleTimeStamp);
+            const std::string tmp{cluon::serializeEnvelope(std::move(env))};
+            recordingFile.write(tmp.c_str(), static_cast<std::streamsize>(tmp.size()));
+        }
+    }
+    cluon::Player player("rec11", AUTO_REWIND, THREADING);
+    REQUIRE(ENTRIES.size() == player.totalNumberOfEnvelopesInRecFile());
+
+    // Envelopes with the same sample time stamp are replayed in the order of the .rec file.
+    const std::vector<uint32_t> EXPECTED_SENDERSTAMPS{1, 3, 2, 5, 0, 4};
+    const std::vector<uint32_t> EXPECTED_DELAYS{0, 0, 20, 0, 20, 20};
+    for (std::size_t i{0}; i < EXPECTED_SENDERSTAMPS.size(); i++) {
+        REQUIRE(player.hasMoreData());
+        auto entry = player.getNextEnvelopeToBeReplayed();
+        REQUIRE(entry.first);
+        REQUIRE(EXPECTED_SENDERSTAMPS[i] == entry.second.senderStamp());
+        REQUIRE(EXPECTED_DELAYS[i] == player.delay());
+    }
+    REQUIRE(!player.hasMoreData());
+
+    cluon::data::TimeStamp sampleTimeStamp;
+    sampleTimeStamp.seconds(10000).microseconds(30);
+    player.seekToSampleTimeStamp(sampleTimeStamp);
+    {
+        REQUIRE(player.hasMoreData());
+        auto entry = player.getNextEnvelopeToBeReplayed();
+        REQUIRE(entry.first);
+        REQUIRE(2 == entry.second.senderStamp());
+        REQUIRE(20 == player.delay());
+    }
+
+    sampleTimeStamp.microseconds(31);
+    player.seekToSampleTimeStamp(sampleTimeStamp);
+    {
+        auto entry = player.getNextEnvelopeToBeReplayed();
+        REQUIRE(entry.first);
+        REQUIRE(0 == entry.second.senderStamp());
+    }
+
+    sampleTimeStamp.seconds(0).microseconds(0);
+    player.seekToSampleTimeStamp(sampleTimeStamp);
+    {
+        auto entry = player.getNextEnvelopeToBeReplayed();
+        REQUIRE(entry.first);
+        REQUIRE(1 == entry.second.senderStamp());
+        REQUIRE(0 == player.delay());
+    }
+
+    sampleTimeStamp.seconds(10000).microseconds(71);
+    player.seekToSampleTimeStamp(sampleTimeStamp);
+    REQUIRE(!player.hasMoreData());
+    REQUIRE(!player.getNextEnvelopeToBeReplayed().first);
+
+    UNLINK("rec11");
+    UNLINK("rec11.idx");
+}
+
+TEST_CASE("Benchmark loading the index and seeking to sample time stamps.", "[.benchmark]") {
+    constexpr bool AUTO_REWIND{false};
+    constexpr bool THREADING{false};
+    constexpr uint32_t NUMBER_OF_ENVELOPES{1000 * 1000};
+
+    UNLINK("rec12");
+    UNLINK("rec12.idx");
+    {
+        std::fstream recordingFile("rec12", std::ios::out | std::ios::binary | std::ios::trunc);
+        REQUIRE(recordingFile.good());
+        std::string tmp;
+        for (uint32_t i{0}; i < NUMBER_OF_ENVELOPES; i++) {
+            cluon::data::TimeStamp sampleTimeStamp;
+            sampleTimeStamp.seconds(static_cast<int32_t>(i / 1000)).microseconds(static_cast<int32_t>(i % 1000) * 1000);
+            cluon::data::Envelope env;
+            env.dataType(1).senderStamp(i).sampleTimeStamp(sampleTimeStamp);
+            cluon::serializeEnvelope(env, tmp);
+            recordingFile.write(tmp.c_str(), static_cast<std::streamsize>(tmp.size()));
+        }
+    }
+    // Create the index file.
+    { cluon::Player player("rec12", AUTO_REWIND, THREADING); }
+
+    auto beforeOpening = std::chrono::steady_clock::now();
+    cluon::Player player("rec12", AUTO_REWIND, THREADING);
+    auto afterOpening = std::chrono::steady_clock::now();
+    REQUIRE(NUMBER_OF_ENVELOPES == player.totalNumberOfEnvelopesInRecFile());
+    std::cout << "Loading the index for " << NUMBER_OF_ENVELOPES << " Envelopes took "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(afterOpening - beforeOpening).count() << " ms." << std::endl;
+
+    constexpr uint32_t SEEKS{100};
+    auto before = std::chrono::steady_clock::now();
+    for (uint32_t i{0}; i < SEEKS; i++) {
+        cluon::data::TimeStamp sampleTimeStamp;
+        sampleTimeStamp.seconds(static_cast<int32_t>((i * 7919) % (NUMBER_OF_ENVELOPES / 1000)));
+        player.seekToSampleTimeStamp(sampleTimeStamp);
+    }
+    auto after = std::chrono::steady_clock::now();
+    auto entry = player.getNextEnvelopeToBeReplayed();
+    REQUIRE(entry.first);
+    REQUIRE((((SEEKS - 1) * 7919) % (NUMBER_OF_ENVELOPES / 1000)) * 1000 == entry.second.senderStamp());
+    std::cout << "Seeking to a sample time stamp took "
+              << std::chrono::duration_cast<std::chrono::microseconds>(after - before).count() / SEEKS << " us." << std::endl;
+
+    UNLINK("rec12");
+    UNLINK("rec12.idx");
+}
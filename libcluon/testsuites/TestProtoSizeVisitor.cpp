@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/ProtoSizeVisitor.hpp"
+#include "cluon/ToProtoVisitor.hpp"
+#include "cluon/cluonDataStructures.hpp"
+#include "cluon/cluonTestDataStructures.hpp"
+
+#include <cstdint>
+#include <string>
+
+template <typename T>
+static std::size_t sizeViaEncoding(T &msg) {
+    cluon::ToProtoVisitor protoEncoder;
+    msg.accept(protoEncoder);
+    return protoEncoder.encodedBuffer().size();
+}
+
+template <typename T>
+static std::size_t sizeViaSizeVisitor(T &msg) {
+    cluon::ProtoSizeVisitor protoSize;
+    msg.accept(protoSize);
+    return protoSize.encodedSize();
+}
+
+TEST_CASE("Size of VarInts.") {
+    REQUIRE(1 == cluon::ProtoSizeVisitor::sizeOfVarInt(0));
+    REQUIRE(1 == cluon::ProtoSizeVisitor::sizeOfVarInt(127));
+    REQUIRE(2 == cluon::ProtoSizeVisitor::sizeOfVarInt(128));
+    REQUIRE(2 == cluon::ProtoSizeVisitor::sizeOfVarInt(16383));
+    REQUIRE(3 == cluon::ProtoSizeVisitor::sizeOfVarInt(16384));
+    REQUIRE(10 == cluon::ProtoSizeVisitor::sizeOfVarInt(UINT64_MAX));
+}
+
+TEST_CASE("Size of test messages with default and extreme values.") {
+    testdata::MyTestMessage1 tmp1;
+    REQUIRE(sizeViaEncoding(tmp1) == sizeViaSizeVisitor(tmp1));
+
+    tmp1.attribute1(true)
+        .attribute2('z')
+        .attribute3(-128)
+        .attribute4(255)
+        .attribute5(-32768)
+        .attribute6(65535)
+        .attribute7(-2147483647 - 1)
+        .attribute8(4294967295u)
+        .attribute9(-9223372036854775807ll - 1)
+        .attribute10(18446744073709551615ull)
+        .attribute11(-1.5f)
+        .attribute12(3.25)
+        .attribute13(std::string(200, 'a'))
+        .attribute14(std::string(20000, 'b'));
+    REQUIRE(sizeViaEncoding(tmp1) == sizeViaSizeVisitor(tmp1));
+
+    tmp1.attribute3(127).attribute5(32767).attribute7(2147483647).attribute9(9223372036854775807ll);
+    REQUIRE(sizeViaEncoding(tmp1) == sizeViaSizeVisitor(tmp1));
+
+    testdata::MyTestMessage5 tmp5;
+    REQUIRE(sizeViaEncoding(tmp5) == sizeViaSizeVisitor(tmp5));
+
+    testdata::MyTestMessage7 tmp7;
+    testdata::MyTestMessage2 tmp2;
+    tmp7.attribute1(tmp2.attribute1(200)).attribute2(12);
+    REQUIRE(sizeViaEncoding(tmp7) == sizeViaSizeVisitor(tmp7));
+
+    testdata::MyTestMessage11 tmp11;
+    REQUIRE(0 == sizeViaSizeVisitor(tmp11));
+
+    cluon::ProtoSizeVisitor protoSize;
+    tmp7.accept(protoSize);
+    REQUIRE(0 < protoSize.encodedSize());
+    protoSize.reset();
+    REQUIRE(0 == protoSize.encodedSize());
+}
+
+TEST_CASE("Size of Envelope with nested TimeStamps and payload.") {
+    cluon::data::TimeStamp ts;
+    ts.seconds(1526000000).microseconds(999999);
+
+    cluon::data::Envelope env;
+    env.dataType(-1).serializedData(std::string(300, 'x')).sent(ts).received(ts).sampleTimeStamp(ts).senderStamp(4000000000u);
+    REQUIRE(sizeViaEncoding(env) == sizeViaSizeVisitor(env));
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2017-2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/Reactor.hpp"
+
+#ifndef WIN32
+    #include <unistd.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+TEST_CASE("Creating and stopping a Reactor.") {
+    cluon::Reactor reactor;
+    REQUIRE(reactor.isRunning());
+    REQUIRE(0 == reactor.numberOfFileDescriptors());
+}
+
+TEST_CASE("Reactor rejects invalid registrations.") {
+    cluon::Reactor reactor;
+    REQUIRE(!reactor.add(-1, []() {}));
+    REQUIRE(!reactor.add(0, nullptr));
+    reactor.remove(-1);
+    REQUIRE(0 == reactor.numberOfFileDescriptors());
+}
+
+#ifndef WIN32
+TEST_CASE("Reactor calls delegate for readable file descriptor.") {
+    int fds[2];
+    REQUIRE(0 == ::pipe(fds));
+
+    std::atomic<uint32_t> calls{0};
+    cluon::Reactor reactor;
+    REQUIRE(reactor.add(fds[0], [&fds, &calls]() {
+        char c;
+        if (1 == ::read(fds[0], &c, 1)) {
+            calls++;
+        }
+    }));
+    REQUIRE(!reactor.add(fds[0], []() {}));
+    REQUIRE(1 == reactor.numberOfFileDescriptors());
+
+    REQUIRE(1 == ::write(fds[1], "A", 1));
+    REQUIRE(1 == ::write(fds[1], "B", 1));
+
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (2 > calls.load());
+
+    reactor.remove(fds[0]);
+    REQUIRE(0 == reactor.numberOfFileDescriptors());
+
+    // The delegate is not called anymore after remove has returned.
+    REQUIRE(1 == ::write(fds[1], "C", 1));
+    std::this_thread::sleep_for(50ms);
+    REQUIRE(2 == calls.load());
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+TEST_CASE("Reactor remove waits for a running delegate.") {
+    int fds[2];
+    REQUIRE(0 == ::pipe(fds));
+
+    std::atomic<bool> delegateEntered{false};
+    std::atomic<bool> delegateReturned{false};
+    cluon::Reactor reactor;
+    REQUIRE(reactor.add(fds[0], [&fds, &delegateEntered, &delegateReturned]() {
+        char c;
+        if (1 == ::read(fds[0], &c, 1)) {
+            delegateEntered.store(true);
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            delegateReturned.store(true);
+        }
+    }));
+
+    REQUIRE(1 == ::write(fds[1], "A", 1));
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (!delegateEntered.load());
+
+    reactor.remove(fds[0]);
+    REQUIRE(delegateReturned.load());
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+TEST_CASE("Reactor delegate can remove itself.") {
+    int fds[2];
+    REQUIRE(0 == ::pipe(fds));
+
+    std::atomic<uint32_t> calls{0};
+    cluon::Reactor reactor;
+    REQUIRE(reactor.add(fds[0], [&reactor, &fds, &calls]() {
+        calls++;
+        reactor.remove(fds[0]);
+    }));
+
+    REQUIRE(1 == ::write(fds[1], "A", 1));
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (0 == calls.load());
+    std::this_thread::sleep_for(50ms);
+
+    REQUIRE(1 == calls.load());
+    REQUIRE(0 == reactor.numberOfFileDescriptors());
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+#endif
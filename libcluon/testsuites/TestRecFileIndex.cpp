@@ -0,0 +1,360 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon/Envelope.hpp"
+#include "cluon/Player.hpp"
+#include "cluon/RecFileIndex.hpp"
+#include "cluon/cluonDataStructures.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// clang-format off
+#ifdef WIN32
+    #define UNLINK _unlink
+#else
+    #include <unistd.h>
+    #define UNLINK unlink
+#endif
+// clang-format on
+
+static void writeRecFile(const std::string &file, int32_t numberOfEntries, int32_t offset) {
+    std::fstream recordingFile(file, std::ios::out | std::ios::binary | std::ios::trunc);
+    REQUIRE(recordingFile.good());
+    for (int32_t i{0}; i < numberOfEntries; i++) {
+        cluon::data::TimeStamp sampleTimeStamp;
+        // Store the entries in reverse chronological order.
+        sampleTimeStamp.seconds(1000).microseconds(offset + numberOfEntries - i);
+
+        cluon::data::Envelope env;
+        env.dataType(100 + i).senderStamp(static_cast<uint32_t>(i)).serializedData(std::string(static_cast<std::size_t>(i), 'x')).sampleTimeStamp(sampleTimeStamp);
+        const std::string DATA{cluon::serializeEnvelope(std::move(env))};
+        recordingFile.write(DATA.data(), static_cast<std::streamsize>(DATA.size()));
+    }
+}
+
+TEST_CASE("Build, write, and read index for .rec file.") {
+    UNLINK("recIndex1.rec");
+    UNLINK("recIndex1.rec.idx");
+    writeRecFile("recIndex1.rec", 10, 0);
+
+    REQUIRE("recIndex1.rec.idx" == cluon::RecFileIndex::indexFileFor("recIndex1.rec"));
+    REQUIRE(!cluon::RecFileIndex::read("recIndex1.rec").first);
+
+    std::fstream recFile("recIndex1.rec", std::ios::in | std::ios::binary);
+    const std::vector<cluon::RecFileIndexEntry> ENTRIES{cluon::RecFileIndex::build(recFile)};
+    REQUIRE(10 == ENTRIES.size());
+
+    uint64_t position{0};
+    for (uint32_t i{0}; i < ENTRIES.size(); i++) {
+        REQUIRE(position == ENTRIES[i].m_filePosition);
+        REQUIRE(static_cast<int32_t>(100 + i) == ENTRIES[i].m_dataType);
+        REQUIRE(i == ENTRIES[i].m_senderStamp);
+        REQUIRE((1000 * 1000 * 1000ll + 10 - i) == ENTRIES[i].m_sampleTimeStamp);
+        position += ENTRIES[i].m_length;
+    }
+    recFile.clear();
+    recFile.seekg(0, recFile.end);
+    REQUIRE(static_cast<uint64_t>(recFile.tellg()) == position);
+
+    REQUIRE(cluon::RecFileIndex::write("recIndex1.rec", ENTRIES));
+    auto index = cluon::RecFileIndex::read("recIndex1.rec");
+    REQUIRE(index.first);
+    REQUIRE(ENTRIES.size() == index.second.size());
+    for (std::size_t i{0}; i < ENTRIES.size(); i++) {
+        REQUIRE(ENTRIES[i].m_sampleTimeStamp == index.second[i].m_sampleTimeStamp);
+        REQUIRE(ENTRIES[i].m_filePosition == index.second[i].m_filePosition);
+        REQUIRE(ENTRIES[i].m_dataType == index.second[i].m_dataType);
+        REQUIRE(ENTRIES[i].m_senderStamp == index.second[i].m_senderStamp);
+        REQUIRE(ENTRIES[i].m_length == index.second[i].m_length);
+    }
+
+    UNLINK("recIndex1.rec");
+    UNLINK("recIndex1.rec.idx");
+}
+
+TEST_CASE("Build index across block boundaries and skip invalid bytes.") {
+    std::stringstream sstr;
+    std::vector<uint64_t> positions;
+    std::vector<std::size_t> payloadSizes{10, 9 * 1024 * 1024, 3, 5 * 1024 * 1024, 4 * 1024 * 1024, 0};
+    for (std::size_t i{0}; i < payloadSizes.size(); i++) {
+        if (2 == i) {
+            // Bytes without OD4 header are skipped.
+            sstr << std::string(5, '\0');
+        }
+        cluon::data::Envelope env;
+        env.dataType(static_cast<int32_t>(200 + i)).serializedData(std::string(payloadSizes[i], 'b'));
+        positions.push_back(static_cast<uint64_t>(sstr.tellp()));
+        sstr << cluon::serializeEnvelope(std::move(env));
+    }
+    // Truncated Envelope at the end.
+    sstr << std::string("\x0D\xA4\x10\x00\x00\x08", 6);
+
+    const std::vector<cluon::RecFileIndexEntry> ENTRIES{cluon::RecFileIndex::build(sstr)};
+    REQUIRE(payloadSizes.size() == ENTRIES.size());
+    for (std::size_t i{0}; i < ENTRIES.size(); i++) {
+        REQUIRE(positions[i] == ENTRIES[i].m_filePosition);
+        REQUIRE(static_cast<int32_t>(200 + i) == ENTRIES[i].m_dataType);
+
+        sstr.clear();
+        sstr.seekg(static_cast<std::streamoff>(ENTRIES[i].m_filePosition));
+        auto retVal = cluon::extractEnvelope(sstr);
+        REQUIRE(retVal.first);
+        REQUIRE(payloadSizes[i] == retVal.second.serializedData().size());
+        REQUIRE(ENTRIES[i].m_filePosition + ENTRIES[i].m_length == static_cast<uint64_t>(sstr.tellg()));
+    }
+}
+
+TEST_CASE("Benchmark building index for .rec file.", "[.benchmark]") {
+    constexpr std::size_t PAYLOAD_SIZE{1024};
+    constexpr uint32_t NUMBER_OF_ENVELOPES{64 * 1024};
+    std::string recording;
+    {
+        std::string payload(PAYLOAD_SIZE, 'r');
+        for (uint32_t i{0}; i < NUMBER_OF_ENVELOPES; i++) {
+            cluon::data::TimeStamp sampleTimeStamp;
+            sampleTimeStamp.seconds(static_cast<int32_t>(i / 1000)).microseconds(static_cast<int32_t>(i % 1000));
+            cluon::data::Envelope env;
+            env.dataType(42).serializedData(payload).sampleTimeStamp(sampleTimeStamp).senderStamp(i);
+            recording += cluon::serializeEnvelope(std::move(env));
+        }
+    }
+    const double GIGABYTES{static_cast<double>(recording.size()) / (1024.0 * 1024.0 * 1024.0)};
+
+    // Decoding every Envelope completely.
+    {
+        std::stringstream sstr(recording);
+        uint32_t count{0};
+        auto before = std::chrono::steady_clock::now();
+        while (sstr.good()) {
+            auto retVal = cluon::extractEnvelope(sstr);
+            if (!sstr.eof() && retVal.first) {
+                count++;
+            }
+        }
+        auto after = std::chrono::steady_clock::now();
+        REQUIRE(NUMBER_OF_ENVELOPES == count);
+        const double SECONDS{std::chrono::duration_cast<std::chrono::duration<double>>(after - before).count()};
+        std::cout << "Indexing " << recording.size() << " bytes by decoding Envelopes: " << (GIGABYTES / SECONDS) << " GB/s." << std::endl;
+    }
+
+    // Scanning the Envelopes' headers only.
+    {
+        std::stringstream sstr(recording);
+        auto before = std::chrono::steady_clock::now();
+        const std::vector<cluon::RecFileIndexEntry> ENTRIES{cluon::RecFileIndex::build(sstr)};
+        auto after = std::chrono::steady_clock::now();
+        REQUIRE(NUMBER_OF_ENVELOPES == ENTRIES.size());
+        REQUIRE((NUMBER_OF_ENVELOPES - 1) == ENTRIES.back().m_senderStamp);
+        const double SECONDS{std::chrono::duration_cast<std::chrono::duration<double>>(after - before).count()};
+        std::cout << "Indexing " << recording.size() << " bytes by scanning Envelopes: " << (GIGABYTES / SECONDS) << " GB/s." << std::endl;
+    }
+}
+
+static void requireSameEntries(const std::vector<cluon::RecFileIndexEntry> &expected, const std::vector<cluon::RecFileIndexEntry> &actual) {
+    REQUIRE(expected.size() == actual.size());
+    for (std::size_t i{0}; i < expected.size(); i++) {
+        REQUIRE(expected[i].m_sampleTimeStamp == actual[i].m_sampleTimeStamp);
+        REQUIRE(expected[i].m_filePosition == actual[i].m_filePosition);
+        REQUIRE(expected[i].m_dataType == actual[i].m_dataType);
+        REQUIRE(expected[i].m_senderStamp == actual[i].m_senderStamp);
+        REQUIRE(expected[i].m_length == actual[i].m_length);
+    }
+}
+
+TEST_CASE("Build index in parallel chunks with the same entries as sequentially.") {
+    UNLINK("recIndex4.rec");
+    {
+        std::fstream recordingFile("recIndex4.rec", std::ios::out | std::ios::binary | std::ios::trunc);
+        REQUIRE(recordingFile.good());
+        for (uint32_t i{0}; i < 300; i++) {
+            cluon::data::TimeStamp sampleTimeStamp;
+            sampleTimeStamp.seconds(static_cast<int32_t>(i)).microseconds(static_cast<int32_t>(i * 13 % 1000));
+            cluon::data::Envelope env;
+            env.dataType(static_cast<int32_t>(i % 17)).senderStamp(i).sampleTimeStamp(sampleTimeStamp);
+            if (0 == i % 50) {
+                env.serializedData(std::string(100 * 1000, 'L'));
+            } else if (0 == i % 7) {
+                // Payload with a complete Envelope including its OD4 header.
+                cluon::data::Envelope inner;
+                inner.dataType(4711).senderStamp(i).sampleTimeStamp(sampleTimeStamp);
+                env.serializedData(cluon::serializeEnvelope(std::move(inner)) + std::string(i, 'n'));
+            } else {
+                env.serializedData(std::string(i * 11 % 3000, 's'));
+            }
+            const std::string DATA{cluon::serializeEnvelope(std::move(env))};
+            recordingFile.write(DATA.data(), static_cast<std::streamsize>(DATA.size()));
+
+            // Bytes without OD4 header between Envelopes.
+            if (0 == i % 31) {
+                recordingFile.write("\0\0\0\0\0", 5);
+            }
+            if (0 == i % 97) {
+                recordingFile.write("xyz", 3);
+            }
+        }
+        // Truncated Envelope at the end.
+        recordingFile.write("\x0D\xA4\x10\x00\x00\x08", 6);
+    }
+
+    std::vector<cluon::RecFileIndexEntry> expected;
+    {
+        std::fstream recFile("recIndex4.rec", std::ios::in | std::ios::binary);
+        expected = cluon::RecFileIndex::build(recFile);
+    }
+    REQUIRE(100 < expected.size());
+
+    for (uint32_t threads : {1u, 2u, 3u, 8u}) {
+        for (uint64_t bytesPerChunk : {97u, 1000u, 4096u, 65536u, 1000000u}) {
+            requireSameEntries(expected, cluon::RecFileIndex::build("recIndex4.rec", threads, bytesPerChunk));
+        }
+    }
+    requireSameEntries(expected, cluon::RecFileIndex::build("recIndex4.rec"));
+    REQUIRE(cluon::RecFileIndex::build("recIndex4.rec.doesnotexist").empty());
+
+    UNLINK("recIndex4.rec");
+}
+
+TEST_CASE("Benchmark building index for .rec file in parallel chunks.", "[.benchmark]") {
+    constexpr uint32_t NUMBER_OF_ENVELOPES{64 * 1024};
+    constexpr uint64_t BYTES_PER_CHUNK{8 * 1024 * 1024};
+    UNLINK("recIndex5.rec");
+    {
+        std::fstream recordingFile("recIndex5.rec", std::ios::out | std::ios::binary | std::ios::trunc);
+        REQUIRE(recordingFile.good());
+        const std::string PAYLOAD(1024, 'r');
+        std::string data;
+        for (uint32_t i{0}; i < NUMBER_OF_ENVELOPES; i++) {
+            cluon::data::Envelope env;
+            env.dataType(42).serializedData(PAYLOAD).senderStamp(i);
+            cluon::serializeEnvelope(env, data);
+            recordingFile.write(data.data(), static_cast<std::streamsize>(data.size()));
+        }
+    }
+
+    std::vector<cluon::RecFileIndexEntry> expected;
+    double gigabytes{0};
+    {
+        std::fstream recFile("recIndex5.rec", std::ios::in | std::ios::binary);
+        recFile.seekg(0, recFile.end);
+        gigabytes = static_cast<double>(recFile.tellg()) / (1024.0 * 1024.0 * 1024.0);
+        auto before = std::chrono::steady_clock::now();
+        expected    = cluon::RecFileIndex::build(recFile);
+        auto after  = std::chrono::steady_clock::now();
+        const double SECONDS{std::chrono::duration_cast<std::chrono::duration<double>>(after - before).count()};
+        std::cout << "Indexing recIndex5.rec sequentially: " << (gigabytes / SECONDS) << " GB/s." << std::endl;
+    }
+    REQUIRE(NUMBER_OF_ENVELOPES == expected.size());
+
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "." << std::endl;
+    for (uint32_t threads : {2u, 4u, 8u}) {
+        auto before = std::chrono::steady_clock::now();
+        const std::vector<cluon::RecFileIndexEntry> ENTRIES{cluon::RecFileIndex::build("recIndex5.rec", threads, BYTES_PER_CHUNK)};
+        auto after = std::chrono::steady_clock::now();
+        requireSameEntries(expected, ENTRIES);
+        const double SECONDS{std::chrono::duration_cast<std::chrono::duration<double>>(after - before).count()};
+        std::cout << "Indexing recIndex5.rec in chunks of " << BYTES_PER_CHUNK << " bytes with " << threads << " threads: " << (gigabytes / SECONDS)
+                  << " GB/s." << std::endl;
+    }
+
+    UNLINK("recIndex5.rec");
+}
+
+TEST_CASE("Reject index files that do not match.") {
+    UNLINK("recIndex2.rec");
+    UNLINK("recIndex2.rec.idx");
+    writeRecFile("recIndex2.rec", 5, 0);
+    {
+        std::fstream recFile("recIndex2.rec", std::ios::in | std::ios::binary);
+        REQUIRE(cluon::RecFileIndex::write("recIndex2.rec", cluon::RecFileIndex::build(recFile)));
+        REQUIRE(cluon::RecFileIndex::read("recIndex2.rec").first);
+    }
+
+    // Corrupted entry.
+    {
+        std::fstream indexFile("recIndex2.rec.idx", std::ios::in | std::ios::out | std::ios::binary);
+        indexFile.seekp(48 + 3);
+        indexFile.put('\x42');
+    }
+    REQUIRE(!cluon::RecFileIndex::read("recIndex2.rec").first);
+
+    // Truncated index file.
+    {
+        std::fstream recFile("recIndex2.rec", std::ios::in | std::ios::binary);
+        REQUIRE(cluon::RecFileIndex::write("recIndex2.rec", cluon::RecFileIndex::build(recFile)));
+        std::ifstream in("recIndex2.rec.idx", std::ios::binary);
+        std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::fstream out("recIndex2.rec.idx", std::ios::out | std::ios::binary | std::ios::trunc);
+        out.write(data.data(), static_cast<std::streamsize>(data.size() - 1));
+    }
+    REQUIRE(!cluon::RecFileIndex::read("recIndex2.rec").first);
+
+    // .rec file with same size but different content.
+    {
+        std::fstream recFile("recIndex2.rec", std::ios::in | std::ios::binary);
+        REQUIRE(cluon::RecFileIndex::write("recIndex2.rec", cluon::RecFileIndex::build(recFile)));
+    }
+    writeRecFile("recIndex2.rec", 5, 1);
+    REQUIRE(!cluon::RecFileIndex::read("recIndex2.rec").first);
+
+    // .rec file with additional entries.
+    {
+        std::fstream recFile("recIndex2.rec", std::ios::in | std::ios::binary);
+        REQUIRE(cluon::RecFileIndex::write("recIndex2.rec", cluon::RecFileIndex::build(recFile)));
+    }
+    writeRecFile("recIndex2.rec", 6, 0);
+    REQUIRE(!cluon::RecFileIndex::read("recIndex2.rec").first);
+
+    // Missing .rec file.
+    UNLINK("recIndex2.rec");
+    REQUIRE(!cluon::RecFileIndex::read("recIndex2.rec").first);
+    REQUIRE(!cluon::RecFileIndex::write("recIndex2.rec", std::vector<cluon::RecFileIndexEntry>()));
+
+    UNLINK("recIndex2.rec.idx");
+}
+
+TEST_CASE("Player writes index file on first open and loads it afterwards.") {
+    constexpr bool AUTO_REWIND{false};
+    constexpr bool THREADING{false};
+
+    UNLINK("recIndex3.rec");
+    UNLINK("recIndex3.rec.idx");
+    writeRecFile("recIndex3.rec", 3, 0);
+
+    {
+        cluon::Player player("recIndex3.rec", AUTO_REWIND, THREADING);
+        REQUIRE(3 == player.totalNumberOfEnvelopesInRecFile());
+    }
+    auto index = cluon::RecFileIndex::read("recIndex3.rec");
+    REQUIRE(index.first);
+    REQUIRE(3 == index.second.size());
+
+    // Replace the index file by one with only the last Envelope to verify that the Player uses it.
+    index.second.erase(index.second.begin(), index.second.begin() + 2);
+    REQUIRE(cluon::RecFileIndex::write("recIndex3.rec", index.second));
+    {
+        cluon::Player player("recIndex3.rec", AUTO_REWIND, THREADING);
+        REQUIRE(1 == player.totalNumberOfEnvelopesInRecFile());
+        auto next = player.getNextEnvelopeToBeReplayed();
+        REQUIRE(next.first);
+        REQUIRE(102 == next.second.dataType());
+        REQUIRE(2 == next.second.senderStamp());
+    }
+
+    UNLINK("recIndex3.rec");
+    UNLINK("recIndex3.rec.idx");
+}
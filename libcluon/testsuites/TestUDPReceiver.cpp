@@ -8,6 +8,7 @@
 
 #include "catch.hpp"
 
+#include "cluon/Reactor.hpp"
 #include "cluon/UDPReceiver.hpp"
 #include "cluon/UDPSender.hpp"
 
@@ -16,6 +17,7 @@
 #include <ctime>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <thread>
 #include <utility>
@@ -172,3 +174,261 @@ TEST_CASE("Testing broadcast with 255.255.255.255 address.") {
 }
 #endif
 #endif
+
+TEST_CASE("Creating UDPReceiver with batched reception and receive data.") {
+    auto before = std::chrono::system_clock::now();
+
+    // Setup data structures to receive data from UDPReceiver.
+    std::atomic<uint32_t> numberOfDatagrams{0};
+    std::string data;
+    std::string sender;
+    std::chrono::system_clock::time_point timestamp;
+
+    cluon::UDPReceiver ur7(
+        "127.0.0.1",
+        1240,
+        [&numberOfDatagrams, &data, &sender, &timestamp ](std::string && d, std::string && s, std::chrono::system_clock::time_point && ts) noexcept {
+            data      = std::move(d);
+            sender    = std::move(s);
+            timestamp = ts;
+            numberOfDatagrams++;
+        },
+        0,
+        16);
+    REQUIRE(ur7.isRunning());
+
+    cluon::UDPSender us7{"127.0.0.1", 1240};
+    for (uint32_t i{0}; i < 3; i++) {
+        std::string TEST_DATA{"Hello World " + std::to_string(i)};
+        const auto TEST_DATA_SIZE{TEST_DATA.size()};
+        auto retVal7 = us7.send(std::move(TEST_DATA));
+        REQUIRE(TEST_DATA_SIZE == retVal7.first);
+        REQUIRE(0 == retVal7.second);
+    }
+
+    // Yield the UDP receiver so that the embedded thread has time to process the data.
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (3 > numberOfDatagrams.load());
+
+    REQUIRE(3 == numberOfDatagrams);
+    REQUIRE("Hello World 2" == data);
+    REQUIRE(sender.substr(0, sender.find(':')) == "127.0.0.1");
+
+    auto after = std::chrono::system_clock::now();
+
+    // Test if the timestamping works correctly (only on 64bit systems).
+    if (8 == sizeof(void *)) {
+        REQUIRE(before < timestamp);
+        REQUIRE(timestamp < after);
+    }
+}
+
+TEST_CASE("Creating UDPReceiver with pooled buffers and receive data.") {
+    // Setup data structures to receive data from UDPReceiver.
+    std::atomic<uint32_t> numberOfDatagrams{0};
+    std::string data;
+    struct sockaddr_in sender {};
+
+    cluon::UDPReceiver ur8(
+        "127.0.0.1",
+        1242,
+        [&numberOfDatagrams, &data, &sender ](cluon::PooledBuffer && d, const struct sockaddr_in &s, std::chrono::system_clock::time_point &&) noexcept {
+            data   = std::string(d.data(), d.size());
+            sender = s;
+            numberOfDatagrams++;
+        },
+        0,
+        16);
+    REQUIRE(ur8.isRunning());
+
+    cluon::UDPSender us8{"127.0.0.1", 1242};
+    for (uint32_t i{0}; i < 3; i++) {
+        std::string TEST_DATA{"Hello Pool " + std::to_string(i)};
+        const auto TEST_DATA_SIZE{TEST_DATA.size()};
+        auto retVal8 = us8.send(std::move(TEST_DATA));
+        REQUIRE(TEST_DATA_SIZE == retVal8.first);
+        REQUIRE(0 == retVal8.second);
+    }
+
+    // Yield the UDP receiver so that the embedded thread has time to process the data.
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (3 > numberOfDatagrams.load());
+
+    REQUIRE(3 == numberOfDatagrams);
+    REQUIRE("Hello Pool 2" == data);
+    REQUIRE(htonl(INADDR_LOOPBACK) == sender.sin_addr.s_addr);
+
+    auto stats = ur8.pipelineStatistics();
+    REQUIRE(3 == stats.numberOfQueuedEntries);
+    REQUIRE(0 == stats.numberOfDroppedEntries);
+    REQUIRE(1 <= stats.highWaterMark);
+}
+
+TEST_CASE("Creating UDPReceiver with pooled buffers and queue a burst of datagrams without heap allocations.") {
+    constexpr uint32_t MAX_DATAGRAMS{800};
+    std::atomic<bool> isDelegateBlocked{true};
+    std::atomic<uint32_t> numberOfDatagrams{0};
+
+    cluon::UDPReceiver ur8(
+        "127.0.0.1",
+        1246,
+        [&isDelegateBlocked, &numberOfDatagrams ](cluon::PooledBuffer &&, const struct sockaddr_in &, std::chrono::system_clock::time_point &&) noexcept {
+            // Keep the datagrams waiting in the pipeline until the burst is over.
+            using namespace std::literals::chrono_literals; // NOLINT
+            while (isDelegateBlocked.load()) { std::this_thread::sleep_for(1ms); }
+            numberOfDatagrams++;
+        },
+        0,
+        16);
+    REQUIRE(ur8.isRunning());
+
+    using namespace std::literals::chrono_literals; // NOLINT
+    cluon::UDPSender us8{"127.0.0.1", 1246};
+    for (uint32_t i{0}; i < MAX_DATAGRAMS; i++) {
+        us8.send(std::string(64, 'A'));
+        if (0 == (i % 50)) {
+            std::this_thread::sleep_for(5ms);
+        }
+    }
+    std::this_thread::sleep_for(100ms);
+
+    auto stats = ur8.pipelineStatistics();
+    const uint64_t NUMBER_OF_OVERFLOW_ALLOCATIONS{ur8.numberOfOverflowAllocations()};
+    isDelegateBlocked.store(false);
+    do { std::this_thread::sleep_for(1ms); } while (stats.numberOfQueuedEntries > numberOfDatagrams.load());
+
+    // Every waiting datagram must have been received into a pre-allocated slab.
+    REQUIRE(128 < stats.numberOfQueuedEntries);
+    REQUIRE(0 == stats.numberOfDroppedEntries);
+    REQUIRE(0 == NUMBER_OF_OVERFLOW_ALLOCATIONS);
+}
+
+TEST_CASE("Benchmark UDPReceiver with single and batched reception.", "[.benchmark]") {
+    constexpr uint32_t MAX_DATAGRAMS{20 * 1000};
+    for (uint16_t receiveBatchSize : {static_cast<uint16_t>(1), static_cast<uint16_t>(32)}) {
+        std::atomic<uint32_t> numberOfDatagrams{0};
+        cluon::UDPReceiver ur8(
+            "127.0.0.1",
+            1241,
+            [&numberOfDatagrams](std::string &&, std::string &&, std::chrono::system_clock::time_point &&) noexcept { numberOfDatagrams++; },
+            0,
+            receiveBatchSize);
+        REQUIRE(ur8.isRunning());
+
+        cluon::UDPSender us8{"127.0.0.1", 1241};
+        auto before = std::chrono::steady_clock::now();
+        for (uint32_t i{0}; i < MAX_DATAGRAMS; i++) {
+            us8.send(std::string(64, 'A'));
+        }
+
+        // Wait until all datagrams were processed or nothing arrives anymore.
+        using namespace std::literals::chrono_literals; // NOLINT
+        uint32_t previous{0};
+        do {
+            previous = numberOfDatagrams.load();
+            std::this_thread::sleep_for(100ms);
+        } while ((numberOfDatagrams.load() < MAX_DATAGRAMS) && (previous != numberOfDatagrams.load()));
+        auto after = std::chrono::steady_clock::now();
+
+        const auto DURATION{std::chrono::duration_cast<std::chrono::microseconds>(after - before).count()};
+        std::cout << "UDPReceiver with batch size " << receiveBatchSize << " received " << numberOfDatagrams.load() << "/" << MAX_DATAGRAMS
+                  << " datagrams in " << DURATION << " microseconds ("
+                  << static_cast<float>(numberOfDatagrams.load()) * 1000.0f * 1000.0f / static_cast<float>(DURATION) << " datagrams/s)." << std::endl;
+        REQUIRE(0 < numberOfDatagrams.load());
+    }
+}
+
+TEST_CASE("Creating several UDPReceivers on a shared Reactor and receive data.") {
+    auto reactor = std::make_shared<cluon::Reactor>();
+    REQUIRE(reactor->isRunning());
+
+    std::atomic<uint32_t> numberOfDatagrams{0};
+    std::atomic<uint32_t> numberOfPooledDatagrams{0};
+    {
+        cluon::UDPReceiver ur9(reactor, "127.0.0.1", 1243, [&numberOfDatagrams](std::string &&, std::string &&, std::chrono::system_clock::time_point &&) noexcept {
+            numberOfDatagrams++;
+        });
+        cluon::UDPReceiver ur10(
+            reactor,
+            "127.0.0.1",
+            1244,
+            [&numberOfPooledDatagrams](cluon::PooledBuffer &&, const struct sockaddr_in &, std::chrono::system_clock::time_point &&) noexcept {
+                numberOfPooledDatagrams++;
+            },
+            0,
+            8);
+        REQUIRE(ur9.isRunning());
+        REQUIRE(ur10.isRunning());
+        REQUIRE(2 == reactor->numberOfFileDescriptors());
+
+        cluon::UDPSender us9{"127.0.0.1", 1243};
+        cluon::UDPSender us10{"127.0.0.1", 1244};
+        for (uint32_t i{0}; i < 3; i++) {
+            us9.send("Hello Reactor 1");
+            us10.send("Hello Reactor 2");
+        }
+
+        using namespace std::literals::chrono_literals; // NOLINT
+        do { std::this_thread::sleep_for(1ms); } while ((3 > numberOfDatagrams.load()) || (3 > numberOfPooledDatagrams.load()));
+    }
+    REQUIRE(3 == numberOfDatagrams);
+    REQUIRE(3 == numberOfPooledDatagrams);
+
+    // The Reactor keeps running after its UDPReceivers are gone.
+    REQUIRE(0 == reactor->numberOfFileDescriptors());
+    REQUIRE(reactor->isRunning());
+}
+
+TEST_CASE("Several UDPReceivers on a shared Reactor receive bursts larger than one wakeup.") {
+    constexpr uint32_t MAX_DATAGRAMS{300};
+    auto reactor = std::make_shared<cluon::Reactor>();
+    REQUIRE(reactor->isRunning());
+
+    std::atomic<uint32_t> numberOfDatagrams{0};
+    std::atomic<uint32_t> numberOfBatchedDatagrams{0};
+    cluon::UDPReceiver ur11(reactor, "127.0.0.1", 1247, [&numberOfDatagrams](std::string &&, std::string &&, std::chrono::system_clock::time_point &&) noexcept {
+        numberOfDatagrams++;
+    });
+    cluon::UDPReceiver ur12(
+        reactor,
+        "127.0.0.1",
+        1248,
+        [&numberOfBatchedDatagrams](std::string &&, std::string &&, std::chrono::system_clock::time_point &&) noexcept { numberOfBatchedDatagrams++; },
+        0,
+        8);
+    REQUIRE(ur11.isRunning());
+    REQUIRE(ur12.isRunning());
+
+    using namespace std::literals::chrono_literals; // NOLINT
+    cluon::UDPSender us11{"127.0.0.1", 1247};
+    cluon::UDPSender us12{"127.0.0.1", 1248};
+    for (uint32_t i{0}; i < MAX_DATAGRAMS; i++) {
+        us11.send(std::string(64, 'A'));
+        us12.send(std::string(64, 'B'));
+        if (0 == (i % 50)) {
+            std::this_thread::sleep_for(5ms);
+        }
+    }
+
+    // The remaining datagrams are read on the following wakeups.
+    uint32_t previous{0};
+    do {
+        previous = numberOfDatagrams.load() + numberOfBatchedDatagrams.load();
+        std::this_thread::sleep_for(100ms);
+    } while (((MAX_DATAGRAMS > numberOfDatagrams.load()) || (MAX_DATAGRAMS > numberOfBatchedDatagrams.load()))
+             && (previous != numberOfDatagrams.load() + numberOfBatchedDatagrams.load()));
+    REQUIRE(MAX_DATAGRAMS == numberOfDatagrams.load());
+    REQUIRE(MAX_DATAGRAMS == numberOfBatchedDatagrams.load());
+}
+
+TEST_CASE("Stopping an idle UDPReceiver does not wait for a timeout.") {
+    auto before = std::chrono::steady_clock::now();
+    for (uint32_t i{0}; i < 10; i++) {
+        cluon::UDPReceiver ur11{"127.0.0.1", 1245, nullptr};
+        REQUIRE(ur11.isRunning());
+    }
+    auto after = std::chrono::steady_clock::now();
+    const auto DURATION{std::chrono::duration_cast<std::chrono::microseconds>(after - before).count()};
+    std::cout << "Creating and stopping 10 UDPReceivers took " << DURATION << " microseconds." << std::endl;
+    REQUIRE(0 < DURATION);
+}
@@ -8,11 +8,20 @@
 
 #include "catch.hpp"
 
+#include "cluon/UDPReceiver.hpp"
 #include "cluon/UDPSender.hpp"
 
 #include <cerrno>
+#include <ctime>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 // Defining a test fixture to be reused among the test cases.
 class TestFixture_UDPSender {
@@ -99,3 +108,262 @@ TEST_CASE("Trying to send data with incomplete sendToAddress.") {
 #endif
     REQUIRE(EXPECTED_VALUE == retVal6.second);
 }
+
+TEST_CASE("Send several datagrams at once.") {
+    std::atomic<uint32_t> numberOfDatagrams{0};
+    cluon::UDPReceiver ur("127.0.0.1", 1246, [&numberOfDatagrams](std::string &&, std::string &&, std::chrono::system_clock::time_point &&) noexcept {
+        numberOfDatagrams++;
+    });
+    REQUIRE(ur.isRunning());
+
+    cluon::UDPSender us{"127.0.0.1", 1246};
+    std::vector<std::string> datagrams{"Hello", "", std::string(70000, 'A'), "World"};
+    auto retVal = us.send(std::move(datagrams));
+    REQUIRE(4 == retVal.size());
+    REQUIRE(5 == retVal[0].first);
+    REQUIRE(0 == retVal[0].second);
+    REQUIRE(0 == retVal[1].first);
+    REQUIRE(0 == retVal[1].second);
+    REQUIRE(-1 == retVal[2].first);
+    REQUIRE(E2BIG == retVal[2].second);
+    REQUIRE(5 == retVal[3].first);
+    REQUIRE(0 == retVal[3].second);
+
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (2 > numberOfDatagrams.load());
+    REQUIRE(2 == numberOfDatagrams.load());
+}
+
+TEST_CASE("Send several datagrams at once with invalid UDPSender.") {
+    cluon::UDPSender us{"127.0.0.1", 0};
+    std::vector<std::string> datagrams{"Hello", "World"};
+    auto retVal = us.send(std::move(datagrams));
+    REQUIRE(2 == retVal.size());
+    REQUIRE(-1 == retVal[0].first);
+    REQUIRE(EBADF == retVal[0].second);
+    REQUIRE(-1 == retVal[1].first);
+    REQUIRE(EBADF == retVal[1].second);
+
+    auto retVal2 = us.enqueue("Hello");
+    REQUIRE(-1 == retVal2.first);
+    REQUIRE(EBADF == retVal2.second);
+
+    REQUIRE(!us.enableSegmentationOffload(true));
+    REQUIRE(us.enableSegmentationOffload(false));
+}
+
+TEST_CASE("Send several datagrams at once with segmentation and receive offload.") {
+    std::mutex receivedDatagramsMutex;
+    std::vector<std::string> receivedDatagrams;
+    cluon::UDPReceiver ur("127.0.0.1", 1248, [&receivedDatagramsMutex, &receivedDatagrams](std::string &&data, std::string &&, std::chrono::system_clock::time_point &&) noexcept {
+        std::lock_guard<std::mutex> lck(receivedDatagramsMutex);
+        receivedDatagrams.emplace_back(std::move(data));
+    });
+    REQUIRE(ur.isRunning());
+    // Kernels without offload support fall back to regular datagrams.
+    const bool RECEIVE_OFFLOAD{ur.enableReceiveOffload(true)};
+
+    cluon::UDPSender us{"127.0.0.1", 1248};
+    const bool SEGMENTATION_OFFLOAD{us.enableSegmentationOffload(true)};
+    std::cout << "UDPSender segmentation offload: " << SEGMENTATION_OFFLOAD << ", UDPReceiver receive offload: " << RECEIVE_OFFLOAD << std::endl;
+
+    // Runs of equal size with shorter last datagrams, interrupted by an invalid one.
+    std::vector<std::string> datagrams;
+    for (char c{'a'}; c < 'k'; c++) {
+        datagrams.emplace_back(std::string(1000, c));
+    }
+    datagrams.emplace_back(std::string(500, 'k'));
+    datagrams.emplace_back(std::string(70000, 'l'));
+    datagrams.emplace_back(std::string(1200, 'm'));
+    datagrams.emplace_back(std::string(1200, 'n'));
+    datagrams.emplace_back(std::string(1100, 'o'));
+    const std::vector<std::string> EXPECTED{datagrams};
+
+    auto retVal = us.send(std::move(datagrams));
+    REQUIRE(EXPECTED.size() == retVal.size());
+    for (std::size_t i{0}; i < EXPECTED.size(); i++) {
+        if (70000 == EXPECTED[i].size()) {
+            REQUIRE(-1 == retVal[i].first);
+            REQUIRE(E2BIG == retVal[i].second);
+        } else {
+            REQUIRE(static_cast<ssize_t>(EXPECTED[i].size()) == retVal[i].first);
+            REQUIRE(0 == retVal[i].second);
+        }
+    }
+
+    using namespace std::literals::chrono_literals; // NOLINT
+    std::size_t numberOfReceivedDatagrams{0};
+    do {
+        std::this_thread::sleep_for(1ms);
+        std::lock_guard<std::mutex> lck(receivedDatagramsMutex);
+        numberOfReceivedDatagrams = receivedDatagrams.size();
+    } while (EXPECTED.size() - 1 > numberOfReceivedDatagrams);
+
+    std::lock_guard<std::mutex> lck(receivedDatagramsMutex);
+    REQUIRE(EXPECTED.size() - 1 == receivedDatagrams.size());
+    std::size_t j{0};
+    for (std::size_t i{0}; i < EXPECTED.size(); i++) {
+        if (70000 != EXPECTED[i].size()) {
+            REQUIRE(EXPECTED[i] == receivedDatagrams[j++]);
+        }
+    }
+}
+
+TEST_CASE("Queued datagrams are sent on flush.") {
+    std::atomic<uint32_t> numberOfDatagrams{0};
+    cluon::UDPReceiver ur("127.0.0.1", 1246, [&numberOfDatagrams](std::string &&, std::string &&, std::chrono::system_clock::time_point &&) noexcept {
+        numberOfDatagrams++;
+    });
+    REQUIRE(ur.isRunning());
+
+    cluon::UDPSender us{"127.0.0.1", 1246};
+    REQUIRE(5 == us.enqueue("Hello").first);
+    REQUIRE(5 == us.enqueue("World").first);
+    REQUIRE(-1 == us.enqueue(std::string(70000, 'A')).first);
+
+    using namespace std::literals::chrono_literals; // NOLINT
+    std::this_thread::sleep_for(50ms);
+    REQUIRE(0 == numberOfDatagrams.load());
+
+    auto retVal = us.flush();
+    REQUIRE(2 == retVal.size());
+    REQUIRE(5 == retVal[0].first);
+    REQUIRE(5 == retVal[1].first);
+    REQUIRE(us.flush().empty());
+
+    do { std::this_thread::sleep_for(1ms); } while (2 > numberOfDatagrams.load());
+    REQUIRE(2 == numberOfDatagrams.load());
+}
+
+TEST_CASE("Queued datagrams are sent when the queue is full.") {
+    std::atomic<uint32_t> numberOfDatagrams{0};
+    cluon::UDPReceiver ur("127.0.0.1", 1246, [&numberOfDatagrams](std::string &&, std::string &&, std::chrono::system_clock::time_point &&) noexcept {
+        numberOfDatagrams++;
+    });
+    REQUIRE(ur.isRunning());
+
+    std::atomic<uint32_t> numberOfFlushes{0};
+    std::atomic<uint32_t> numberOfResults{0};
+    cluon::UDPSender us{"127.0.0.1", 1246};
+    us.setFlushPolicy(3, std::chrono::microseconds(0), [&numberOfFlushes, &numberOfResults](std::vector<std::pair<ssize_t, int32_t>> &&retVal) noexcept {
+        numberOfFlushes++;
+        for (auto e : retVal) {
+            numberOfResults += ((3 == e.first) && (0 == e.second)) ? 1 : 0;
+        }
+    });
+    for (uint32_t i{0}; i < 7; i++) {
+        REQUIRE(3 == us.enqueue("ABC").first);
+    }
+    REQUIRE(2 == numberOfFlushes.load());
+    REQUIRE(6 == numberOfResults.load());
+
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (6 > numberOfDatagrams.load());
+    std::this_thread::sleep_for(50ms);
+    REQUIRE(6 == numberOfDatagrams.load());
+
+    // The last datagram is sent when the UDPSender is destroyed.
+}
+
+TEST_CASE("Queued datagrams are sent after the deadline.") {
+    std::atomic<uint32_t> numberOfDatagrams{0};
+    cluon::UDPReceiver ur("127.0.0.1", 1246, [&numberOfDatagrams](std::string &&, std::string &&, std::chrono::system_clock::time_point &&) noexcept {
+        numberOfDatagrams++;
+    });
+    REQUIRE(ur.isRunning());
+
+    std::atomic<uint32_t> numberOfResults{0};
+    cluon::UDPSender us{"127.0.0.1", 1246};
+    us.setFlushPolicy(100, std::chrono::microseconds(10 * 1000), [&numberOfResults](std::vector<std::pair<ssize_t, int32_t>> &&retVal) noexcept {
+        numberOfResults += static_cast<uint32_t>(retVal.size());
+    });
+    REQUIRE(5 == us.enqueue("Hello").first);
+    REQUIRE(5 == us.enqueue("World").first);
+
+    using namespace std::literals::chrono_literals; // NOLINT
+    do { std::this_thread::sleep_for(1ms); } while (2 > numberOfDatagrams.load());
+    REQUIRE(2 == numberOfResults.load());
+    REQUIRE(2 == numberOfDatagrams.load());
+}
+
+TEST_CASE("Benchmark UDPSender with single and batched sending.", "[.benchmark]") {
+    constexpr uint32_t MAX_DATAGRAMS{20 * 1000};
+    constexpr uint32_t BATCH_SIZE{32};
+    cluon::UDPSender us{"127.0.0.1", 1247};
+
+    auto before = std::chrono::steady_clock::now();
+    for (uint32_t i{0}; i < MAX_DATAGRAMS; i++) {
+        us.send(std::string(64, 'A'));
+    }
+    auto after = std::chrono::steady_clock::now();
+    const auto DURATION_SINGLE{std::chrono::duration_cast<std::chrono::microseconds>(after - before).count()};
+
+    before = std::chrono::steady_clock::now();
+    for (uint32_t i{0}; i < MAX_DATAGRAMS / BATCH_SIZE; i++) {
+        std::vector<std::string> datagrams(BATCH_SIZE, std::string(64, 'A'));
+        us.send(std::move(datagrams));
+    }
+    after = std::chrono::steady_clock::now();
+    const auto DURATION_BATCHED{std::chrono::duration_cast<std::chrono::microseconds>(after - before).count()};
+
+    std::cout << "UDPSender sent " << MAX_DATAGRAMS << " datagrams one by one in " << DURATION_SINGLE << " microseconds and in batches of " << BATCH_SIZE
+              << " in " << DURATION_BATCHED << " microseconds." << std::endl;
+    REQUIRE(0 < DURATION_SINGLE);
+    REQUIRE(0 < DURATION_BATCHED);
+}
+
+TEST_CASE("Benchmark UDPSender and UDPReceiver with and without segmentation and receive offload.", "[.benchmark]") {
+    constexpr uint32_t DATAGRAM_SIZE{1400};
+    constexpr uint32_t BATCH_SIZE{44}; // Fits into one offloaded buffer of at most 64KB.
+    constexpr uint64_t BYTES_TO_SEND{256 * 1024 * 1024};
+    constexpr uint64_t MAX_BYTES_IN_FLIGHT{2 * BATCH_SIZE * DATAGRAM_SIZE};
+    const std::string DATAGRAM(DATAGRAM_SIZE, 'A');
+
+    for (bool offload : {false, true}) {
+        std::atomic<uint64_t> bytesReceived{0};
+        cluon::UDPReceiver ur("127.0.0.1", 1249, [&bytesReceived](cluon::PooledBuffer &&data, const struct sockaddr_in &, std::chrono::system_clock::time_point &&) noexcept {
+            bytesReceived += data.size();
+        });
+        REQUIRE(ur.isRunning());
+        cluon::UDPSender us{"127.0.0.1", 1249};
+        const bool RECEIVE_OFFLOAD{ur.enableReceiveOffload(offload) && offload};
+        const bool SEGMENTATION_OFFLOAD{us.enableSegmentationOffload(offload) && offload};
+
+        using namespace std::literals::chrono_literals; // NOLINT
+        uint64_t bytesSent{0};
+        uint64_t bytesLost{0};
+        const std::clock_t BEFORE{std::clock()};
+        while (bytesSent < BYTES_TO_SEND) {
+            // Do not outrun the receiver as the kernel would drop the datagrams.
+            uint64_t previousBytesReceived{bytesReceived.load()};
+            auto lastProgress{std::chrono::steady_clock::now()};
+            while (bytesReceived.load() + bytesLost + MAX_BYTES_IN_FLIGHT < bytesSent) {
+                std::this_thread::sleep_for(10us);
+                if (previousBytesReceived != bytesReceived.load()) {
+                    previousBytesReceived = bytesReceived.load();
+                    lastProgress          = std::chrono::steady_clock::now();
+                } else if (100ms < std::chrono::steady_clock::now() - lastProgress) {
+                    // Nothing arrived anymore; consider the bytes in flight as dropped.
+                    bytesLost = bytesSent - bytesReceived.load();
+                }
+            }
+            std::vector<std::string> datagrams(BATCH_SIZE, DATAGRAM);
+            for (auto &r : us.send(std::move(datagrams))) {
+                bytesSent += static_cast<uint64_t>((std::max)(r.first, static_cast<ssize_t>(0)));
+            }
+        }
+        // Give the receiver the chance to drain the socket.
+        std::this_thread::sleep_for(100ms);
+        const std::clock_t AFTER{std::clock()};
+
+        // CPU time of all threads of this process, i.e., sending and receiving, per received byte.
+        const double CPU_SECONDS{static_cast<double>(AFTER - BEFORE) / CLOCKS_PER_SEC};
+        const double GIGABYTES{static_cast<double>(bytesReceived.load()) / (1024.0 * 1024.0 * 1024.0)};
+        std::cout << "UDPSender/UDPReceiver (segmentation offload: " << SEGMENTATION_OFFLOAD << ", receive offload: " << RECEIVE_OFFLOAD << ") sent "
+                  << bytesSent << " bytes and received " << bytesReceived.load() << " bytes in " << DATAGRAM_SIZE << " bytes datagrams using "
+                  << (CPU_SECONDS / GIGABYTES) << " CPU seconds per GB." << std::endl;
+        REQUIRE(BYTES_TO_SEND <= bytesSent);
+        // Datagrams may be dropped by the kernel or the receiver but not in large numbers.
+        REQUIRE(0.9 < static_cast<double>(bytesReceived.load()) / static_cast<double>(bytesSent));
+    }
+}
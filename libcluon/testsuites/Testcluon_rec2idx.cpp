@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "catch.hpp"
+
+#include "cluon-rec2idx.hpp"
+
+#include "cluon/Envelope.hpp"
+#include "cluon/RecFileIndex.hpp"
+#include "cluon/cluonDataStructures.hpp"
+
+#include <fstream>
+#include <string>
+
+// clang-format off
+#ifdef WIN32
+    #define UNLINK _unlink
+#else
+    #include <unistd.h>
+    #define UNLINK unlink
+#endif
+// clang-format on
+
+TEST_CASE("Test empty commandline parameters.") {
+    int32_t argc       = 1;
+    const char *argv[] = {static_cast<const char *>("cluon-rec2idx")};
+    REQUIRE(1 == cluon_rec2idx(argc, const_cast<char **>(argv)));
+}
+
+TEST_CASE("Test non-existing .rec file.") {
+    UNLINK("GHI1.rec");
+    constexpr int32_t argc = 2;
+    const char *argv[]     = {static_cast<const char *>("cluon-rec2idx"), static_cast<const char *>("GHI1.rec")};
+    REQUIRE(1 == cluon_rec2idx(argc, const_cast<char **>(argv)));
+}
+
+TEST_CASE("Test creating index files for several .rec files.") {
+    for (std::string file : {"GHI2.rec", "GHI3.rec"}) {
+        UNLINK(file.c_str());
+        UNLINK((file + ".idx").c_str());
+        std::fstream recordingFile(file, std::ios::out | std::ios::binary | std::ios::trunc);
+        for (uint32_t i{0}; i < 4; i++) {
+            cluon::data::Envelope env;
+            env.dataType(12).senderStamp(i);
+            const std::string DATA{cluon::serializeEnvelope(std::move(env))};
+            recordingFile.write(DATA.data(), static_cast<std::streamsize>(DATA.size()));
+        }
+    }
+
+    constexpr int32_t argc = 3;
+    const char *argv[] = {static_cast<const char *>("cluon-rec2idx"), static_cast<const char *>("GHI2.rec"), static_cast<const char *>("GHI3.rec")};
+    REQUIRE(0 == cluon_rec2idx(argc, const_cast<char **>(argv)));
+    REQUIRE(4 == cluon::RecFileIndex::read("GHI2.rec").second.size());
+    REQUIRE(4 == cluon::RecFileIndex::read("GHI3.rec").second.size());
+
+    // Valid index files are kept unless --force is given.
+    REQUIRE(0 == cluon_rec2idx(argc, const_cast<char **>(argv)));
+    constexpr int32_t argcForce = 3;
+    const char *argvForce[] = {static_cast<const char *>("cluon-rec2idx"), static_cast<const char *>("--force"), static_cast<const char *>("GHI2.rec")};
+    REQUIRE(0 == cluon_rec2idx(argcForce, const_cast<char **>(argvForce)));
+    REQUIRE(cluon::RecFileIndex::read("GHI2.rec").first);
+
+    for (std::string file : {"GHI2.rec", "GHI3.rec"}) {
+        UNLINK(file.c_str());
+        UNLINK((file + ".idx").c_str());
+    }
+}
@@ -87,13 +87,15 @@ inline int32_t cluon_filter(int32_t argc, char **argv) {
         bool foundData{false};
         uint32_t counter{0};
         bool endInitialized{false};
+        // Only the Envelopes' headers are scanned and matching Envelopes are passed through as they are.
+        std::string data;
         do {
-            auto retVal = cluon::extractEnvelope(std::cin);
-            foundData = retVal.first;
-            if ( (0 < retVal.second.dataType()) && (retVal.second.dataType() != cluon::data::PlayerStatus::ID()) ) {
+            foundData = cluon::extractEnvelopeData(std::cin, data);
+            auto retVal = cluon::scanEnvelope(data.data(), data.size());
+            if ( foundData && retVal.first && (0 < retVal.second.m_dataType) && (retVal.second.m_dataType != cluon::data::PlayerStatus::ID()) ) {
                 counter++;
                 if (counter > SKIP) {
-                    cluon::data::TimeStamp sampleTimeStamp = retVal.second.sampleTimeStamp();
+                    const cluon::data::TimeStamp &sampleTimeStamp = retVal.second.m_sampleTimeStamp;
                     if (isRelativeEnd && !endInitialized) {
                         endInitialized = true;
                         END += (START > 0 ? START : sampleTimeStamp.seconds());
@@ -101,16 +103,14 @@ inline int32_t cluon_filter(int32_t argc, char **argv) {
                     }
                     if ( (sampleTimeStamp.seconds() > START) && (sampleTimeStamp.seconds() < END) ) {
                         std::stringstream sstr;
-                        sstr << retVal.second.dataType() << "/" << retVal.second.senderStamp();
+                        sstr << retVal.second.m_dataType << "/" << retVal.second.m_senderStamp;
                         std::string str = sstr.str();
                         if ( (0 < mapOfEnvelopesToKeep.size()) && mapOfEnvelopesToKeep.count(str)) {
-                            str = cluon::serializeEnvelope(std::move(retVal.second));
-                            std::cout << str;
+                            std::cout.write(data.data(), static_cast<std::streamsize>(data.size()));
                             std::cout.flush();
                         }
                         if ( (0 < mapOfEnvelopesToDrop.size()) && !mapOfEnvelopesToDrop.count(str)) {
-                            str = cluon::serializeEnvelope(std::move(retVal.second));
-                            std::cout << str;
+                            std::cout.write(data.data(), static_cast<std::streamsize>(data.size()));
                             std::cout.flush();
                         }
                     }
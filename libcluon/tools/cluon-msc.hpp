@@ -29,8 +29,9 @@ inline int32_t cluon_msc(int32_t argc, char **argv) {
     if (std::string::npos != inputFilename.find(PROGRAM)) {
         std::cerr << PROGRAM
                   << " transforms a given message specification file in .odvd format into C++." << std::endl;
-        std::cerr << "Usage:   " << PROGRAM << " [--cpp] [--proto] [--out=<file>] <odvd file>" << std::endl;
+        std::cerr << "Usage:   " << PROGRAM << " [--cpp] [--cpp-proto-codec] [--proto] [--out=<file>] <odvd file>" << std::endl;
         std::cerr << "         " << PROGRAM << " --cpp:   Generate C++14-compliant, self-contained header file." << std::endl;
+        std::cerr << "         " << PROGRAM << " --cpp-proto-codec: Generate C++14-compliant, self-contained header file with additional methods encodeProto and decodeProto." << std::endl;
         std::cerr << "         " << PROGRAM << " --proto: Generate Proto version2-compliant file." << std::endl;
         std::cerr << std::endl;
         std::cerr << "Example: " << PROGRAM << " --cpp --out=/tmp/myOutput.hpp myFile.odvd" << std::endl;
@@ -40,7 +41,8 @@ inline int32_t cluon_msc(int32_t argc, char **argv) {
     std::string outputFilename;
     commandline({"--out"}) >> outputFilename;
 
-    const bool generateCPP = commandline[{"--cpp"}];
+    const bool generateProtoCodec = commandline[{"--cpp-proto-codec"}];
+    const bool generateCPP = commandline[{"--cpp"}] || generateProtoCodec;
     const bool generateProto = commandline[{"--proto"}];
 
     int retVal = 1;
@@ -61,7 +63,7 @@ inline int32_t cluon_msc(int32_t argc, char **argv) {
         for (auto e : result.first) {
             std::string content;
             if (generateCPP) {
-                cluon::MetaMessageToCPPTransformator transformation;
+                cluon::MetaMessageToCPPTransformator transformation{generateProtoCodec};
                 e.accept([&trans = transformation](const cluon::MetaMessage &_mm){ trans.visit(_mm); });
                 content = transformation.content();
             }
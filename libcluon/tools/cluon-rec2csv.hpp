@@ -103,14 +103,12 @@ inline int32_t cluon_rec2csv(int32_t argc, char **argv) {
                     }
                     cluon::data::Envelope env{std::move(next.second)};
                     if (scope.count(env.dataType()) > 0) {
-                        cluon::FromProtoVisitor protoDecoder;
-                        std::stringstream sstr(env.serializedData());
-                        protoDecoder.decodeFrom(sstr);
-
                         cluon::MetaMessage m = scope[env.dataType()];
                         cluon::GenericMessage gm;
                         gm.createFrom(m, messageParserResult.first);
-                        gm.accept(protoDecoder);
+
+                        cluon::FromProtoVisitor protoDecoder;
+                        protoDecoder.decodeFrom(env.serializedData().data(), env.serializedData().size(), gm);
 
                         std::stringstream sstrKey;
                         sstrKey << env.dataType() << "/" << env.senderStamp();
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2018  Christian Berger
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef CLUON_REC2IDX_HPP
+#define CLUON_REC2IDX_HPP
+
+#include "cluon/cluon.hpp"
+#include "cluon/RecFileIndex.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+inline int32_t cluon_rec2idx(int32_t argc, char **argv) {
+    int32_t retCode{0};
+    bool force{false};
+    std::vector<std::string> recFiles;
+    for (int32_t i{1}; i < argc; i++) {
+        const std::string ARG{argv[i]};
+        if ("--force" == ARG) {
+            force = true;
+        } else if (0 != ARG.find("--")) {
+            recFiles.push_back(ARG);
+        }
+    }
+
+    if (recFiles.empty()) {
+        std::cerr << argv[0] << " creates the index files that are used by cluon-replay and cluon::Player for the given .rec files." << std::endl;
+        std::cerr << "Usage:   " << argv[0] << " [--force] <.rec file> [<.rec file> ...]" << std::endl;
+        std::cerr << "         --force: recreate index files even if they are valid" << std::endl;
+        std::cerr << "Example: " << argv[0] << " myRecording1.rec myRecording2.rec" << std::endl;
+        retCode = 1;
+    } else {
+        for (const auto &recFile : recFiles) {
+            auto index = cluon::RecFileIndex::read(recFile);
+            if (!force && index.first) {
+                std::cout << recFile << ": " << index.second.size() << " entries; index file is up to date." << std::endl;
+                continue;
+            }
+
+            {
+                std::fstream in(recFile, std::ios::in | std::ios::binary);
+                if (!in.good()) {
+                    std::cerr << argv[0] << ": " << recFile << " could not be opened." << std::endl;
+                    retCode = 1;
+                    continue;
+                }
+            }
+            index.second = cluon::RecFileIndex::build(recFile);
+            if (cluon::RecFileIndex::write(recFile, index.second)) {
+                std::cout << recFile << ": " << index.second.size() << " entries; wrote " << cluon::RecFileIndex::indexFileFor(recFile) << "." << std::endl;
+            } else {
+                retCode = 1;
+            }
+        }
+    }
+    return retCode;
+}
+
+#endif